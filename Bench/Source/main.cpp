@@ -0,0 +1,332 @@
+#include "YUME/yume.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <string>
+#include <glm/gtc/matrix_transform.hpp>
+
+
+
+// Renders a few fixed scenes offscreen and writes the CPU frame times as JSON.
+// No window is created, so it also runs on a software ICD, e.g.
+//   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./Bench --frames 300
+namespace YUME
+{
+	struct BenchSettings
+	{
+		uint32_t Width		  = 1280;
+		uint32_t Height		  = 720;
+		uint32_t Frames		  = 300;
+		uint32_t WarmupFrames = 30;
+
+		uint32_t SpriteCount  = 10000;
+		uint32_t ModelCount	  = 256;
+		uint32_t LightCount	  = 64;
+
+		std::string Output	  = "bench_report.json";
+	};
+
+	struct BenchResult
+	{
+		std::string Name;
+		uint32_t EntityCount = 0;
+		uint32_t DrawCalls	 = 0;
+		uint32_t VisibleMeshes = 0;
+		uint32_t CulledMeshes  = 0;
+		std::vector<double> FrameTimesMs;
+	};
+
+	struct BenchScene
+	{
+		std::string Name;
+		std::function<uint32_t(Scene*)> Setup; // returns the entity count
+		bool Renderer2D = false;
+		bool Renderer3D = true;
+		Camera MainCamera;
+	};
+
+
+	class BenchLayer : public Layer
+	{
+	public:
+		explicit BenchLayer(const BenchSettings& p_Settings)
+			: Layer("Bench"), m_Settings(p_Settings)
+		{
+			float aspect = (float)m_Settings.Width / (float)m_Settings.Height;
+
+			glm::vec3 eye	   = { 0.0f, 12.0f, 30.0f };
+			Camera perspective = Camera(glm::perspective(glm::radians(60.0f), aspect, 0.1f, 1000.0f),
+				glm::lookAt(eye, glm::vec3(0.0f), { 0.0f, 1.0f, 0.0f }), eye);
+
+			float halfHeight   = 50.0f;
+			Camera ortho	   = Camera(glm::ortho(-halfHeight * aspect, halfHeight * aspect, -halfHeight, halfHeight, -10.0f, 10.0f),
+				glm::mat4(1.0f), glm::vec3(0.0f));
+
+			m_Scenes.push_back({ "sprites", [this](Scene* p_Scene) { return SetupSprites(p_Scene); }, true, false, ortho });
+			m_Scenes.push_back({ "models", [this](Scene* p_Scene) { return SetupModels(p_Scene); }, false, true, perspective });
+			m_Scenes.push_back({ "lights", [this](Scene* p_Scene) { return SetupLights(p_Scene); }, false, true, perspective });
+		}
+
+		~BenchLayer() override { delete m_Scene; }
+
+		void OnAttach() override
+		{
+			m_Model = CreateRef<Model>("Resources/Meshes/DamagedHelmet/DamagedHelmet.gltf");
+			m_SpriteTexture = TextureImporter::LoadTexture2D("Resources/checkerboard.png");
+
+			LoadScene(0);
+		}
+
+		void OnUpdate(const Timestep& p_Ts) override
+		{
+			if (m_SceneIndex >= m_Scenes.size())
+				return;
+
+			// Time between two updates covers the whole main loop iteration, submit included
+			double time = Clock::GetTime();
+			if (m_Frame > m_Settings.WarmupFrames)
+				m_Results[m_SceneIndex].FrameTimesMs.push_back((time - m_LastTime) * 1000.0);
+			m_LastTime = time;
+
+			if (m_Results[m_SceneIndex].FrameTimesMs.size() >= m_Settings.Frames)
+			{
+				auto stats = Renderer::GetStats();
+				m_Results[m_SceneIndex].DrawCalls	  = stats.DrawCalls;
+				m_Results[m_SceneIndex].VisibleMeshes = stats.VisibleMeshes;
+				m_Results[m_SceneIndex].CulledMeshes  = stats.CulledMeshes;
+
+				if (m_SceneIndex + 1 >= m_Scenes.size())
+				{
+					m_SceneIndex++;
+					WriteReport();
+					Application::Get().Close();
+					return;
+				}
+
+				LoadScene(m_SceneIndex + 1);
+			}
+
+			const auto& bench = m_Scenes[m_SceneIndex];
+
+			RendererBeginInfo rbi{};
+			rbi.MainCamera = bench.MainCamera;
+			rbi.Width	   = m_Settings.Width;
+			rbi.Height	   = m_Settings.Height;
+
+			Renderer::Begin(rbi);
+
+			m_Scene->OnRender();
+
+			Renderer::End();
+
+			m_Frame++;
+		}
+
+	private:
+		void LoadScene(uint32_t p_Index)
+		{
+			delete m_Scene;
+			m_Scene = new Scene();
+
+			m_SceneIndex = p_Index;
+			m_Frame		 = 0;
+
+			const auto& bench = m_Scenes[p_Index];
+
+			auto& settings		= Renderer::GetSettings();
+			settings.Renderer2D = bench.Renderer2D;
+			settings.Renderer3D = bench.Renderer3D;
+
+			BenchResult result{};
+			result.Name		   = bench.Name;
+			result.EntityCount = bench.Setup(m_Scene);
+			result.FrameTimesMs.reserve(m_Settings.Frames);
+			m_Results.push_back(std::move(result));
+
+			YM_INFO("Bench - Running '{}' with {} entities for {} frames...", bench.Name, m_Results.back().EntityCount, m_Settings.Frames)
+		}
+
+		uint32_t SetupSprites(Scene* p_Scene)
+		{
+			std::mt19937 random(1337);
+			std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+			std::uniform_real_distribution<float> color(0.2f, 1.0f);
+
+			for (uint32_t i = 0; i < m_Settings.SpriteCount; i++)
+			{
+				auto entt = p_Scene->CreateEntity("Sprite");
+				entt.AddOrReplaceComponent<TransformComponent>(glm::vec3{ position(random), position(random), 0.0f });
+				entt.AddComponent<ShapeComponent>();
+
+				// Half of them textured so both quad paths are exercised
+				glm::vec4 tint = { color(random), color(random), color(random), 1.0f };
+				if (i % 2 == 0)
+					entt.AddComponent<SpriteComponent>(tint, m_SpriteTexture);
+				else
+					entt.AddComponent<SpriteComponent>(tint);
+			}
+
+			return m_Settings.SpriteCount;
+		}
+
+		uint32_t SetupModels(Scene* p_Scene)
+		{
+			uint32_t side = (uint32_t)std::ceil(std::sqrt((float)m_Settings.ModelCount));
+			float spacing = 3.0f;
+			float offset  = (float)(side - 1) * spacing * 0.5f;
+
+			for (uint32_t i = 0; i < m_Settings.ModelCount; i++)
+			{
+				auto entt = p_Scene->CreateEntity("Model");
+				entt.AddComponent<ModelComponent>(m_Model);
+
+				glm::vec3 translation = { (float)(i % side) * spacing - offset, 0.0f, (float)(i / side) * spacing - offset };
+				auto& tc = entt.AddOrReplaceComponent<TransformComponent>(translation);
+				tc.Transform.SetLocalRotation({ glm::radians(90.0f), 0.0f, 0.0f });
+			}
+
+			auto light = p_Scene->CreateEntity("DirectionalLight");
+			light.AddComponent<LightComponent>(LightType::Directional);
+
+			return m_Settings.ModelCount + 1;
+		}
+
+		uint32_t SetupLights(Scene* p_Scene)
+		{
+			// Same grid as "models", the difference is the light gathering and shading
+			uint32_t modelCount = SetupModels(p_Scene) - 1;
+
+			std::mt19937 random(7331);
+			std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+			std::uniform_real_distribution<float> color(0.2f, 1.0f);
+
+			for (uint32_t i = 0; i < m_Settings.LightCount; i++)
+			{
+				auto entt = p_Scene->CreateEntity("PointLight");
+				entt.AddComponent<LightComponent>(LightType::Point, glm::vec3{ color(random), color(random), color(random) });
+				entt.AddOrReplaceComponent<TransformComponent>(glm::vec3{ position(random), 2.0f, position(random) });
+			}
+
+			return modelCount + 1 + m_Settings.LightCount;
+		}
+
+		void WriteReport()
+		{
+			std::ofstream stream(m_Settings.Output, std::ios::out | std::ios::trunc);
+			if (!stream.is_open())
+			{
+				YM_ERROR("Bench - Could not open '{}'", m_Settings.Output)
+				return;
+			}
+
+			stream << "{\n";
+			stream << "\t\"width\": " << m_Settings.Width << ",\n";
+			stream << "\t\"height\": " << m_Settings.Height << ",\n";
+			stream << "\t\"warmup_frames\": " << m_Settings.WarmupFrames << ",\n";
+			stream << "\t\"scenes\": [";
+
+			bool first = true;
+			for (size_t i = 0; i < m_Results.size(); i++)
+			{
+				auto& result = m_Results[i];
+				auto& times	 = result.FrameTimesMs;
+				if (times.empty())
+					continue;
+
+				std::sort(times.begin(), times.end());
+
+				double sum = 0.0;
+				for (double time : times)
+					sum += time;
+
+				size_t p99Index = (size_t)std::ceil(0.99 * (double)times.size()) - 1;
+				double min		= times.front();
+				double avg		= sum / (double)times.size();
+				double p99		= times[std::min(p99Index, times.size() - 1)];
+
+				stream << (first ? "\n" : ",\n");
+				first = false;
+				stream << "\t\t{\n";
+				stream << "\t\t\t\"name\": \"" << result.Name << "\",\n";
+				stream << "\t\t\t\"entities\": " << result.EntityCount << ",\n";
+				stream << "\t\t\t\"draw_calls\": " << result.DrawCalls << ",\n";
+				stream << "\t\t\t\"visible_meshes\": " << result.VisibleMeshes << ",\n";
+				stream << "\t\t\t\"culled_meshes\": " << result.CulledMeshes << ",\n";
+				stream << "\t\t\t\"frames\": " << times.size() << ",\n";
+				stream << "\t\t\t\"cpu_frame_ms\": { \"min\": " << min << ", \"avg\": " << avg << ", \"p99\": " << p99 << ", \"max\": " << times.back() << " }\n";
+				stream << "\t\t}";
+
+				YM_INFO("Bench - {}: min {:.3f} ms, avg {:.3f} ms, p99 {:.3f} ms", result.Name, min, avg, p99)
+			}
+
+			stream << "\n\t]\n}\n";
+
+			YM_INFO("Bench - Report written to '{}'", m_Settings.Output)
+		}
+
+	private:
+		BenchSettings m_Settings;
+
+		std::vector<BenchScene> m_Scenes;
+		std::vector<BenchResult> m_Results;
+
+		Scene* m_Scene		 = nullptr;
+		uint32_t m_SceneIndex = 0;
+		uint32_t m_Frame	 = 0;
+		double m_LastTime	 = 0.0;
+
+		Ref<Model> m_Model;
+		Ref<Texture2D> m_SpriteTexture;
+	};
+
+
+	class Bench : public Application
+	{
+		public:
+			explicit Bench(const BenchSettings& p_Settings)
+				: Application(WindowProps("Bench", p_Settings.Width, p_Settings.Height, true /* Headless */))
+			{
+				PushLayer(new BenchLayer(p_Settings));
+			}
+
+			~Bench() override = default;
+	};
+}
+
+
+static uint32_t ParseCount(const char* p_Value, uint32_t p_Default)
+{
+	int value = std::atoi(p_Value);
+	return value > 0 ? (uint32_t)value : p_Default;
+}
+
+int main(int p_Argc, char** p_Argv)
+{
+	YUME::Log::Init();
+
+	YUME::BenchSettings settings{};
+	for (int i = 1; i + 1 < p_Argc; i += 2)
+	{
+		std::string arg = p_Argv[i];
+		const char* value = p_Argv[i + 1];
+
+		if		(arg == "--width")	 settings.Width		   = ParseCount(value, settings.Width);
+		else if (arg == "--height")	 settings.Height	   = ParseCount(value, settings.Height);
+		else if (arg == "--frames")	 settings.Frames	   = ParseCount(value, settings.Frames);
+		else if (arg == "--warmup")	 settings.WarmupFrames = (uint32_t)std::max(std::atoi(value), 0);
+		else if (arg == "--sprites") settings.SpriteCount  = ParseCount(value, settings.SpriteCount);
+		else if (arg == "--models")	 settings.ModelCount   = ParseCount(value, settings.ModelCount);
+		else if (arg == "--lights")	 settings.LightCount   = ParseCount(value, settings.LightCount);
+		else if (arg == "--output")	 settings.Output	   = value;
+		else
+		{
+			YM_WARN("Bench - Unknown argument '{}'", arg)
+		}
+	}
+
+	auto app = new YUME::Bench(settings);
+	app->Run();
+	delete app;
+}
@@ -46,10 +46,15 @@ namespace YUME
 			//	);
 			//}
 
-			auto sphere		   = CreateRef<Model>("Resources/Meshes/sphere.obj", true);
-			auto artisansHub   = CreateRef<Model>("Resources/Meshes/Spyro/ArtisansHub.obj", true);
-			auto damagedHelmet = CreateRef<Model>("Resources/Meshes/DamagedHelmet/DamagedHelmet.gltf");
-			auto scene		   = CreateRef<Model>("Resources/Meshes/Scene/scene.gltf");
+			Ref<Model> sphere, artisansHub, damagedHelmet, scene;
+			{
+				JobCounter counter;
+				JobSystem::Execute([&]() { sphere		 = CreateRef<Model>("Resources/Meshes/sphere.obj", true);					}, &counter);
+				JobSystem::Execute([&]() { artisansHub	 = CreateRef<Model>("Resources/Meshes/Spyro/ArtisansHub.obj", true);		}, &counter);
+				JobSystem::Execute([&]() { damagedHelmet = CreateRef<Model>("Resources/Meshes/DamagedHelmet/DamagedHelmet.gltf"); }, &counter);
+				JobSystem::Execute([&]() { scene		 = CreateRef<Model>("Resources/Meshes/Scene/scene.gltf");					}, &counter);
+				JobSystem::Wait(counter);
+			}
 
 			m_PointLight = m_Scene->CreateEntity("PointLight");
 			m_PointLight.AddComponent<LightComponent>(LightType::Point, m_PointLightColor);
@@ -189,8 +194,19 @@ namespace YUME
 			ImGui::Spacing();
 			ImGui::Text("RenderScene Elapsed: %0.3f ms", stats.RenderSceneTimeMs);
 			ImGui::Text("End Elapsed: %0.3f ms", stats.EndTimeMs);
+			ImGui::Text("Frame Time: %0.3f ms", stats.FrameTimeMs);
+			ImGui::Text("Frame Fence Wait: %0.3f ms", stats.FrameWaitTimeMs);
+			ImGui::Text("Frames In Flight: %i (frame %i)", stats.FramesInFlight, stats.FrameIndex);
 			ImGui::Spacing();
 			ImGui::Text("DrawCalls: %i", stats.DrawCalls);
+			ImGui::Text("Meshes: %i visible, %i culled", stats.VisibleMeshes, stats.CulledMeshes);
+			ImGui::Text("Shadow Meshes: %i visible, %i culled", stats.ShadowVisibleMeshes, stats.ShadowCulledMeshes);
+		#if defined(YM_PROFILE) && !defined(YM_PLATFORM_WINDOWS)
+			ImGui::Spacing();
+			ImGui::DragInt("Trace Frames", &m_TraceFrames, 1.0f, 1, 1000);
+			if (ImGui::Button(Profiler::IsCapturing() ? "Capturing..." : "Capture Trace"))
+				Profiler::BeginCapture("yume_trace.json", (uint32_t)m_TraceFrames);
+		#endif
 			ImGui::End();
 
 			ImGui::Begin("Editor");
@@ -238,6 +254,7 @@ namespace YUME
 		EditorCamera m_Camera{ 90.0f, 1.778f, 0.1f, 1000.0f};
 
 		Scene* m_Scene = nullptr;
+		int m_TraceFrames = 60;
 		uint32_t m_Width = 800, m_Height = 600;
 
 		glm::vec3 m_PointLightPosition{ 0.0f };
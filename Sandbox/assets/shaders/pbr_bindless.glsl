@@ -0,0 +1,39 @@
+// Shared by the bindless PBR shaders, included after pbr_fragment.glsl.
+// The includer enables GL_EXT_nonuniform_qualifier and defines MATERIAL_INDEX.
+
+struct GPUMaterial
+{
+	vec4   AlbedoColor;
+	uint   AlbedoTexture;
+	uint   NormalTexture;
+	uint   SpecularTexture;
+	uint   RoughnessTexture;
+	uint   MetallicTexture;
+	uint   AoTexture;
+	int    SpecularMap;
+	int    NormalMap;
+	float  AlphaCutOff;
+};
+layout(std430, set = 0, binding = 5) readonly buffer u_Materials
+{
+	GPUMaterial Materials[];
+} u_materials;
+
+layout(set = 1, binding = 0) uniform sampler2D u_Textures[];
+
+
+
+MaterialData GetMaterial()
+{
+	GPUMaterial material = u_materials.Materials[MATERIAL_INDEX];
+	return MaterialData(material.AlbedoColor, material.SpecularMap, material.NormalMap, material.AlphaCutOff);
+}
+
+#define BINDLESS_TEXTURE(p_Slot) u_Textures[nonuniformEXT(u_materials.Materials[MATERIAL_INDEX].p_Slot)]
+
+vec4  SampleAlbedo(vec2 p_TexCoord)	   { return texture(BINDLESS_TEXTURE(AlbedoTexture), p_TexCoord); }
+vec3  SampleNormal(vec2 p_TexCoord)	   { return texture(BINDLESS_TEXTURE(NormalTexture), p_TexCoord).xyz; }
+vec3  SampleSpecular(vec2 p_TexCoord)  { return texture(BINDLESS_TEXTURE(SpecularTexture), p_TexCoord).rgb; }
+float SampleRoughness(vec2 p_TexCoord) { return texture(BINDLESS_TEXTURE(RoughnessTexture), p_TexCoord).r; }
+float SampleMetallic(vec2 p_TexCoord)  { return texture(BINDLESS_TEXTURE(MetallicTexture), p_TexCoord).r; }
+float SampleAo(vec2 p_TexCoord)		   { return texture(BINDLESS_TEXTURE(AoTexture), p_TexCoord).r; }
@@ -0,0 +1,33 @@
+// Set = 0 -> Global
+// Set = 1 -> Bindless textures, shared by every material
+
+
+@type vertex
+#version 450 core
+
+layout(push_constant) uniform model
+{
+	uint InstanceOffset;
+	uint MaterialIndex;
+} Model;
+
+#include <pbr_vertex.glsl>
+
+uint GetInstanceOffset() { return Model.InstanceOffset; }
+
+
+@type fragment
+#version 450 core
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout(push_constant) uniform model
+{
+	uint InstanceOffset;
+	uint MaterialIndex;
+} Model;
+
+#define MATERIAL_INDEX Model.MaterialIndex
+
+
+#include <pbr_fragment.glsl>
+#include <pbr_bindless.glsl>
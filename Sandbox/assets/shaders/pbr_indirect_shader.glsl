@@ -0,0 +1,54 @@
+// Set = 0 -> Global
+// Set = 1 -> Bindless textures, shared by every material
+// Drawn with multi draw indirect, gl_DrawID selects the draw's instances and material
+
+
+@type vertex
+#version 450 core
+#extension GL_ARB_shader_draw_parameters : require
+
+layout(push_constant) uniform model
+{
+	uint DrawOffset; // gl_DrawID restarts at 0 on every indirect call
+} Model;
+
+struct DrawData
+{
+	uint InstanceOffset;
+	uint MaterialIndex;
+};
+layout(std430, set = 0, binding = 6) readonly buffer u_Draws
+{
+	DrawData Draws[];
+} u_draws;
+
+layout(location = 6) flat out uint v_MaterialIndex;
+
+#include <pbr_vertex.glsl>
+
+uint GetInstanceOffset()
+{
+	// gl_DrawID only exists in the vertex stage, the material index is passed on from here
+	DrawData draw	= u_draws.Draws[Model.DrawOffset + gl_DrawIDARB];
+	v_MaterialIndex = draw.MaterialIndex;
+
+	return draw.InstanceOffset;
+}
+
+
+@type fragment
+#version 450 core
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout(push_constant) uniform model
+{
+	uint DrawOffset;
+} Model;
+
+layout(location = 6) flat in uint v_MaterialIndex;
+
+#define MATERIAL_INDEX v_MaterialIndex
+
+
+#include <pbr_fragment.glsl>
+#include <pbr_bindless.glsl>
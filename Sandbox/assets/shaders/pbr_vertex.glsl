@@ -0,0 +1,62 @@
+// Shared by the PBR shaders, the includer implements GetInstanceOffset()
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_Normal; // Octahedral, see Mesh::EncodeOctahedral
+layout(location = 2) in vec2 a_TexCoord;
+layout(location = 3) in vec4 a_Color;
+
+struct VertexOutput
+{
+	vec3  WorldPos;
+	vec3  Normal;
+	vec2  TexCoord;
+	vec4  Color;
+	vec3  CameraPosition;
+	vec4  WorldPosLightSpace;
+};
+layout(location = 0) out VertexOutput Output;
+
+
+layout(set = 0, binding = 0) uniform u_Camera
+{
+	mat4 ViewProjection;
+	vec3 Position;
+} u_camera;
+
+layout(set = 0, binding = 1) uniform u_ShadowBuffer
+{
+	mat4 LightSpaceMatrix;
+} u_shadowBuffer;
+
+
+// One transform per instance, every draw reads [InstanceOffset, InstanceOffset + instanceCount)
+layout(std430, set = 0, binding = 4) readonly buffer u_Instances
+{
+	mat4 Transforms[];
+} u_instances;
+
+
+// First transform of the draw, called once at the start of main
+uint GetInstanceOffset();
+
+vec3 DecodeOctahedral(vec2 p_Encoded)
+{
+	vec3 n = vec3(p_Encoded, 1.0 - abs(p_Encoded.x) - abs(p_Encoded.y));
+	float t = max(-n.z, 0.0);
+	n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+	return normalize(n);
+}
+
+void main()
+{
+	mat4 transform = u_instances.Transforms[GetInstanceOffset() + gl_InstanceIndex];
+
+	Output.TexCoord = a_TexCoord;
+	Output.Color = a_Color;
+	Output.WorldPos = vec3(transform * vec4(a_Position, 1.0));
+	Output.Normal = DecodeOctahedral(a_Normal);
+	Output.CameraPosition = u_camera.Position;
+	Output.WorldPosLightSpace = (u_shadowBuffer.LightSpaceMatrix * transform) * vec4(a_Position, 1.0);
+
+	gl_Position = u_camera.ViewProjection * vec4(Output.WorldPos, 1.0);
+}
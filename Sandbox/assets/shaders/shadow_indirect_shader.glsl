@@ -0,0 +1,63 @@
+// Drawn with multi draw indirect, gl_DrawID selects the draw's instances
+
+
+@type vertex
+#version 450 core
+#extension GL_ARB_shader_draw_parameters : require
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_Normal;
+layout(location = 2) in vec2 a_TexCoord;
+layout(location = 3) in vec4 a_Color;
+
+layout(set = 0, binding = 0) uniform u_LightBuffer
+{
+	mat4 LightSpaceMatrix;
+} u_lightBuffer;
+
+layout(std430, set = 0, binding = 1) readonly buffer u_Instances
+{
+	mat4 Transforms[];
+} u_instances;
+
+struct DrawData
+{
+	uint InstanceOffset;
+	uint MaterialIndex;
+};
+layout(std430, set = 0, binding = 2) readonly buffer u_Draws
+{
+	DrawData Draws[];
+} u_draws;
+
+layout(push_constant) uniform model
+{
+	uint DrawOffset; // gl_DrawID restarts at 0 on every indirect call
+} Model;
+
+
+out gl_PerVertex 
+{
+    vec4 gl_Position;   
+};
+
+void main()
+{
+    uint instanceOffset = u_draws.Draws[Model.DrawOffset + gl_DrawIDARB].InstanceOffset;
+    mat4 transform = u_instances.Transforms[instanceOffset + gl_InstanceIndex];
+    gl_Position = u_lightBuffer.LightSpaceMatrix * transform * vec4(a_Position, 1.0);
+}
+
+@type fragment
+#version 450 core
+
+layout(push_constant) uniform model
+{
+	uint DrawOffset;
+} Model;
+
+
+
+void main()
+{
+}
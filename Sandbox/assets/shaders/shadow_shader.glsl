@@ -2,7 +2,7 @@
 #version 450 core
 
 layout(location = 0) in vec3 a_Position;
-layout(location = 1) in vec3 a_Normal;
+layout(location = 1) in vec2 a_Normal;
 layout(location = 2) in vec2 a_TexCoord;
 layout(location = 3) in vec4 a_Color;
 
@@ -11,9 +11,14 @@ layout(set = 0, binding = 0) uniform u_LightBuffer
 	mat4 LightSpaceMatrix;
 } u_lightBuffer;
 
+layout(std430, set = 0, binding = 1) readonly buffer u_Instances
+{
+	mat4 Transforms[];
+} u_instances;
+
 layout(push_constant) uniform model
 {
-	mat4 Transform;
+	uint InstanceOffset;
 } Model;
 
 
@@ -24,7 +29,8 @@ out gl_PerVertex
 
 void main()
 {
-    gl_Position = u_lightBuffer.LightSpaceMatrix * Model.Transform * vec4(a_Position, 1.0);
+    mat4 transform = u_instances.Transforms[Model.InstanceOffset + gl_InstanceIndex];
+    gl_Position = u_lightBuffer.LightSpaceMatrix * transform * vec4(a_Position, 1.0);
 }
 
 @type fragment
@@ -32,7 +38,7 @@ void main()
 
 layout(push_constant) uniform model
 {
-	mat4 Transform;
+	uint InstanceOffset;
 } Model;
 
 
@@ -6,7 +6,7 @@
 #version 450 core
 
 layout(location = 0) in vec3 a_Position;
-layout(location = 1) in vec3 a_Normal;
+layout(location = 1) in vec2 a_Normal;
 layout(location = 2) in vec2 a_TexCoord;
 layout(location = 3) in vec4 a_Color;
 
@@ -6,6 +6,7 @@
 #include "vulkan_device.h"
 #include <Platform/Vulkan/Renderer/vulkan_renderpass.h>
 #include <Platform/Vulkan/Renderer/vulkan_framebuffer.h>
+#include <Platform/Vulkan/Renderer/vulkan_pipeline.h>
 
 
 
@@ -71,8 +72,12 @@ namespace YUME
 		auto res					 = vkAllocateCommandBuffers(VulkanDevice::Get().GetDevice(), &allocInfo, &m_CommandBuffer);
 		YM_CORE_VERIFY(res == VK_SUCCESS)
 
-		m_Semaphore					 = CreateRef<VulkanSemaphore>(SemaphoreType::None);
-		m_Fence						 = CreateRef<VulkanFence>(true);
+		// Secondaries are never submitted on their own
+		if (p_Level == RecordingLevel::PRIMARY)
+		{
+			m_Semaphore				 = CreateRef<VulkanSemaphore>(SemaphoreType::None);
+			m_Fence					 = CreateRef<VulkanFence>(true);
+		}
 
 		if (!m_DebugName.empty())
 			VKUtils::SetDebugUtilsObjectName(VulkanDevice::Get().GetDevice(), VK_OBJECT_TYPE_COMMAND_BUFFER, m_DebugName.c_str(), m_CommandBuffer);
@@ -117,6 +122,9 @@ namespace YUME
 
 		auto res = vkBeginCommandBuffer(m_CommandBuffer, &beginCreateInfo);
 		YM_CORE_ASSERT(res == VK_SUCCESS)
+
+		// Nothing is inherited besides the render pass
+		p_Pipeline.As<VulkanPipeline>()->Bind(this);
 	}
 
 	void VulkanCommandBuffer::End()
@@ -128,21 +136,21 @@ namespace YUME
 		m_State = CommandBufferState::Ended;
 	}
 
-	bool VulkanCommandBuffer::Execute(VkPipelineStageFlags p_Flags, VkSemaphore p_WaitSemaphore, bool p_WaitFence)
+	bool VulkanCommandBuffer::Execute(VkPipelineStageFlags p_Flags, VkSemaphore p_WaitSemaphore, bool p_WaitFence, bool p_SignalSemaphore)
 	{
 		YM_PROFILE_FUNCTION()
 		YM_CORE_ASSERT(m_Level == RecordingLevel::PRIMARY, "Used Execute on secondary command buffer!");
 		YM_CORE_ASSERT(m_State == CommandBufferState::Ended, "CommandBuffer executed before ended recording");
 
 		uint32_t waitSemaphoreCount		= p_WaitSemaphore ? 1 : 0;
-		uint32_t signalSemaphoreCount	= m_Semaphore ? 1 : 0;
+		uint32_t signalSemaphoreCount	= m_Semaphore && p_SignalSemaphore ? 1 : 0;
 		VkSemaphore semaphore			= m_Semaphore ? m_Semaphore->GetHandle() : VK_NULL_HANDLE;
 
 		VkSubmitInfo submitInfo{};
 		submitInfo.sType				= VK_STRUCTURE_TYPE_SUBMIT_INFO;
 		submitInfo.pNext				= VK_NULL_HANDLE;
-		submitInfo.waitSemaphoreCount   = 0;
-		submitInfo.pWaitSemaphores		= nullptr;
+		submitInfo.waitSemaphoreCount   = waitSemaphoreCount;
+		submitInfo.pWaitSemaphores		= &p_WaitSemaphore;
 		submitInfo.pWaitDstStageMask	= &p_Flags;
 		submitInfo.commandBufferCount	= 1;
 		submitInfo.pCommandBuffers		= &m_CommandBuffer;
@@ -179,12 +187,12 @@ namespace YUME
 	void VulkanCommandBuffer::Reset()
 	{
 		YM_PROFILE_FUNCTION()
-		VKUtils::WaitIdle();
 
-		if (m_State == CommandBufferState::Submitted)
+		if (m_State == CommandBufferState::Submitted && m_Level == RecordingLevel::PRIMARY)
 			Wait();
 
 		vkResetCommandBuffer(m_CommandBuffer, 0);
+		m_State = CommandBufferState::Idle;
 	}
 
 	bool VulkanCommandBuffer::Flush()
@@ -216,9 +224,8 @@ namespace YUME
 	void VulkanCommandBuffer::Free()
 	{
 		YM_PROFILE_FUNCTION()
-		VKUtils::WaitIdle();
 
-		if (m_State == CommandBufferState::Submitted)
+		if (m_State == CommandBufferState::Submitted && m_Level == RecordingLevel::PRIMARY)
 			Wait();
 
 		m_Fence = nullptr;
@@ -25,7 +25,8 @@ namespace YUME
 			void BeginSecondary(const Ref<Pipeline>& p_Pipeline) override;
 			void End() override;
 
-			bool Execute(VkPipelineStageFlags p_Flags, VkSemaphore p_WaitSemaphore, bool p_WaitFence = false);
+			// p_SignalSemaphore = false when nothing will wait on GetSemaphore(), e.g. headless frames that are never presented
+			bool Execute(VkPipelineStageFlags p_Flags, VkSemaphore p_WaitSemaphore, bool p_WaitFence = false, bool p_SignalSemaphore = true);
 			void ExecuteSecondary(CommandBuffer* p_PrimaryCMD) override;
 			void Submit() override;
 
@@ -32,10 +32,10 @@ namespace YUME
 		vkDestroyCommandPool(VulkanDevice::Get().GetDevice(), m_Handle, nullptr);
 	}
 
-	void VulkanCommandPool::Reset()
+	void VulkanCommandPool::Reset(bool p_ReleaseResources)
 	{
 		YM_PROFILE_FUNCTION()
 
-		vkResetCommandPool(VulkanDevice::Get().GetDevice(), m_Handle, VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT);
+		vkResetCommandPool(VulkanDevice::Get().GetDevice(), m_Handle, p_ReleaseResources ? VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT : 0);
 	}
 }
\ No newline at end of file
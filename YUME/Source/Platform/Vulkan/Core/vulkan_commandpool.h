@@ -14,7 +14,8 @@ namespace YUME
             VulkanCommandPool(uint32_t p_QueueIndex, VkCommandPoolCreateFlags p_Flags, const std::string& p_DebugName = "VkCommandPool");
             ~VulkanCommandPool();
 
-            void Reset();
+            // Keeping the resources is cheaper for pools that are recorded into again every frame
+            void Reset(bool p_ReleaseResources = true);
 
             const VkCommandPool& GetHandle() const { return m_Handle; }
 
@@ -6,7 +6,7 @@
 
 namespace YUME
 {
-	void VulkanDescriptorPool::Init(uint32_t p_MaxSets, VkDescriptorPoolCreateFlags p_Flags)
+	bool VulkanDescriptorPool::Init(uint32_t p_MaxSets, VkDescriptorPoolCreateFlags p_Flags, const std::vector<VkDescriptorPoolSize>& p_PoolSizes)
 	{
 		YM_PROFILE_FUNCTION()
 
@@ -19,9 +19,9 @@ namespace YUME
 			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, p_MaxSets },
 			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, p_MaxSets },
 			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, p_MaxSets },
-			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, p_MaxSets * 2 },
+			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, p_MaxSets },
 			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, p_MaxSets * 2 },
-			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, p_MaxSets },
+			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, p_MaxSets * 2 },
 			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, p_MaxSets },
 			VkDescriptorPoolSize { VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, p_MaxSets / 2 }
 		};
@@ -32,9 +32,22 @@ namespace YUME
 		poolCreateInfo.flags = p_Flags;
 		poolCreateInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
 		poolCreateInfo.pPoolSizes = poolSizes.data();
+		if (!p_PoolSizes.empty())
+		{
+			poolCreateInfo.poolSizeCount = static_cast<uint32_t>(p_PoolSizes.size());
+			poolCreateInfo.pPoolSizes = p_PoolSizes.data();
+		}
 		poolCreateInfo.maxSets = p_MaxSets;
 
-		vkCreateDescriptorPool(VulkanDevice::Get().GetDevice(), &poolCreateInfo, VK_NULL_HANDLE, &m_Handle);
+		auto res = vkCreateDescriptorPool(VulkanDevice::Get().GetDevice(), &poolCreateInfo, VK_NULL_HANDLE, &m_Handle);
+		if (res != VK_SUCCESS)
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "Failed to create descriptor pool!")
+			m_Handle = VK_NULL_HANDLE;
+			return false;
+		}
+
+		return true;
 	}
 
 	void VulkanDescriptorPool::Reset()
@@ -50,5 +63,140 @@ namespace YUME
 
 		YM_CORE_TRACE(VULKAN_PREFIX "Destroying descriptor pool...")
 		vkDestroyDescriptorPool(VulkanDevice::Get().GetDevice(), m_Handle, VK_NULL_HANDLE);
+		m_Handle = VK_NULL_HANDLE;
+	}
+
+
+	void VulkanDescriptorAllocator::Init(uint32_t p_SetsPerPool, uint32_t p_MaxSetsPerPool, VkDescriptorPoolCreateFlags p_Flags, const std::vector<VkDescriptorPoolSize>& p_PoolSizes)
+	{
+		YM_PROFILE_FUNCTION()
+
+		m_SetsPerPool	 = std::max(p_SetsPerPool, 1u);
+		m_MaxSetsPerPool = std::max(p_MaxSetsPerPool, m_SetsPerPool);
+		m_NextSetCount	 = m_SetsPerPool;
+		m_Flags			 = p_Flags;
+		m_PoolSizes		 = p_PoolSizes;
+
+		CreatePool();
+	}
+
+	VkDescriptorPool VulkanDescriptorAllocator::Allocate(VkDescriptorSetLayout p_Layout, VkDescriptorSet& p_Set)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		// Pools behind the current one are full, unless sets can be freed
+		uint32_t count	= (uint32_t)m_Pools.size();
+		bool canFree	= m_Flags & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+		uint32_t tries	= canFree ? count : count - std::min(m_Current, count);
+
+		for (uint32_t i = 0; i < tries; i++)
+		{
+			uint32_t index	 = (m_Current + i) % count;
+			bool outOfMemory = false;
+			if (TryAllocate(index, p_Layout, p_Set, outOfMemory))
+			{
+				m_Current = index;
+				return m_Pools[index]->Get();
+			}
+
+			if (!outOfMemory)
+				return VK_NULL_HANDLE;
+		}
+
+		if (!CreatePool())
+			return VK_NULL_HANDLE;
+
+		m_Current		 = (uint32_t)m_Pools.size() - 1;
+		bool outOfMemory = false;
+		if (!TryAllocate(m_Current, p_Layout, p_Set, outOfMemory))
+			return VK_NULL_HANDLE;
+
+		return m_Pools[m_Current]->Get();
+	}
+
+	void VulkanDescriptorAllocator::Free(VkDescriptorPool p_Pool, VkDescriptorSet p_Set)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_ASSERT(m_Flags & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, "Sets of this allocator are only released by Reset()")
+
+		if (p_Pool == VK_NULL_HANDLE || p_Set == VK_NULL_HANDLE)
+			return;
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		vkFreeDescriptorSets(VulkanDevice::Get().GetDevice(), p_Pool, 1, &p_Set);
+	}
+
+	void VulkanDescriptorAllocator::Reset()
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		for (auto& pool : m_Pools)
+			pool->Reset();
+
+		m_Current = 0;
+		m_ResetCount++;
+	}
+
+	void VulkanDescriptorAllocator::Destroy()
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		for (auto& pool : m_Pools)
+			pool->Destroy();
+
+		m_Pools.clear();
+		m_Current = 0;
+		m_ResetCount++;
+	}
+
+	bool VulkanDescriptorAllocator::TryAllocate(uint32_t p_Pool, VkDescriptorSetLayout p_Layout, VkDescriptorSet& p_Set, bool& p_OutOfMemory)
+	{
+		VkDescriptorSetAllocateInfo allocInfo = {};
+		allocInfo.sType				 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocInfo.descriptorPool	 = m_Pools[p_Pool]->Get();
+		allocInfo.descriptorSetCount = 1;
+		allocInfo.pSetLayouts		 = &p_Layout;
+
+		auto res = vkAllocateDescriptorSets(VulkanDevice::Get().GetDevice(), &allocInfo, &p_Set);
+		if (res == VK_SUCCESS)
+			return true;
+
+		p_Set		  = VK_NULL_HANDLE;
+		p_OutOfMemory = res == VK_ERROR_OUT_OF_POOL_MEMORY || res == VK_ERROR_FRAGMENTED_POOL;
+		if (!p_OutOfMemory)
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "Failed to allocate descriptor set!")
+		}
+
+		return false;
+	}
+
+	bool VulkanDescriptorAllocator::CreatePool()
+	{
+		uint32_t sets = m_NextSetCount;
+		m_NextSetCount = std::min(m_NextSetCount * 2, m_MaxSetsPerPool);
+
+		std::vector<VkDescriptorPoolSize> poolSizes = m_PoolSizes;
+		for (auto& size : poolSizes)
+			size.descriptorCount = (uint32_t)((uint64_t)size.descriptorCount * sets / m_SetsPerPool);
+
+		auto pool = CreateUnique<VulkanDescriptorPool>();
+		if (!pool->Init(sets, m_Flags, poolSizes))
+			return false;
+
+		if (!m_Pools.empty())
+		{
+			YM_CORE_TRACE(VULKAN_PREFIX "Descriptor allocator grew to {} pools", m_Pools.size() + 1)
+		}
+
+		m_Pools.push_back(std::move(pool));
+		return true;
 	}
 }
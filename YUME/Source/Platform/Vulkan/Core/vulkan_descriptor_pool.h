@@ -4,6 +4,10 @@
 // Lib
 #include <vulkan/vulkan.h>
 
+// std
+#include <mutex>
+#include <vector>
+
 
 
 namespace YUME
@@ -14,7 +18,8 @@ namespace YUME
 			VulkanDescriptorPool() = default;
 			~VulkanDescriptorPool() = default;
 
-			void Init(uint32_t p_MaxSets, VkDescriptorPoolCreateFlags p_Flags);
+			// Without p_PoolSizes every descriptor type gets a share based on p_MaxSets
+			bool Init(uint32_t p_MaxSets, VkDescriptorPoolCreateFlags p_Flags, const std::vector<VkDescriptorPoolSize>& p_PoolSizes = {});
 
 			void Reset();
 
@@ -27,6 +32,50 @@ namespace YUME
 			explicit operator const VkDescriptorPool& () const { return m_Handle; }
 
 		private:
-			VkDescriptorPool m_Handle;
+			VkDescriptorPool m_Handle = VK_NULL_HANDLE;
+	};
+
+	// Chain of pools that grows when the current one runs out instead of failing the allocation.
+	// Pools created with VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT give their sets back one by one,
+	// the others are only recycled all at once by Reset().
+	class VulkanDescriptorAllocator
+	{
+		public:
+			VulkanDescriptorAllocator() = default;
+			~VulkanDescriptorAllocator() = default;
+
+			// Every new pool doubles the set count up to p_MaxSetsPerPool, p_PoolSizes are the counts for p_SetsPerPool sets
+			void Init(uint32_t p_SetsPerPool, uint32_t p_MaxSetsPerPool, VkDescriptorPoolCreateFlags p_Flags, const std::vector<VkDescriptorPoolSize>& p_PoolSizes = {});
+
+			// Returns the pool the set came from, it is needed to free it. VK_NULL_HANDLE on failure.
+			VkDescriptorPool Allocate(VkDescriptorSetLayout p_Layout, VkDescriptorSet& p_Set);
+			void Free(VkDescriptorPool p_Pool, VkDescriptorSet p_Set);
+
+			// Every set allocated so far becomes invalid, the pools are kept for the next allocations
+			void Reset();
+			void Destroy();
+
+			// Incremented by Reset(), sets allocated before the current count are gone
+			uint64_t GetResetCount() const { return m_ResetCount; }
+			uint32_t GetPoolCount() const { return (uint32_t)m_Pools.size(); }
+
+		private:
+			bool TryAllocate(uint32_t p_Pool, VkDescriptorSetLayout p_Layout, VkDescriptorSet& p_Set, bool& p_OutOfMemory);
+			bool CreatePool();
+
+		private:
+			std::vector<Unique<VulkanDescriptorPool>> m_Pools;
+			uint32_t m_Current = 0;
+
+			uint32_t m_SetsPerPool	  = 0;
+			uint32_t m_MaxSetsPerPool = 0;
+			uint32_t m_NextSetCount	  = 0;
+			VkDescriptorPoolCreateFlags m_Flags = 0;
+			std::vector<VkDescriptorPoolSize> m_PoolSizes;
+
+			uint64_t m_ResetCount = 0;
+
+			// Persistent sets can be created and released from loader threads
+			std::mutex m_Mutex;
 	};
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "YUME/yumepch.h"
 #include "vulkan_device.h"
 #include "YUME/Utils/utils.h"
+#include "YUME/Core/definitions.h"
 #include "Platform/Vulkan/Renderer/vulkan_context.h"
 
 
@@ -75,6 +76,44 @@ namespace YUME
 
 			vkGetPhysicalDeviceFeatures(device, &m_PhysicalDevices[i].Features);
 
+			VkPhysicalDeviceShaderDrawParametersFeatures drawParametersFeatures{};
+			drawParametersFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES;
+
+			VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{};
+			indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+			indexingFeatures.pNext = &drawParametersFeatures;
+
+			VkPhysicalDeviceFeatures2 features2{};
+			features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			features2.pNext = &indexingFeatures;
+			vkGetPhysicalDeviceFeatures2(device, &features2);
+
+			VkPhysicalDeviceDescriptorIndexingProperties indexingProperties{};
+			indexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
+
+			VkPhysicalDeviceProperties2 properties2{};
+			properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+			properties2.pNext = &indexingProperties;
+			vkGetPhysicalDeviceProperties2(device, &properties2);
+
+			m_PhysicalDevices[i].SupportBindless = indexingFeatures.runtimeDescriptorArray == VK_TRUE &&
+				indexingFeatures.shaderSampledImageArrayNonUniformIndexing == VK_TRUE &&
+				indexingFeatures.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE &&
+				indexingFeatures.descriptorBindingPartiallyBound == VK_TRUE &&
+				indexingFeatures.descriptorBindingUpdateUnusedWhilePending == VK_TRUE;
+
+			m_PhysicalDevices[i].MaxBindlessTextures = std::min({
+				DESCRIPTOR_MAX_BINDLESS_TEXTURES,
+				indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages,
+				indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+				indexingProperties.maxPerStageUpdateAfterBindResources
+			});
+
+			// gl_DrawID is how the indirect shaders find their per draw data
+			m_PhysicalDevices[i].SupportMultiDrawIndirect = m_PhysicalDevices[i].Features.multiDrawIndirect == VK_TRUE &&
+				drawParametersFeatures.shaderDrawParameters == VK_TRUE;
+			m_PhysicalDevices[i].MaxDrawIndirectCount = m_PhysicalDevices[i].Properties.limits.maxDrawIndirectCount;
+
 			uint32_t familyPropsCount = 0;
 			vkGetPhysicalDeviceQueueFamilyProperties(device, &familyPropsCount, nullptr);
 
@@ -113,7 +152,13 @@ namespace YUME
 					physDevice.SupportCompute = true;
 				}
 				
-				if (familyProps.queueFlags & VK_QUEUE_TRANSFER_BIT)
+				// Prefer a dedicated transfer family so uploads don't compete with the graphics queue
+				bool dedicatedTransfer = !(familyProps.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
+				auto transferIndex = m_PhysicalDevices[i].Indices.Transfer;
+				bool hasDedicatedTransfer = transferIndex != -1 &&
+					!(m_PhysicalDevices[i].FamilyProperties[transferIndex].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
+
+				if ((familyProps.queueFlags & VK_QUEUE_TRANSFER_BIT) && (transferIndex == -1 || (dedicatedTransfer && !hasDedicatedTransfer)))
 				{
 					m_PhysicalDevices[i].Indices.Transfer = j;
 
@@ -157,7 +202,7 @@ namespace YUME
 	{
 		for (const auto& extension : m_PhysicalDevices[m_SelectedIndex].SupportedExtensions)
 		{
-			if (strcmp(p_Extension, extension.extensionName))
+			if (strcmp(p_Extension, extension.extensionName) == 0)
 				return true;
 		}
 
@@ -282,7 +327,10 @@ namespace YUME
 		YM_PROFILE_FUNCTION()
 
 		m_CommandPool.reset();
-		m_DescriptorPool->Destroy();
+		m_DescriptorAllocator->Destroy();
+		if (m_BindlessDescriptorAllocator)
+			m_BindlessDescriptorAllocator->Destroy();
+		m_SamplerCache->Destroy();
 
 		{
 			YM_CORE_TRACE(VULKAN_PREFIX "Saving pipeline cache...")
@@ -333,6 +381,9 @@ namespace YUME
 		YM_CORE_TRACE(VULKAN_PREFIX "Checking device extensions...")
 		for (auto ext : devExts)
 		{
+			if (VulkanContext::IsHeadless() && strcmp(ext, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0)
+				continue;
+
 			if (m_PhysicalDevice->IsExtensionSupported(ext)) 
 			{
 				YM_CORE_INFO(VULKAN_PREFIX "Device extension {} founded!", ext)
@@ -354,17 +405,39 @@ namespace YUME
 		physFeatures.geometryShader		= physDevice.Features.geometryShader;
 		physFeatures.tessellationShader = physDevice.Features.tessellationShader;
 		physFeatures.samplerAnisotropy  = physDevice.Features.samplerAnisotropy;
+		physFeatures.textureCompressionBC = physDevice.Features.textureCompressionBC;
 		physFeatures.wideLines			= physDevice.Features.wideLines;
 		physFeatures.fillModeNonSolid	= physDevice.Features.fillModeNonSolid;
 		physFeatures.independentBlend	= VK_TRUE;
 		physFeatures.depthBiasClamp		= VK_TRUE;
 		physFeatures.depthClamp			= VK_TRUE;
+		physFeatures.multiDrawIndirect	= physDevice.SupportMultiDrawIndirect;
 
 		auto queueCreateInfos = ConsolidateQueueCreateInfos(physDevice.QueueCreateInfos);
 
 
+		VkPhysicalDeviceTimelineSemaphoreFeatures timelineSemaphoreFeatures{};
+		timelineSemaphoreFeatures.sType				 = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+		timelineSemaphoreFeatures.timelineSemaphore	 = VK_TRUE;
+
+		VkPhysicalDeviceShaderDrawParametersFeatures drawParametersFeatures{};
+		drawParametersFeatures.sType				 = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES;
+		drawParametersFeatures.pNext				 = &timelineSemaphoreFeatures;
+		drawParametersFeatures.shaderDrawParameters	 = physDevice.SupportMultiDrawIndirect;
+
+		// Only what the bindless texture array uses, enabled when the whole set is available
+		VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{};
+		indexingFeatures.sType										 = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+		indexingFeatures.pNext										 = &drawParametersFeatures;
+		indexingFeatures.runtimeDescriptorArray						 = physDevice.SupportBindless;
+		indexingFeatures.shaderSampledImageArrayNonUniformIndexing	 = physDevice.SupportBindless;
+		indexingFeatures.descriptorBindingSampledImageUpdateAfterBind = physDevice.SupportBindless;
+		indexingFeatures.descriptorBindingPartiallyBound			 = physDevice.SupportBindless;
+		indexingFeatures.descriptorBindingUpdateUnusedWhilePending	 = physDevice.SupportBindless;
+
 		VkPhysicalDeviceCustomBorderColorFeaturesEXT customBorderColorFeatures{};
 		customBorderColorFeatures.sType				 = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT;
+		customBorderColorFeatures.pNext				 = &indexingFeatures;
 		customBorderColorFeatures.customBorderColors = VK_TRUE;
 
 		VkDeviceCreateInfo deviceCreateInfo			 = {};
@@ -428,8 +501,21 @@ namespace YUME
 #endif
 
 		m_CommandPool								 = CreateRef<VulkanCommandPool>(physDevice.Indices.Graphics, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
-		m_DescriptorPool							 = CreateRef<VulkanDescriptorPool>();
-		m_DescriptorPool->Init(100, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
+		m_DescriptorAllocator						 = CreateRef<VulkanDescriptorAllocator>();
+		m_DescriptorAllocator->Init(128, 1024, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
+
+		m_SamplerCache								 = CreateUnique<VulkanSamplerCache>();
+
+		if (physDevice.SupportBindless)
+		{
+			YM_CORE_INFO(VULKAN_PREFIX "Bindless textures supported, {} slots", physDevice.MaxBindlessTextures)
+
+			// Each set holds the whole texture table, so these pools never get bigger, only more of them
+			m_BindlessDescriptorAllocator			 = CreateRef<VulkanDescriptorAllocator>();
+			m_BindlessDescriptorAllocator->Init(4, 4, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT | VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT, {
+				VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, physDevice.MaxBindlessTextures * 4 }
+			});
+		}
 
 		Utils::CreateDirectoryIfNeeded(m_PipelineCacheDir);
 
@@ -6,6 +6,7 @@
 #include "YUME/Core/singleton.h"
 #include "vulkan_commandpool.h"
 #include "vulkan_descriptor_pool.h"
+#include "vulkan_sampler_cache.h"
 
 
 #include <vulkan/vulkan.h>
@@ -48,6 +49,14 @@ namespace YUME
 		PhysicalDeviceInfo Info;
 		QueueFamilyIndices Indices;
 		bool SupportCompute = false;
+
+		// Descriptor indexing subset needed by the bindless texture array
+		bool SupportBindless = false;
+		uint32_t MaxBindlessTextures = 0;
+
+		// multiDrawIndirect plus shaderDrawParameters for gl_DrawID
+		bool SupportMultiDrawIndirect = false;
+		uint32_t MaxDrawIndirectCount = 1;
 	};
 
 
@@ -91,6 +100,10 @@ namespace YUME
 			const VkPhysicalDeviceFeatures& GetFeatures() const { return m_PhysicalDevice->Selected().Features; }
 			const QueueFamilyIndices& GetQueueFamilyIndices() const { return m_PhysicalDevice->Selected().Indices; }
 			bool SupportCompute() const { return m_PhysicalDevice->Selected().SupportCompute; }
+			bool SupportBindless() const { return m_PhysicalDevice->Selected().SupportBindless; }
+			uint32_t GetMaxBindlessTextures() const { return m_PhysicalDevice->Selected().MaxBindlessTextures; }
+			bool SupportMultiDrawIndirect() const { return m_PhysicalDevice->Selected().SupportMultiDrawIndirect; }
+			uint32_t GetMaxDrawIndirectCount() const { return m_PhysicalDevice->Selected().MaxDrawIndirectCount; }
 
 			uint32_t FindMemoryType(uint32_t p_TypeFilter, VkMemoryPropertyFlags p_Properties) const { return m_PhysicalDevice->FindMemoryType(p_TypeFilter, p_Properties); }
 
@@ -103,8 +116,11 @@ namespace YUME
 			VkQueue& GetComputeQueue() { return m_ComputeQueue; }
 
 			VkCommandPool GetCommandPool() { return m_CommandPool->GetHandle(); }
-			VkDescriptorPool GetDescriptorPool() { return m_DescriptorPool->Get(); }
-			void ResetDescriptorPool() { m_DescriptorPool->Reset(); }
+			// Persistent sets, freed one by one when they are destroyed
+			VulkanDescriptorAllocator* GetDescriptorAllocator() { return m_DescriptorAllocator.get(); }
+			// UPDATE_AFTER_BIND pools, only created when the device supports bindless
+			VulkanDescriptorAllocator* GetBindlessDescriptorAllocator() { return m_BindlessDescriptorAllocator.get(); }
+			VulkanSamplerCache& GetSamplerCache() { return *m_SamplerCache; }
 			void ResetCommandPool() { m_CommandPool->Reset(); }
 
 		#ifdef USE_VMA_ALLOCATOR
@@ -131,7 +147,9 @@ namespace YUME
 			VkQueue m_ComputeQueue;
 
 			Ref<VulkanCommandPool> m_CommandPool;
-			Ref<VulkanDescriptorPool> m_DescriptorPool;
+			Ref<VulkanDescriptorAllocator> m_DescriptorAllocator;
+			Ref<VulkanDescriptorAllocator> m_BindlessDescriptorAllocator;
+			Unique<VulkanSamplerCache> m_SamplerCache;
 
 		#ifdef USE_VMA_ALLOCATOR
 			VmaAllocator m_Allocator = VK_NULL_HANDLE;
@@ -92,17 +92,14 @@ namespace YUME
 
 #ifdef USE_VMA_ALLOCATOR
 		auto alloc = m_Allocation;
-		VulkanContext::PushFunction([device, buffer, alloc]()
+		VulkanContext::PushFunction([buffer, alloc]()
 		{
-			vkDeviceWaitIdle(device);
 			vmaDestroyBuffer(VulkanDevice::Get().GetAllocator(), buffer, alloc);
 		});
 #else
 		auto memory = m_Memory;
 		VulkanContext::PushFunction([device, buffer, memory]()
 		{
-			vkDeviceWaitIdle(device);
-
 			if (buffer != VK_NULL_HANDLE)
 				vkDestroyBuffer(device, buffer, VK_NULL_HANDLE);
 			if (memory != VK_NULL_HANDLE)
@@ -0,0 +1,107 @@
+#include "YUME/yumepch.h"
+#include "vulkan_ring_buffer.h"
+#include "vulkan_device.h"
+
+
+
+
+namespace YUME
+{
+	VulkanRingBuffer::~VulkanRingBuffer()
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_TRACE(VULKAN_PREFIX "Destroying ring buffer...")
+
+		for (auto& region : m_Regions)
+		{
+			if (!region.Buffer)
+				continue;
+
+			region.Buffer->UnMap();
+			region.Buffer->SetDeleteWithoutQueue(true);
+			region.Buffer.reset();
+		}
+	}
+
+	void VulkanRingBuffer::Init(VkDeviceSize p_FrameSizeBytes)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_FrameSizeBytes > 0)
+
+		m_FrameSizeBytes = p_FrameSizeBytes;
+
+		const auto& limits = VulkanDevice::Get().GetPhysicalDeviceStruct().Properties.limits;
+		m_MinAlignment = std::max({ m_MinAlignment, limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment });
+	}
+
+	void VulkanRingBuffer::BeginFrame(uint32_t p_FrameIndex)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_ASSERT(p_FrameIndex < MAX_FRAMES_IN_FLIGHT)
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		m_CurrentRegion = p_FrameIndex;
+		m_Regions[m_CurrentRegion].Head = 0;
+		m_FrameCount++;
+	}
+
+	VulkanRingAllocation VulkanRingBuffer::Allocate(VkDeviceSize p_SizeBytes, VkDeviceSize p_Alignment)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_SizeBytes > 0)
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		auto& region = m_Regions[m_CurrentRegion];
+		if (!region.Buffer)
+		{
+			CreateRegion(region, std::max(m_FrameSizeBytes, p_SizeBytes));
+		}
+
+		VkDeviceSize alignment = std::max(p_Alignment, m_MinAlignment);
+		VkDeviceSize offset	   = (region.Head + alignment - 1) & ~(alignment - 1);
+
+		if (offset + p_SizeBytes > region.SizeBytes)
+		{
+			// Allocations already handed out this frame keep the old buffer alive until the frame's fence signals
+			VkDeviceSize newSize = std::max(region.SizeBytes * 2, p_SizeBytes);
+			YM_CORE_WARN(VULKAN_PREFIX "Ring buffer region {} is full, growing to {} bytes", m_CurrentRegion, newSize)
+
+			region.Buffer->UnMap();
+			CreateRegion(region, newSize);
+			offset = 0;
+		}
+
+		region.Head = offset + p_SizeBytes;
+
+		VulkanRingAllocation allocation{};
+		allocation.Buffer = region.Buffer->GetBuffer();
+		allocation.Offset = offset;
+		allocation.Size	  = p_SizeBytes;
+		allocation.Mapped = (uint8_t*)region.Buffer->GetMapped() + offset;
+		allocation.Frame  = m_FrameCount;
+
+		return allocation;
+	}
+
+	void VulkanRingBuffer::CreateRegion(Region& p_Region, VkDeviceSize p_SizeBytes)
+	{
+		YM_PROFILE_FUNCTION()
+
+		p_Region.Buffer = CreateUnique<VulkanMemoryBuffer>(
+			VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+			VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			p_SizeBytes
+		);
+		p_Region.Buffer->Map();
+
+		p_Region.SizeBytes = p_SizeBytes;
+		p_Region.Head	   = 0;
+	}
+}
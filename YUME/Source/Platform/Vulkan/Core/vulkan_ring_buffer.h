@@ -0,0 +1,66 @@
+#pragma once
+#include "YUME/Core/base.h"
+#include "YUME/Core/reference.h"
+#include "YUME/Core/singleton.h"
+#include "YUME/Core/definitions.h"
+#include "vulkan_memory_buffer.h"
+
+// Lib
+#include <vulkan/vulkan.h>
+
+#include <mutex>
+
+
+
+namespace YUME
+{
+	struct VulkanRingAllocation
+	{
+		VkBuffer	 Buffer = VK_NULL_HANDLE;
+		VkDeviceSize Offset = 0;
+		VkDeviceSize Size	= 0;
+		void*		 Mapped = nullptr;
+		uint64_t	 Frame	= 0;
+	};
+
+	// Persistently mapped, linear per-frame allocator for data that is rewritten every frame.
+	// A frame's region is only reset once its fence has signaled, so allocations are never
+	// overwritten while the GPU may still read them.
+	class VulkanRingBuffer : public ThreadSafeSingleton<VulkanRingBuffer>
+	{
+		friend class ThreadSafeSingleton<VulkanRingBuffer>;
+
+		public:
+			VulkanRingBuffer() = default;
+			~VulkanRingBuffer();
+
+			void Init(VkDeviceSize p_FrameSizeBytes = RING_BUFFER_FRAME_SIZE);
+
+			// Must be called after the frame's fence wait
+			void BeginFrame(uint32_t p_FrameIndex);
+
+			VulkanRingAllocation Allocate(VkDeviceSize p_SizeBytes, VkDeviceSize p_Alignment = 0);
+
+			uint64_t GetFrameCount() const { return m_FrameCount; }
+
+		private:
+			struct Region
+			{
+				Unique<VulkanMemoryBuffer> Buffer;
+				VkDeviceSize SizeBytes = 0;
+				VkDeviceSize Head	   = 0;
+			};
+
+			void CreateRegion(Region& p_Region, VkDeviceSize p_SizeBytes);
+
+		private:
+			Region		 m_Regions[MAX_FRAMES_IN_FLIGHT];
+			uint32_t	 m_CurrentRegion = 0;
+			uint64_t	 m_FrameCount	 = 1;
+
+			VkDeviceSize m_FrameSizeBytes = RING_BUFFER_FRAME_SIZE;
+			VkDeviceSize m_MinAlignment	  = 16;
+
+			std::mutex	 m_Mutex;
+	};
+}
@@ -0,0 +1,112 @@
+#include "YUME/yumepch.h"
+#include "vulkan_sampler_cache.h"
+#include "vulkan_device.h"
+#include "Platform/Vulkan/Utils/vulkan_utils.h"
+#include "YUME/Utils/hash_combiner.h"
+
+
+
+
+namespace YUME
+{
+	size_t VulkanSamplerKeyHash::operator()(const VulkanSamplerKey& p_Key) const
+	{
+		size_t hash = 0;
+		HashCombine(hash, (int)p_Key.MinFilter, (int)p_Key.MagFilter, (int)p_Key.MipmapMode,
+			(int)p_Key.AddressModeU, (int)p_Key.AddressModeV, (int)p_Key.AddressModeW,
+			p_Key.MaxAnisotropy, p_Key.MaxLod, p_Key.CompareEnable, (int)p_Key.CompareOp, (int)p_Key.BorderColor,
+			p_Key.CustomBorderColor.x, p_Key.CustomBorderColor.y, p_Key.CustomBorderColor.z, p_Key.CustomBorderColor.w,
+			(int)p_Key.CustomBorderFormat);
+
+		return hash;
+	}
+
+	VkSampler VulkanSamplerCache::Get(const VulkanSamplerKey& p_Key)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		if (auto it = m_Samplers.find(p_Key); it != m_Samplers.end())
+			return it->second;
+
+		VkSamplerCreateInfo samplerInfo		= {};
+		samplerInfo.sType					= VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+		samplerInfo.pNext					= VK_NULL_HANDLE;
+		samplerInfo.minFilter				= p_Key.MinFilter;
+		samplerInfo.magFilter				= p_Key.MagFilter;
+		samplerInfo.mipmapMode				= p_Key.MipmapMode;
+		samplerInfo.addressModeU			= p_Key.AddressModeU;
+		samplerInfo.addressModeV			= p_Key.AddressModeV;
+		samplerInfo.addressModeW			= p_Key.AddressModeW;
+		samplerInfo.anisotropyEnable		= p_Key.MaxAnisotropy > 1.0f ? VK_TRUE : VK_FALSE;
+		samplerInfo.maxAnisotropy			= p_Key.MaxAnisotropy;
+		samplerInfo.compareEnable			= p_Key.CompareEnable ? VK_TRUE : VK_FALSE;
+		samplerInfo.compareOp				= p_Key.CompareOp;
+		samplerInfo.borderColor				= p_Key.BorderColor;
+		samplerInfo.unnormalizedCoordinates = VK_FALSE;
+		samplerInfo.mipLodBias				= 0.0f;
+		samplerInfo.minLod					= 0.0f;
+		samplerInfo.maxLod					= p_Key.MaxLod;
+
+		VkSamplerCustomBorderColorCreateInfoEXT borderColorCI{};
+		if (p_Key.BorderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT || p_Key.BorderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT)
+		{
+			borderColorCI.sType	 = VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT;
+			borderColorCI.format = p_Key.CustomBorderFormat;
+
+			const auto& color = p_Key.CustomBorderColor;
+			if (p_Key.BorderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT)
+			{
+				borderColorCI.customBorderColor.int32[0] = (int32_t)color.x;
+				borderColorCI.customBorderColor.int32[1] = (int32_t)color.y;
+				borderColorCI.customBorderColor.int32[2] = (int32_t)color.z;
+				borderColorCI.customBorderColor.int32[3] = (int32_t)color.w;
+			}
+			else
+			{
+				borderColorCI.customBorderColor.float32[0] = color.x;
+				borderColorCI.customBorderColor.float32[1] = color.y;
+				borderColorCI.customBorderColor.float32[2] = color.z;
+				borderColorCI.customBorderColor.float32[3] = color.w;
+			}
+
+			samplerInfo.pNext = &borderColorCI;
+		}
+
+		VkSampler sampler = VK_NULL_HANDLE;
+		if (vkCreateSampler(VulkanDevice::Get().GetDevice(), &samplerInfo, VK_NULL_HANDLE, &sampler) != VK_SUCCESS)
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "Failed to create texture sampler!")
+			return VK_NULL_HANDLE;
+		}
+
+		m_Samplers[p_Key] = sampler;
+
+		std::string debugName = "Sampler " + std::to_string(m_Samplers.size() - 1);
+		VKUtils::SetDebugUtilsObjectName(VulkanDevice::Get().GetDevice(), VK_OBJECT_TYPE_SAMPLER, debugName.c_str(), sampler);
+
+		YM_CORE_TRACE(VULKAN_PREFIX "Created {}, {} samplers in the cache", debugName, m_Samplers.size())
+		return sampler;
+	}
+
+	uint32_t VulkanSamplerCache::GetCount()
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		return (uint32_t)m_Samplers.size();
+	}
+
+	void VulkanSamplerCache::Destroy()
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		YM_CORE_TRACE(VULKAN_PREFIX "Destroying {} cached samplers...", m_Samplers.size())
+
+		for (auto& [key, sampler] : m_Samplers)
+			vkDestroySampler(VulkanDevice::Get().GetDevice(), sampler, VK_NULL_HANDLE);
+
+		m_Samplers.clear();
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "YUME/Core/base.h"
+
+// Lib
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+
+// std
+#include <mutex>
+#include <unordered_map>
+
+
+
+namespace YUME
+{
+	struct VulkanSamplerKey
+	{
+		VkFilter			 MinFilter		   = VK_FILTER_LINEAR;
+		VkFilter			 MagFilter		   = VK_FILTER_LINEAR;
+		VkSamplerMipmapMode	 MipmapMode		   = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+		VkSamplerAddressMode AddressModeU	   = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		VkSamplerAddressMode AddressModeV	   = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		VkSamplerAddressMode AddressModeW	   = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		float				 MaxAnisotropy	   = 1.0f; // 1 disables anisotropic filtering
+		float				 MaxLod			   = 0.0f; // VK_LOD_CLAMP_NONE samples every mip the image has
+		bool				 CompareEnable	   = false;
+		VkCompareOp			 CompareOp		   = VK_COMPARE_OP_ALWAYS;
+		VkBorderColor		 BorderColor	   = VK_BORDER_COLOR_FLOAT_OPAQUE_BLACK;
+
+		// Only used by the custom border colors
+		glm::vec4			 CustomBorderColor = glm::vec4(0.0f);
+		VkFormat			 CustomBorderFormat = VK_FORMAT_UNDEFINED;
+
+		bool operator==(const VulkanSamplerKey& p_Other) const = default;
+	};
+
+	struct VulkanSamplerKeyHash
+	{
+		size_t operator()(const VulkanSamplerKey& p_Key) const;
+	};
+
+	// Samplers only depend on their state, so every texture with the same state shares one.
+	// They live as long as the device, there are only a handful of combinations in practice.
+	class VulkanSamplerCache
+	{
+		public:
+			VulkanSamplerCache() = default;
+			~VulkanSamplerCache() = default;
+
+			VkSampler Get(const VulkanSamplerKey& p_Key);
+
+			uint32_t GetCount();
+
+			void Destroy();
+
+		private:
+			std::unordered_map<VulkanSamplerKey, VkSampler, VulkanSamplerKeyHash> m_Samplers;
+			std::mutex m_Mutex;
+	};
+}
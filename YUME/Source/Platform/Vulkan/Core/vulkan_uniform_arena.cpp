@@ -0,0 +1,127 @@
+#include "YUME/yumepch.h"
+#include "vulkan_uniform_arena.h"
+#include "vulkan_device.h"
+#include "vulkan_upload_service.h"
+#include "Platform/Vulkan/Renderer/vulkan_context.h"
+
+// std
+#include <bit>
+
+
+
+
+namespace YUME
+{
+	VulkanUniformArena::~VulkanUniformArena()
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_TRACE(VULKAN_PREFIX "Destroying uniform arena...")
+
+		for (auto& page : m_Pages)
+		{
+			page.Buffer->SetDeleteWithoutQueue(true);
+			page.Buffer.reset();
+		}
+
+		m_Pages.clear();
+		m_FreeBlocks.clear();
+	}
+
+	void VulkanUniformArena::Init(VkDeviceSize p_PageSizeBytes)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_PageSizeBytes > 0)
+
+		m_PageSizeBytes = p_PageSizeBytes;
+
+		const auto& limits = VulkanDevice::Get().GetPhysicalDeviceStruct().Properties.limits;
+		m_MinAlignment = std::bit_ceil(std::max(m_MinAlignment, limits.minUniformBufferOffsetAlignment));
+	}
+
+	VulkanUniformAllocation VulkanUniformArena::Allocate(VkDeviceSize p_SizeBytes)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_SizeBytes > 0)
+
+		// Power of two blocks, so each one is aligned once the page head is
+		VkDeviceSize blockSize = std::bit_ceil(std::max(p_SizeBytes, m_MinAlignment));
+		uint32_t sizeClass	   = (uint32_t)std::countr_zero(blockSize);
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		if (sizeClass >= m_FreeBlocks.size())
+			m_FreeBlocks.resize(sizeClass + 1);
+
+		auto& freeBlocks = m_FreeBlocks[sizeClass];
+		if (!freeBlocks.empty())
+		{
+			auto allocation = freeBlocks.back();
+			freeBlocks.pop_back();
+
+			allocation.Size = p_SizeBytes;
+			return allocation;
+		}
+
+		Page* page = m_Pages.empty() ? nullptr : &m_Pages.back();
+		if (!page || page->Head + blockSize > page->SizeBytes)
+		{
+			// The rest of the full page is left unused, it's at most one block of each class
+			page = &CreatePage(std::max(m_PageSizeBytes, blockSize));
+		}
+
+		VulkanUniformAllocation allocation{};
+		allocation.Buffer	 = page->Buffer->GetBuffer();
+		allocation.Offset	 = page->Head;
+		allocation.Size		 = p_SizeBytes;
+		allocation.SizeClass = sizeClass;
+
+		page->Head += blockSize;
+
+		return allocation;
+	}
+
+	void VulkanUniformArena::Free(const VulkanUniformAllocation& p_Allocation)
+	{
+		if (!p_Allocation.IsValid())
+			return;
+
+		VulkanContext::PushFunction([p_Allocation]()
+		{
+			auto& arena = VulkanUniformArena::Get();
+
+			std::scoped_lock<std::mutex> lock(arena.m_Mutex);
+			arena.m_FreeBlocks[p_Allocation.SizeClass].push_back(p_Allocation);
+		});
+	}
+
+	void VulkanUniformArena::Upload(const VulkanUniformAllocation& p_Allocation, const void* p_Data, VkDeviceSize p_SizeBytes, VkDeviceSize p_Offset)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_Allocation.IsValid() && p_Data != nullptr && p_Offset + p_SizeBytes <= p_Allocation.Size)
+
+		// Blocks are rewritten in place and reused once freed, the frames in flight may still read them
+		VulkanUploadService::Get().UpdateBuffer(p_Allocation.Buffer, p_Data, p_SizeBytes, p_Allocation.Offset + p_Offset);
+	}
+
+	VulkanUniformArena::Page& VulkanUniformArena::CreatePage(VkDeviceSize p_SizeBytes)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_TRACE(VULKAN_PREFIX "Creating uniform arena page {} with {} bytes...", m_Pages.size(), p_SizeBytes)
+
+		auto& page	   = m_Pages.emplace_back();
+		page.Buffer	   = CreateUnique<VulkanMemoryBuffer>(
+			VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			p_SizeBytes
+		);
+		page.SizeBytes = p_SizeBytes;
+		page.Head	   = 0;
+
+		return page;
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "YUME/Core/base.h"
+#include "YUME/Core/reference.h"
+#include "YUME/Core/singleton.h"
+#include "YUME/Core/definitions.h"
+#include "vulkan_memory_buffer.h"
+
+// Lib
+#include <vulkan/vulkan.h>
+
+#include <mutex>
+
+
+
+namespace YUME
+{
+	struct VulkanUniformAllocation
+	{
+		VkBuffer	 Buffer	   = VK_NULL_HANDLE;
+		VkDeviceSize Offset	   = 0;
+		VkDeviceSize Size	   = 0;
+		uint32_t	 SizeClass = 0;
+
+		bool IsValid() const { return Buffer != VK_NULL_HANDLE; }
+	};
+
+	// Long lived uniform data (material properties, constants) suballocated from a few large device local pages.
+	// Blocks are rounded up to a power of two of at least minUniformBufferOffsetAlignment and recycled by size,
+	// so the blocks of a page share one descriptor and only differ by their dynamic offset.
+	class VulkanUniformArena : public ThreadSafeSingleton<VulkanUniformArena>
+	{
+		friend class ThreadSafeSingleton<VulkanUniformArena>;
+
+		public:
+			VulkanUniformArena() = default;
+			~VulkanUniformArena();
+
+			void Init(VkDeviceSize p_PageSizeBytes = UNIFORM_ARENA_PAGE_SIZE);
+
+			VulkanUniformAllocation Allocate(VkDeviceSize p_SizeBytes);
+			// The block is only reused once the frames in flight are done with it
+			void Free(const VulkanUniformAllocation& p_Allocation);
+
+			// Copied on the graphics queue after the frames already submitted, p_Offset is relative to the block
+			void Upload(const VulkanUniformAllocation& p_Allocation, const void* p_Data, VkDeviceSize p_SizeBytes, VkDeviceSize p_Offset = 0);
+
+		private:
+			struct Page
+			{
+				Unique<VulkanMemoryBuffer> Buffer;
+				VkDeviceSize SizeBytes = 0;
+				VkDeviceSize Head	   = 0;
+			};
+
+			Page& CreatePage(VkDeviceSize p_SizeBytes);
+
+		private:
+			std::vector<Page> m_Pages;
+			std::vector<std::vector<VulkanUniformAllocation>> m_FreeBlocks; // Indexed by size class, log2 of the block size
+
+			VkDeviceSize m_PageSizeBytes = UNIFORM_ARENA_PAGE_SIZE;
+			VkDeviceSize m_MinAlignment	 = 16;
+
+			std::mutex m_Mutex;
+	};
+}
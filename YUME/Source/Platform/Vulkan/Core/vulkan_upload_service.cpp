@@ -0,0 +1,357 @@
+#include "YUME/yumepch.h"
+#include "vulkan_upload_service.h"
+#include "vulkan_device.h"
+#include "Platform/Vulkan/Utils/vulkan_utils.h"
+
+
+
+
+namespace YUME
+{
+	VulkanUploadService::~VulkanUploadService()
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_TRACE(VULKAN_PREFIX "Destroying upload service...")
+
+		auto device = VulkanDevice::Get().GetDevice();
+
+		if (m_Recording)
+		{
+			m_InFlight.push_back(std::move(m_Current));
+			m_Recording = false;
+		}
+
+		for (auto& batch : m_InFlight)
+		{
+			vkFreeCommandBuffers(device, m_TransferCommandPool->GetHandle(), 1, &batch.TransferCommandBuffer);
+			vkFreeCommandBuffers(device, m_GraphicsCommandPool->GetHandle(), 1, &batch.GraphicsCommandBuffer);
+
+			for (auto& staging : batch.StagingBuffers)
+				staging->SetDeleteWithoutQueue(true);
+		}
+		m_InFlight.clear();
+
+		m_Timeline.reset();
+		m_GraphicsCommandPool.reset();
+		m_TransferCommandPool.reset();
+	}
+
+	void VulkanUploadService::Init()
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_TRACE(VULKAN_PREFIX "Creating upload service...")
+
+		const auto& indices = VulkanDevice::Get().GetQueueFamilyIndices();
+		m_TransferFamily	= (uint32_t)indices.Transfer;
+		m_GraphicsFamily	= (uint32_t)indices.Graphics;
+
+		if (m_TransferFamily != m_GraphicsFamily)
+			YM_CORE_INFO(VULKAN_PREFIX "Uploads use the transfer queue family {}", m_TransferFamily)
+
+		m_TransferCommandPool = CreateUnique<VulkanCommandPool>(m_TransferFamily, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, "UploadTransferCommandPool");
+		m_GraphicsCommandPool = CreateUnique<VulkanCommandPool>(m_GraphicsFamily, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, "UploadGraphicsCommandPool");
+		m_Timeline			  = CreateUnique<VulkanSemaphore>(SemaphoreType::Timeline);
+	}
+
+	uint64_t VulkanUploadService::UploadBuffer(VkBuffer p_Buffer, const void* p_Data, VkDeviceSize p_SizeBytes, VkDeviceSize p_Offset)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_Data != nullptr && p_SizeBytes > 0)
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		BeginBatch();
+
+		auto staging = CreateStagingBuffer(p_Data, p_SizeBytes);
+
+		VkBufferCopy copyRegion = {};
+		copyRegion.dstOffset	= p_Offset;
+		copyRegion.size			= p_SizeBytes;
+		vkCmdCopyBuffer(m_Current.TransferCommandBuffer, staging->GetBuffer(), p_Buffer, 1, &copyRegion);
+
+		bool ownershipTransfer		 = m_TransferFamily != m_GraphicsFamily;
+
+		VkBufferMemoryBarrier barrier{};
+		barrier.sType				 = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.buffer				 = p_Buffer;
+		barrier.offset				 = p_Offset;
+		barrier.size				 = p_SizeBytes;
+		barrier.srcQueueFamilyIndex	 = ownershipTransfer ? m_TransferFamily : VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex	 = ownershipTransfer ? m_GraphicsFamily : VK_QUEUE_FAMILY_IGNORED;
+
+		VkPipelineStageFlags dstStages = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		VkAccessFlags dstAccess		   = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+
+		if (ownershipTransfer)
+		{
+			// Release
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask = 0;
+			vkCmdPipelineBarrier(m_Current.TransferCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+		}
+
+		// Acquire
+		barrier.srcAccessMask = ownershipTransfer ? 0 : VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = dstAccess;
+		vkCmdPipelineBarrier(m_Current.GraphicsCommandBuffer, ownershipTransfer ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_TRANSFER_BIT, dstStages, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+		return m_Current.Value;
+	}
+
+	uint64_t VulkanUploadService::UpdateBuffer(VkBuffer p_Buffer, const void* p_Data, VkDeviceSize p_SizeBytes, VkDeviceSize p_Offset)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_Data != nullptr && p_SizeBytes > 0)
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		BeginBatch();
+
+		auto staging = CreateStagingBuffer(p_Data, p_SizeBytes);
+
+		VkPipelineStageFlags readStages = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		VkAccessFlags readAccess		= VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+
+		VkBufferMemoryBarrier barrier{};
+		barrier.sType				= VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.buffer				= p_Buffer;
+		barrier.offset				= p_Offset;
+		barrier.size				= p_SizeBytes;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+
+		// Frames submitted earlier may still read the old data, and an earlier update may still be writing it
+		barrier.srcAccessMask		= readAccess | VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask		= VK_ACCESS_TRANSFER_WRITE_BIT;
+		vkCmdPipelineBarrier(m_Current.GraphicsCommandBuffer, readStages | VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+		VkBufferCopy copyRegion = {};
+		copyRegion.dstOffset	= p_Offset;
+		copyRegion.size			= p_SizeBytes;
+		vkCmdCopyBuffer(m_Current.GraphicsCommandBuffer, staging->GetBuffer(), p_Buffer, 1, &copyRegion);
+
+		barrier.srcAccessMask		= VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask		= readAccess;
+		vkCmdPipelineBarrier(m_Current.GraphicsCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, readStages, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+		return m_Current.Value;
+	}
+
+	uint64_t VulkanUploadService::UploadImage(VkImage p_Image, const VkImageSubresourceRange& p_Range, const void* p_Data, VkDeviceSize p_SizeBytes,
+		const std::vector<VkBufferImageCopy>& p_Regions, const GraphicsCallback& p_OnGraphics)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_Data != nullptr && p_SizeBytes > 0 && !p_Regions.empty())
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		BeginBatch();
+
+		auto staging = CreateStagingBuffer(p_Data, p_SizeBytes);
+
+		VkImageMemoryBarrier barrier{};
+		barrier.sType				= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.image				= p_Image;
+		barrier.subresourceRange	= p_Range;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.oldLayout			= VK_IMAGE_LAYOUT_UNDEFINED;
+		barrier.newLayout			= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.srcAccessMask		= 0;
+		barrier.dstAccessMask		= VK_ACCESS_TRANSFER_WRITE_BIT;
+		vkCmdPipelineBarrier(m_Current.TransferCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		vkCmdCopyBufferToImage(m_Current.TransferCommandBuffer, staging->GetBuffer(), p_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			(uint32_t)p_Regions.size(), p_Regions.data());
+
+		bool ownershipTransfer		= m_TransferFamily != m_GraphicsFamily;
+
+		barrier.oldLayout			= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.newLayout			= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.srcQueueFamilyIndex = ownershipTransfer ? m_TransferFamily : VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = ownershipTransfer ? m_GraphicsFamily : VK_QUEUE_FAMILY_IGNORED;
+
+		if (ownershipTransfer)
+		{
+			// Release
+			barrier.srcAccessMask	= VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask	= 0;
+			vkCmdPipelineBarrier(m_Current.TransferCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+		}
+
+		// Acquire
+		barrier.srcAccessMask		= ownershipTransfer ? 0 : VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask		= VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+		vkCmdPipelineBarrier(m_Current.GraphicsCommandBuffer, ownershipTransfer ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		if (p_OnGraphics)
+			p_OnGraphics(m_Current.GraphicsCommandBuffer);
+
+		return m_Current.Value;
+	}
+
+	void VulkanUploadService::Flush()
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		Recycle();
+
+		if (!m_Recording)
+			return;
+
+		vkEndCommandBuffer(m_Current.TransferCommandBuffer);
+		vkEndCommandBuffer(m_Current.GraphicsCommandBuffer);
+
+		uint64_t transferValue = m_Current.Value - 1;
+		uint64_t graphicsValue = m_Current.Value;
+		auto& timeline		   = m_Timeline->GetHandle();
+
+		// Transfer queue
+		{
+			VkTimelineSemaphoreSubmitInfo timelineInfo{};
+			timelineInfo.sType						= VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+			timelineInfo.signalSemaphoreValueCount	= 1;
+			timelineInfo.pSignalSemaphoreValues		= &transferValue;
+
+			VkSubmitInfo submitInfo{};
+			submitInfo.sType						= VK_STRUCTURE_TYPE_SUBMIT_INFO;
+			submitInfo.pNext						= &timelineInfo;
+			submitInfo.commandBufferCount			= 1;
+			submitInfo.pCommandBuffers				= &m_Current.TransferCommandBuffer;
+			submitInfo.signalSemaphoreCount			= 1;
+			submitInfo.pSignalSemaphores			= &timeline;
+
+			auto res = vkQueueSubmit(VulkanDevice::Get().GetTransferQueue(), 1, &submitInfo, VK_NULL_HANDLE);
+			if (res != VK_SUCCESS)
+			{
+				YM_CORE_ERROR(VULKAN_PREFIX "Failed to submit upload batch: {}", VKUtils::VkResultToString(res))
+			}
+		}
+
+		// Graphics queue, later submissions are ordered after its barriers
+		{
+			VkPipelineStageFlags waitStage			= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+			VkTimelineSemaphoreSubmitInfo timelineInfo{};
+			timelineInfo.sType						= VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+			timelineInfo.waitSemaphoreValueCount	= 1;
+			timelineInfo.pWaitSemaphoreValues		= &transferValue;
+			timelineInfo.signalSemaphoreValueCount	= 1;
+			timelineInfo.pSignalSemaphoreValues		= &graphicsValue;
+
+			VkSubmitInfo submitInfo{};
+			submitInfo.sType						= VK_STRUCTURE_TYPE_SUBMIT_INFO;
+			submitInfo.pNext						= &timelineInfo;
+			submitInfo.waitSemaphoreCount			= 1;
+			submitInfo.pWaitSemaphores				= &timeline;
+			submitInfo.pWaitDstStageMask			= &waitStage;
+			submitInfo.commandBufferCount			= 1;
+			submitInfo.pCommandBuffers				= &m_Current.GraphicsCommandBuffer;
+			submitInfo.signalSemaphoreCount			= 1;
+			submitInfo.pSignalSemaphores			= &timeline;
+
+			auto res = vkQueueSubmit(VulkanDevice::Get().GetGraphicQueue(), 1, &submitInfo, VK_NULL_HANDLE);
+			if (res != VK_SUCCESS)
+			{
+				YM_CORE_ERROR(VULKAN_PREFIX "Failed to submit upload batch: {}", VKUtils::VkResultToString(res))
+			}
+		}
+
+		m_LastValue = m_Current.Value;
+		m_InFlight.push_back(std::move(m_Current));
+		m_Current	= {};
+		m_Recording = false;
+	}
+
+	bool VulkanUploadService::IsComplete(uint64_t p_Value)
+	{
+		return m_Timeline->GetValue() >= p_Value;
+	}
+
+	void VulkanUploadService::Wait(uint64_t p_Value)
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (IsComplete(p_Value))
+			return;
+
+		Flush();
+
+		YM_PROFILE_SCOPE_T("Wait Upload", Optick::Category::Wait)
+		m_Timeline->Wait(p_Value, UINT64_MAX);
+	}
+
+	void VulkanUploadService::BeginBatch()
+	{
+		if (m_Recording)
+			return;
+
+		m_Current.TransferCommandBuffer = AllocateCommandBuffer(m_TransferCommandPool->GetHandle());
+		m_Current.GraphicsCommandBuffer = AllocateCommandBuffer(m_GraphicsCommandPool->GetHandle());
+		m_Current.Value					= m_LastValue + 2;
+		m_Recording						= true;
+	}
+
+	void VulkanUploadService::Recycle()
+	{
+		if (m_InFlight.empty())
+			return;
+
+		auto device		   = VulkanDevice::Get().GetDevice();
+		uint64_t completed = m_Timeline->GetValue();
+
+		while (!m_InFlight.empty() && m_InFlight.front().Value <= completed)
+		{
+			auto& batch = m_InFlight.front();
+
+			vkFreeCommandBuffers(device, m_TransferCommandPool->GetHandle(), 1, &batch.TransferCommandBuffer);
+			vkFreeCommandBuffers(device, m_GraphicsCommandPool->GetHandle(), 1, &batch.GraphicsCommandBuffer);
+
+			for (auto& staging : batch.StagingBuffers)
+				staging->SetDeleteWithoutQueue(true);
+
+			m_InFlight.pop_front();
+		}
+	}
+
+	VulkanMemoryBuffer* VulkanUploadService::CreateStagingBuffer(const void* p_Data, VkDeviceSize p_SizeBytes)
+	{
+		auto& staging = m_Current.StagingBuffers.emplace_back(CreateUnique<VulkanMemoryBuffer>(
+			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			p_SizeBytes
+		));
+
+		staging->SetData(p_SizeBytes, p_Data);
+
+		return staging.get();
+	}
+
+	VkCommandBuffer VulkanUploadService::AllocateCommandBuffer(VkCommandPool p_Pool)
+	{
+		auto device = VulkanDevice::Get().GetDevice();
+
+		VkCommandBufferAllocateInfo allocInfo = {};
+		allocInfo.sType				 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		allocInfo.level				 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		allocInfo.commandPool		 = p_Pool;
+		allocInfo.commandBufferCount = 1;
+
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+		vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer);
+
+		VkCommandBufferBeginInfo beginInfo = {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+		return commandBuffer;
+	}
+}
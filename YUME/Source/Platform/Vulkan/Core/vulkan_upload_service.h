@@ -0,0 +1,84 @@
+#pragma once
+#include "YUME/Core/base.h"
+#include "YUME/Core/reference.h"
+#include "YUME/Core/singleton.h"
+#include "vulkan_memory_buffer.h"
+#include "vulkan_commandpool.h"
+#include "vulkan_sync.h"
+
+// Lib
+#include <vulkan/vulkan.h>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+
+
+namespace YUME
+{
+	// Batches staging copies on the transfer queue. Each batch is followed by a small graphics
+	// submission that acquires ownership and runs graphics-only work (mip blits, final layouts).
+	// Completion is tracked with a timeline semaphore, the caller never waits on the GPU: every graphics
+	// submit comes after a Flush, so it is ordered after the batch by the graphics queue.
+	class VulkanUploadService : public ThreadSafeSingleton<VulkanUploadService>
+	{
+		friend class ThreadSafeSingleton<VulkanUploadService>;
+
+		public:
+			using GraphicsCallback = std::function<void(VkCommandBuffer)>;
+
+			VulkanUploadService() = default;
+			~VulkanUploadService();
+
+			void Init();
+
+			// For memory the graphics queue hasn't used yet (new buffers, new ranges of a pool page).
+			// Returns the timeline value signaled once the data is usable on the graphics queue
+			uint64_t UploadBuffer(VkBuffer p_Buffer, const void* p_Data, VkDeviceSize p_SizeBytes, VkDeviceSize p_Offset = 0);
+
+			// Rewrites memory the graphics queue may still be reading. Copied on the graphics queue after
+			// the work submitted before it, no ownership transfer is needed.
+			uint64_t UpdateBuffer(VkBuffer p_Buffer, const void* p_Data, VkDeviceSize p_SizeBytes, VkDeviceSize p_Offset = 0);
+
+			// The image is left in TRANSFER_DST_OPTIMAL for p_OnGraphics, which must move it to its final layout
+			uint64_t UploadImage(VkImage p_Image, const VkImageSubresourceRange& p_Range, const void* p_Data, VkDeviceSize p_SizeBytes,
+				const std::vector<VkBufferImageCopy>& p_Regions, const GraphicsCallback& p_OnGraphics);
+
+			// Submits the pending batch, called before every graphics queue submit
+			void Flush();
+
+			// Only needed to wait on the CPU, the GPU side is ordered by Flush
+			bool IsComplete(uint64_t p_Value);
+			void Wait(uint64_t p_Value);
+
+		private:
+			struct Batch
+			{
+				VkCommandBuffer TransferCommandBuffer = VK_NULL_HANDLE;
+				VkCommandBuffer GraphicsCommandBuffer = VK_NULL_HANDLE;
+				std::vector<Unique<VulkanMemoryBuffer>> StagingBuffers;
+				uint64_t Value = 0;
+			};
+
+			void BeginBatch();
+			void Recycle();
+			VulkanMemoryBuffer* CreateStagingBuffer(const void* p_Data, VkDeviceSize p_SizeBytes);
+			VkCommandBuffer AllocateCommandBuffer(VkCommandPool p_Pool);
+
+		private:
+			Unique<VulkanCommandPool> m_TransferCommandPool;
+			Unique<VulkanCommandPool> m_GraphicsCommandPool;
+			Unique<VulkanSemaphore>	  m_Timeline;
+
+			uint32_t m_TransferFamily = 0;
+			uint32_t m_GraphicsFamily = 0;
+
+			Batch m_Current;
+			bool m_Recording = false;
+			std::deque<Batch> m_InFlight;
+			uint64_t m_LastValue = 0;
+
+			std::mutex m_Mutex;
+	};
+}
@@ -52,6 +52,9 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION()
 
+		if (m_Data.Headless)
+			return;
+
 		glfwPollEvents();
 	}
 
@@ -72,6 +75,9 @@ namespace YUME
 
 	void VulkanWindow::SetCursorMode(CursorMode p_Mode)
 	{
+		if (m_Data.Headless)
+			return;
+
 		int mode = Utils::CursorModeToGLFWCursorMode(p_Mode);
 		if (mode != 0)
 			glfwSetInputMode(m_Window, GLFW_CURSOR, mode);
@@ -84,6 +90,14 @@ namespace YUME
 		m_Data.Title = p_Props.Title;
 		m_Data.Width = p_Props.Width;
 		m_Data.Height = p_Props.Height;
+		m_Data.Headless = p_Props.Headless;
+
+		if (m_Data.Headless)
+		{
+			YM_CORE_INFO("Creating headless context {0} ({1}, {2})", p_Props.Title, p_Props.Width, p_Props.Height);
+			m_Data.Context->InitHeadless(m_Data.Title.c_str(), m_Data.Width, m_Data.Height);
+			return;
+		}
 
 		YM_CORE_INFO("Creating window {0} ({1}, {2})", p_Props.Title, p_Props.Width, p_Props.Height);
 
@@ -214,6 +228,9 @@ namespace YUME
 		YM_PROFILE_FUNCTION()
 
 		YM_CORE_WARN("{} window shutdown", m_Data.Title)
+		if (m_Data.Headless)
+			return;
+
 		glfwDestroyWindow(m_Window);
 		--s_GLFWWindowCount;
 
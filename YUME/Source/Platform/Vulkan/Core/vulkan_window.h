@@ -32,6 +32,7 @@ namespace YUME
 			bool IsVSync() const override;
 
 			void* GetNativeWindow() const override { return m_Window; }
+			bool IsHeadless() const override { return m_Data.Headless; }
 			const std::vector<Resolution>& GetResolutions() override { return m_Resolutions; }
 
 			GraphicsContext* GetContext() override;
@@ -43,7 +44,7 @@ namespace YUME
 			void Shutdown();
 
 		private:
-			GLFWwindow* m_Window;
+			GLFWwindow* m_Window = nullptr;
 
 			struct WindowData
 			{
@@ -51,6 +52,7 @@ namespace YUME
 				uint32_t Width;
 				uint32_t Height;
 				bool Vsync;
+				bool Headless;
 				Unique<VulkanContext> Context;
 
 				EventCallbackFn EventCallback;
@@ -2,6 +2,8 @@
 #include "vulkan_buffer.h"
 
 #include "Platform/Vulkan/Core/vulkan_device.h"
+#include "Platform/Vulkan/Core/vulkan_upload_service.h"
+#include "Platform/Vulkan/Utils/vulkan_utils.h"
 #include "vulkan_context.h"
 #include "YUME/Core/application.h"
 
@@ -24,24 +26,42 @@ namespace YUME
 				p_SizeBytes
 			);
 
-			m_Buffer->SetData(p_SizeBytes, p_Data);
+			VulkanUploadService::Get().UploadBuffer(m_Buffer->GetBuffer(), p_Data, p_SizeBytes);
 		}
 		else
 		{
-			m_Buffer = CreateUnique<VulkanMemoryBuffer>(
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-				p_SizeBytes
-			);
+			m_Dynamic = true;
 		}
 	}
 
+	VulkanVertexBuffer::VulkanVertexBuffer(uint64_t p_SizeBytes)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_SizeBytes > 0)
+
+		m_Buffer = CreateUnique<VulkanMemoryBuffer>(
+			VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			p_SizeBytes
+		);
+	}
+
 	void VulkanVertexBuffer::Bind(CommandBuffer* p_CommandBuffer) const
 	{
 		YM_PROFILE_FUNCTION()
 
 		auto commandBuffer = static_cast<VulkanCommandBuffer*>(p_CommandBuffer)->GetHandle();
 
+		if (m_Dynamic)
+		{
+			YM_CORE_ASSERT(m_Allocation.Frame == VulkanRingBuffer::Get().GetFrameCount(), "Dynamic vertex buffer has no data for this frame")
+			vkCmdBindVertexBuffers(commandBuffer, 0, 1, &m_Allocation.Buffer, &m_Allocation.Offset);
+			return;
+		}
+
+		m_Bound.store(true, std::memory_order_relaxed);
+
 		VkDeviceSize offset = 0;
 		auto buffer = m_Buffer->GetBuffer();
 		vkCmdBindVertexBuffers(commandBuffer, 0, 1, &buffer, &offset);
@@ -55,11 +75,39 @@ namespace YUME
 
 	void VulkanVertexBuffer::SetData(const void* p_Data, uint64_t p_SizeBytes)
 	{
+		YM_PROFILE_FUNCTION()
+
+		if (m_Dynamic)
+		{
+			YM_CORE_VERIFY(p_Data != nullptr && p_SizeBytes > 0)
+
+			m_Allocation = VulkanRingBuffer::Get().Allocate(p_SizeBytes);
+			memcpy(m_Allocation.Mapped, p_Data, p_SizeBytes);
+			return;
+		}
+
 		m_Buffer->SetData(p_SizeBytes, p_Data);
 	}
 
+	void VulkanVertexBuffer::Upload(const void* p_Data, uint64_t p_SizeBytes, uint64_t p_Offset)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(!m_Dynamic, "Dynamic vertex buffers are written with SetData")
+
+		// Until the buffer is drawn from, ranges are filled on the transfer queue (geometry pages while loading)
+		if (m_Bound.load(std::memory_order_relaxed))
+			VulkanUploadService::Get().UpdateBuffer(m_Buffer->GetBuffer(), p_Data, p_SizeBytes, p_Offset);
+		else
+			VulkanUploadService::Get().UploadBuffer(m_Buffer->GetBuffer(), p_Data, p_SizeBytes, p_Offset);
+	}
+
 	void VulkanVertexBuffer::Flush()
 	{
+		// Ring buffer memory is host coherent
+		if (m_Dynamic)
+			return;
+
 		m_Buffer->Flush();
 	}
 
@@ -75,7 +123,21 @@ namespace YUME
 			sizeBytes
 		);
 
-		m_Buffer->SetData(sizeBytes, p_Indices);
+		VulkanUploadService::Get().UploadBuffer(m_Buffer->GetBuffer(), p_Indices, sizeBytes);
+	}
+
+	VulkanIndexBuffer::VulkanIndexBuffer(uint32_t p_Count, IndexType p_Type)
+		: m_Count(p_Count), m_Type(p_Type)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_Count > 0)
+
+		m_Buffer = CreateUnique<VulkanMemoryBuffer>(
+			VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			(uint64_t)p_Count * GetIndexSize(p_Type)
+		);
 	}
 
 
@@ -85,9 +147,11 @@ namespace YUME
 
 		auto commandBuffer = static_cast<VulkanCommandBuffer*>(p_CommandBuffer)->GetHandle();
 
+		m_Bound.store(true, std::memory_order_relaxed);
+
 		VkDeviceSize offset = 0;
 		auto buffer = m_Buffer->GetBuffer();
-		vkCmdBindIndexBuffer(commandBuffer, buffer, offset, VK_INDEX_TYPE_UINT32);
+		vkCmdBindIndexBuffer(commandBuffer, buffer, offset, VKUtils::IndexTypeToVk(m_Type));
 	}
 
 	void VulkanIndexBuffer::Unbind() const
@@ -95,4 +159,20 @@ namespace YUME
 		YM_PROFILE_FUNCTION()
 
 	}
+
+	void VulkanIndexBuffer::Upload(const void* p_Indices, uint32_t p_Count, uint32_t p_FirstIndex)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_FirstIndex + p_Count <= m_Count)
+
+		uint32_t indexSize = GetIndexSize(m_Type);
+		uint64_t sizeBytes = (uint64_t)p_Count * indexSize;
+		uint64_t offset	   = (uint64_t)p_FirstIndex * indexSize;
+
+		if (m_Bound.load(std::memory_order_relaxed))
+			VulkanUploadService::Get().UpdateBuffer(m_Buffer->GetBuffer(), p_Indices, sizeBytes, offset);
+		else
+			VulkanUploadService::Get().UploadBuffer(m_Buffer->GetBuffer(), p_Indices, sizeBytes, offset);
+	}
 }
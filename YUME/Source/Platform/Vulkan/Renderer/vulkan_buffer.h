@@ -1,10 +1,14 @@
 #pragma once
 #include "YUME/Renderer/buffer.h"
 #include "Platform/Vulkan/Core/vulkan_memory_buffer.h"
+#include "Platform/Vulkan/Core/vulkan_ring_buffer.h"
 
 // Lib
 #include <vulkan/vulkan.h>
 
+// std
+#include <atomic>
+
 
 
 namespace YUME
@@ -15,17 +19,26 @@ namespace YUME
 		public:
 			VulkanVertexBuffer() = default;
 			VulkanVertexBuffer(const void* p_Data, uint64_t p_SizeBytes);
+			explicit VulkanVertexBuffer(uint64_t p_SizeBytes);
 			~VulkanVertexBuffer() override = default;
 
 			void Bind(CommandBuffer* p_CommandBuffer) const override;
 			void Unbind() const override;
 
 			void SetData(const void* p_Data, uint64_t p_SizeBytes) override;
+			void Upload(const void* p_Data, uint64_t p_SizeBytes, uint64_t p_Offset) override;
 
 			void Flush() override;
 
 		private:
 			Unique<VulkanMemoryBuffer> m_Buffer;
+
+			// Created without data, the contents are streamed through the frame ring buffer
+			bool m_Dynamic = false;
+			VulkanRingAllocation m_Allocation;
+
+			// Set by the first Bind, from then on Upload rewrites memory the graphics queue owns
+			mutable std::atomic<bool> m_Bound = false;
 	};
 
 
@@ -34,15 +47,22 @@ namespace YUME
 		public:
 			VulkanIndexBuffer() = default;
 			explicit VulkanIndexBuffer(const uint32_t* p_Indices, uint32_t p_Count);
+			VulkanIndexBuffer(uint32_t p_Count, IndexType p_Type);
 			~VulkanIndexBuffer() override = default;
 
 			void Bind(CommandBuffer* p_CommandBuffer) const override;
 			void Unbind() const override;
 
+			void Upload(const void* p_Indices, uint32_t p_Count, uint32_t p_FirstIndex) override;
+
 			uint32_t GetCount() const override { return m_Count; }
+			IndexType GetIndexType() const override { return m_Type; }
 
 		private:
 			Unique<VulkanMemoryBuffer> m_Buffer;
 			uint32_t m_Count = 0;
+			IndexType m_Type = IndexType::UINT32;
+
+			mutable std::atomic<bool> m_Bound = false;
 	};
 }
\ No newline at end of file
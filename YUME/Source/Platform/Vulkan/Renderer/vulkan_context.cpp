@@ -2,9 +2,13 @@
 #include "vulkan_context.h"
 
 #include "Platform/Vulkan/Core/vulkan_device.h"
+#include "Platform/Vulkan/Core/vulkan_ring_buffer.h"
+#include "Platform/Vulkan/Core/vulkan_uniform_arena.h"
+#include "Platform/Vulkan/Core/vulkan_upload_service.h"
 #include "Platform/Vulkan/Utils/vulkan_utils.h"
 #include "Platform/Vulkan/ImGui/vulkan_imgui_layer.h"
 #include "YUME/Core/application.h"
+#include "YUME/Core/jobs.h"
 #include "YUME/Renderer/texture.h"
 #include "vulkan_texture.h"
 
@@ -79,6 +83,8 @@ namespace YUME
 
 	VkInstance VulkanContext::s_Instance = VK_NULL_HANDLE;
 	DeletionQueue VulkanContext::m_MainDeletionQueue = DeletionQueue();
+	bool VulkanContext::s_FrameQueuesReady = false;
+	bool VulkanContext::s_Headless = false;
 
 	VulkanContext::~VulkanContext()
 	{
@@ -88,9 +94,16 @@ namespace YUME
 
 		VKUtils::WaitIdle();
 
+		VulkanUploadService::Release();
+		VulkanRingBuffer::Release();
+
+		s_FrameQueuesReady = false;
 		VulkanSwapchain::Release();
 
 		m_MainDeletionQueue.Flush();
+
+		// After the deletion queues, they give the freed blocks back
+		VulkanUniformArena::Release();
 	
 		VulkanDevice::Release();
 
@@ -110,7 +123,7 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION()
 
-		YM_CORE_ASSERT(p_Window)
+		YM_CORE_ASSERT(p_Window || s_Headless)
 		m_Window = (GLFWwindow*)p_Window;
 
 		YM_CORE_TRACE(VULKAN_PREFIX "Initializing context...")
@@ -151,8 +164,14 @@ namespace YUME
 		YM_CORE_TRACE(VULKAN_PREFIX "Creating logical device...")
 		VulkanDevice::Get().Init();
 
+		VulkanUploadService::Get().Init();
+
 		YM_CORE_TRACE(VULKAN_PREFIX "Creating swapchain...")
-		VulkanSwapchain::Get().Init(false /* Vsync */, m_Window);
+		VulkanSwapchain::Get().Init(false /* Vsync */, m_Window, m_HeadlessExtent);
+		s_FrameQueuesReady = true;
+
+		VulkanRingBuffer::Get().Init();
+		VulkanUniformArena::Get().Init();
 
 	#if defined(YM_PLATFORM_WINDOWS) && defined(YM_PROFILE)
 		YM_CORE_TRACE(VULKAN_PREFIX "Initializing gpu optick...")
@@ -186,15 +205,22 @@ namespace YUME
 	#endif
 	}
 
+	void VulkanContext::InitHeadless(const char* p_Name, uint32_t p_Width, uint32_t p_Height)
+	{
+		YM_CORE_ASSERT(p_Width > 0 && p_Height > 0)
+
+		s_Headless		 = true;
+		m_HeadlessExtent = { p_Width, p_Height };
+
+		Init(p_Name, nullptr);
+	}
+
 	void VulkanContext::Begin()
 	{
 		YM_PROFILE_FUNCTION()
-		VKUtils::WaitIdle();
-
-		m_MainDeletionQueue.Flush();
 
 		VulkanSwapchain::Get().Begin();
-
+		VulkanRingBuffer::Get().BeginFrame(VulkanSwapchain::Get().GetCurrentFrame());
 	}
 
 	void VulkanContext::End()
@@ -226,6 +252,37 @@ namespace YUME
 		return VulkanSwapchain::Get().GetCurrentFrameData().MainCommandBuffer.get();
 	}
 
+	CommandBuffer* VulkanContext::GetSecondaryCommandBuffer()
+	{
+		return VulkanSwapchain::Get().GetSecondaryCommandBuffer(JobSystem::GetThreadIndex());
+	}
+
+	uint32_t VulkanContext::GetFramesInFlight() const
+	{
+		return VulkanSwapchain::Get().GetFramesInFlight();
+	}
+
+	uint32_t VulkanContext::GetCurrentFrameIndex() const
+	{
+		return VulkanSwapchain::Get().GetCurrentFrame();
+	}
+
+	double VulkanContext::GetFrameWaitTimeMs() const
+	{
+		return VulkanSwapchain::Get().GetFrameWaitTimeMs();
+	}
+
+	void VulkanContext::PushFunction(const std::function<void()>& p_Function)
+	{
+		if (s_FrameQueuesReady)
+		{
+			VulkanSwapchain::Get().GetCurrentDeletionQueue().PushFunction(p_Function);
+			return;
+		}
+
+		m_MainDeletionQueue.PushFunction(p_Function);
+	}
+
 
 	void VulkanContext::CreateInstance(const char* p_Name)
 	{
@@ -264,9 +321,11 @@ namespace YUME
 		}
 		std::cout << "\n";
 
+		// Headless never initializes GLFW and doesn't need the surface extensions
 		uint32_t glfwExtensionCount = 0;
-		const char** glfwExtensions;
-		glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+		const char** glfwExtensions = nullptr;
+		if (!s_Headless)
+			glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
 		std::vector<const char*> requiredExtensions;
 
 		YM_CORE_TRACE(VULKAN_PREFIX "Searching for required extensions...")
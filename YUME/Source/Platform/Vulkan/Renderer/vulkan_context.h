@@ -28,6 +28,8 @@ namespace YUME
 			~VulkanContext() override;
 
 			void Init(const char* p_Name, void* p_Window) override;
+			// No surface or swapchain, the frames are submitted without being presented
+			void InitHeadless(const char* p_Name, uint32_t p_Width, uint32_t p_Height);
 
 			void Begin() override;
 			void End() override;
@@ -37,13 +39,17 @@ namespace YUME
 			void OnResize(uint32_t p_Width, uint32_t p_Height) override;
 
 			CommandBuffer* GetCurrentCommandBuffer() override;
+			CommandBuffer* GetSecondaryCommandBuffer() override;
 
-			static void PushFunction(const std::function<void()>& p_Function)
-			{
-				m_MainDeletionQueue.PushFunction(p_Function);
-			}
+			uint32_t GetFramesInFlight() const override;
+			uint32_t GetCurrentFrameIndex() const override;
+			double GetFrameWaitTimeMs() const override;
+
+			// Deferred until the GPU is done with the frame that is currently being recorded
+			static void PushFunction(const std::function<void()>& p_Function);
 
 			static VkInstance GetInstance() { return s_Instance; }
+			static bool IsHeadless() { return s_Headless; }
 
 		private:
 			void CreateInstance(const char* p_Name);
@@ -59,7 +65,10 @@ namespace YUME
 		#endif
 
 			GLFWwindow* m_Window = nullptr;
+			VkExtent2D m_HeadlessExtent = { 0, 0 };
 
 			static DeletionQueue m_MainDeletionQueue;
+			static bool s_FrameQueuesReady;
+			static bool s_Headless;
 	};
 }
\ No newline at end of file
@@ -26,189 +26,192 @@ namespace YUME
 		m_DescriptorsInfo = vkShader->GetDescriptorsInfo(m_Set);
 		m_SetLayout = vkShader->GetDescriptorSetLayout(m_Set);
 
-		VkDevice device = VulkanDevice::Get().GetDevice();
+		bool updateAfterBind = vkShader->IsUpdateAfterBind(m_Set);
+		m_Transient			 = p_Spec.Transient && !updateAfterBind;
 
-		VkDescriptorSetAllocateInfo allocInfo = {};
-		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-		allocInfo.descriptorPool = VulkanDevice::Get().GetDescriptorPool();
-		allocInfo.descriptorSetCount = 1;
-		allocInfo.pSetLayouts = &m_SetLayout;
+		// Transient sets are allocated on their first upload of each frame
+		if (!m_Transient)
+		{
+			m_Allocator = updateAfterBind ? VulkanDevice::Get().GetBindlessDescriptorAllocator() : VulkanDevice::Get().GetDescriptorAllocator();
+			m_Pool		= m_Allocator->Allocate(m_SetLayout, m_DescriptorSet);
+			if (m_Pool == VK_NULL_HANDLE)
+			{
+				YM_CORE_ERROR(VULKAN_PREFIX "Failed to allocate descriptor sets!")
+			}
+		}
 
-		auto res = vkAllocateDescriptorSets(device, &allocInfo, &m_DescriptorSet);
-		if ( res != VK_SUCCESS)
+		m_Dirty.resize(m_DescriptorsInfo.size(), false);
+		m_Written.resize(m_DescriptorsInfo.size());
+		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
+			m_DescriptorIndices[m_DescriptorsInfo[i].Name] = (int)i;
+
+		// Dynamic offsets are consumed in binding order
+		std::vector<int> dynamic;
+		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
 		{
-			YM_CORE_ERROR(VULKAN_PREFIX "Failed to allocate descriptor sets!")
+			if (m_DescriptorsInfo[i].Dynamic)
+				dynamic.push_back((int)i);
 		}
+		std::sort(dynamic.begin(), dynamic.end(), [this](int p_A, int p_B) { return m_DescriptorsInfo[p_A].Binding < m_DescriptorsInfo[p_B].Binding; });
+
+		m_DynamicSlots.resize(m_DescriptorsInfo.size(), -1);
+		for (size_t i = 0; i < dynamic.size(); i++)
+			m_DynamicSlots[dynamic[i]] = (int)i;
+		m_DynamicOffsets.resize(dynamic.size(), 0);
 	}
 
 	VulkanDescriptorSet::~VulkanDescriptorSet()
 	{
 		YM_PROFILE_FUNCTION()
+
+		if (m_Transient || m_DescriptorSet == VK_NULL_HANDLE)
+			return;
+
+		// Frames in flight may still use it
+		auto allocator = m_Allocator;
+		auto pool	   = m_Pool;
+		auto set	   = m_DescriptorSet;
+		VulkanContext::PushFunction([allocator, pool, set]()
+		{
+			allocator->Free(pool, set);
+		});
 	}
 
-	void VulkanDescriptorSet::SetUniformData(const std::string& p_Name, const Ref<UniformBuffer>& p_UniformBuffer)
+	DescriptorHandle VulkanDescriptorSet::GetDescriptorHandle(const std::string& p_Name) const
+	{
+		auto it = m_DescriptorIndices.find(p_Name);
+		if (it == m_DescriptorIndices.end())
+			return {};
+
+		return { it->second };
+	}
+
+	void VulkanDescriptorSet::SetUniformData(DescriptorHandle p_Handle, const Ref<UniformBuffer>& p_UniformBuffer)
 	{
 		YM_PROFILE_FUNCTION()
 
-		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
-		{
-			auto& descriptor = m_DescriptorsInfo[i];
-			if (descriptor.Name == p_Name && descriptor.Type == DescriptorType::UNIFORM_BUFFER)
-			{
-				if (descriptor.UBuffer)
-				{
-					descriptor.UBuffer.reset();
-				}
+		YM_CORE_ASSERT(p_Handle.IsValid() && p_Handle.Index < (int)m_DescriptorsInfo.size(), "Invalid descriptor handle!")
 
-				descriptor.UBuffer = p_UniformBuffer;
-				descriptor.Offset = 0;
-				descriptor.Size = VK_WHOLE_SIZE;
-				m_Queue.push_back((int)i);
-				m_MustToBeUploaded = true;
-				return;
-			}
-		}
+		auto& descriptor = m_DescriptorsInfo[p_Handle.Index];
+		YM_CORE_ASSERT(descriptor.Type == DescriptorType::UNIFORM_BUFFER, "Descriptor isn't a uniform buffer!")
 
-		YM_CORE_ERROR(VULKAN_PREFIX "Unkown name {}", p_Name)
+		descriptor.UBuffer = p_UniformBuffer;
+		descriptor.Offset = 0;
+		descriptor.Size = VK_WHOLE_SIZE;
+		MarkDirty(p_Handle.Index);
 	}
 
-	void VulkanDescriptorSet::SetUniform(const std::string& p_BufferName, const std::string& p_MemberName, void* p_Data)
+	void VulkanDescriptorSet::SetStorageData(DescriptorHandle p_Handle, const Ref<StorageBuffer>& p_StorageBuffer)
 	{
 		YM_PROFILE_FUNCTION()
 
-		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
-		{
-			auto& descriptor = m_DescriptorsInfo[i];
-			if (descriptor.Name == p_BufferName && descriptor.Type == DescriptorType::UNIFORM_BUFFER)
-			{
-				for (const auto& member : descriptor.Members)
-				{
-					if (member.Name == p_MemberName)
-					{
-						if (descriptor.UBuffer)
-						{
-							descriptor.UBuffer.reset();
-						}
-
-						descriptor.UBuffer = UniformBuffer::Create(p_Data, (uint32_t)member.Size);
-						descriptor.Offset = member.Offset;
-						descriptor.Size = member.Size;
-						m_Queue.push_back((int)i);
-						m_MustToBeUploaded = true;
-						return;
-					}
-				}
-			}
-		}
+		YM_CORE_ASSERT(p_Handle.IsValid() && p_Handle.Index < (int)m_DescriptorsInfo.size(), "Invalid descriptor handle!")
 
-		YM_CORE_ERROR(VULKAN_PREFIX "Unkown buffer name {} or member name {}", p_BufferName, p_MemberName)
+		auto& descriptor = m_DescriptorsInfo[p_Handle.Index];
+		YM_CORE_ASSERT(descriptor.Type == DescriptorType::STORAGE_BUFFER, "Descriptor isn't a storage buffer!")
+
+		descriptor.SBuffer = p_StorageBuffer;
+		descriptor.Offset = 0;
+		descriptor.Size = VK_WHOLE_SIZE;
+		MarkDirty(p_Handle.Index);
 	}
 
-	void VulkanDescriptorSet::SetUniform(const std::string& p_BufferName, const std::string& p_MemberName, void* p_Data, uint32_t p_Size)
+	void VulkanDescriptorSet::SetTexture(DescriptorHandle p_Handle, const Ref<Texture>& p_Texture)
+	{
+		SetTexture(p_Handle, &p_Texture, 1);
+	}
+
+	void VulkanDescriptorSet::SetTexture(DescriptorHandle p_Handle, const Ref<Texture>* p_TextureData, uint32_t p_Count)
 	{
 		YM_PROFILE_FUNCTION()
 
-		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
-		{
-			auto& descriptor = m_DescriptorsInfo[i];
-			if (descriptor.Name == p_BufferName && descriptor.Type == DescriptorType::UNIFORM_BUFFER)
-			{
-				for (const auto& member : descriptor.Members)
-				{
-					if (member.Name == p_MemberName)
-					{
-						if (descriptor.UBuffer)
-						{
-							descriptor.UBuffer.reset();
-						}
-
-						descriptor.UBuffer = UniformBuffer::Create(p_Data, p_Size);
-						descriptor.Offset = member.Offset;
-						descriptor.Size = p_Size;
-						m_Queue.push_back((int)i);
-						m_MustToBeUploaded = true;
-						return;
-					}
-				}
-			}
-		}
+		YM_CORE_ASSERT(p_Handle.IsValid() && p_Handle.Index < (int)m_DescriptorsInfo.size(), "Invalid descriptor handle!")
 
-		YM_CORE_ERROR(VULKAN_PREFIX "Unkown buffer name {} or member name {}", p_BufferName, p_MemberName)
+		auto& descriptor = m_DescriptorsInfo[p_Handle.Index];
+		YM_CORE_ASSERT(descriptor.Type == DescriptorType::IMAGE_SAMPLER || descriptor.Type == DescriptorType::STORAGE_IMAGE, "Descriptor isn't an image!")
+
+		descriptor.Textures.assign(p_TextureData, p_TextureData + p_Count);
+		MarkDirty(p_Handle.Index);
 	}
 
-	void VulkanDescriptorSet::SetStorageData(const std::string& p_Name, const Ref<StorageBuffer>& p_StorageBuffer)
+	void VulkanDescriptorSet::SetTextureAt(DescriptorHandle p_Handle, uint32_t p_ArrayIndex, const Ref<Texture>& p_Texture)
 	{
 		YM_PROFILE_FUNCTION()
 
-		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
-		{
-			auto& descriptor = m_DescriptorsInfo[i];
-			if (descriptor.Name == p_Name && descriptor.Type == DescriptorType::STORAGE_BUFFER)
-			{
-				if (descriptor.SBuffer)
-				{
-					descriptor.SBuffer.reset();
-				}
+		YM_CORE_ASSERT(p_Handle.IsValid() && p_Handle.Index < (int)m_DescriptorsInfo.size(), "Invalid descriptor handle!")
 
-				descriptor.SBuffer = p_StorageBuffer;
-				descriptor.Offset = 0;
-				descriptor.Size = VK_WHOLE_SIZE;
-				m_Queue.push_back((int)i);
-				m_MustToBeUploaded = true;
-				return;
-			}
+		auto& descriptor = m_DescriptorsInfo[p_Handle.Index];
+		YM_CORE_ASSERT(descriptor.Type == DescriptorType::IMAGE_SAMPLER, "Descriptor isn't a sampled image!")
+		YM_CORE_VERIFY(p_ArrayIndex < descriptor.Size, "Array index out of range!")
+		YM_CORE_ASSERT(!m_Transient, "Array elements can't be written to transient sets!")
+
+		m_ElementQueue.push_back({ p_Handle.Index, p_ArrayIndex, p_Texture });
+		m_MustToBeUploaded = true;
+	}
+
+	void VulkanDescriptorSet::SetUniformData(const std::string& p_Name, const Ref<UniformBuffer>& p_UniformBuffer)
+	{
+		auto handle = GetDescriptorHandle(p_Name);
+		if (!handle.IsValid() || m_DescriptorsInfo[handle.Index].Type != DescriptorType::UNIFORM_BUFFER)
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "Unkown name {}", p_Name)
+			return;
 		}
 
-		YM_CORE_ERROR(VULKAN_PREFIX "Unkown name {}", p_Name)
+		SetUniformData(handle, p_UniformBuffer);
 	}
 
-	void VulkanDescriptorSet::SetTexture(const std::string& p_Name, const Ref<Texture>& p_Texture)
+	void VulkanDescriptorSet::SetUniform(const std::string& p_BufferName, const std::string& p_MemberName, void* p_Data)
 	{
-		YM_PROFILE_FUNCTION()
+		SetUniformMember(p_BufferName, p_MemberName, p_Data, 0);
+	}
 
-		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
+	void VulkanDescriptorSet::SetUniform(const std::string& p_BufferName, const std::string& p_MemberName, void* p_Data, uint32_t p_Size)
+	{
+		SetUniformMember(p_BufferName, p_MemberName, p_Data, p_Size);
+	}
+
+	void VulkanDescriptorSet::SetStorageData(const std::string& p_Name, const Ref<StorageBuffer>& p_StorageBuffer)
+	{
+		auto handle = GetDescriptorHandle(p_Name);
+		if (!handle.IsValid() || m_DescriptorsInfo[handle.Index].Type != DescriptorType::STORAGE_BUFFER)
 		{
-			auto& descriptor = m_DescriptorsInfo[i];
-			if ( descriptor.Name == p_Name && 
-				(descriptor.Type == DescriptorType::IMAGE_SAMPLER || 
-				 descriptor.Type == DescriptorType::STORAGE_IMAGE))
-			{
-				descriptor.Textures.clear();
-				descriptor.Textures.push_back(p_Texture);
-				m_Queue.push_back((int)i);
-				m_MustToBeUploaded = true;
-				return;
-			}
+			YM_CORE_ERROR(VULKAN_PREFIX "Unkown name {}", p_Name)
+			return;
 		}
 
-		YM_CORE_ERROR(VULKAN_PREFIX "Unkown name {}", p_Name)
+		SetStorageData(handle, p_StorageBuffer);
 	}
 
+	void VulkanDescriptorSet::SetTexture(const std::string& p_Name, const Ref<Texture>& p_Texture)
+	{
+		SetTexture(p_Name, &p_Texture, 1);
+	}
 
 	void VulkanDescriptorSet::SetTexture(const std::string& p_Name, const Ref<Texture>* p_TextureData, uint32_t p_Count)
 	{
-		YM_PROFILE_FUNCTION()
+		auto handle = GetDescriptorHandle(p_Name);
+		if (!handle.IsValid() ||
+			(m_DescriptorsInfo[handle.Index].Type != DescriptorType::IMAGE_SAMPLER &&
+			 m_DescriptorsInfo[handle.Index].Type != DescriptorType::STORAGE_IMAGE))
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "Unkown name {}", p_Name)
+			return;
+		}
 
-		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
+		SetTexture(handle, p_TextureData, p_Count);
+	}
+
+	void VulkanDescriptorSet::SetTextureAt(const std::string& p_Name, uint32_t p_ArrayIndex, const Ref<Texture>& p_Texture)
+	{
+		auto handle = GetDescriptorHandle(p_Name);
+		if (!handle.IsValid() || m_DescriptorsInfo[handle.Index].Type != DescriptorType::IMAGE_SAMPLER)
 		{
-			auto& descriptor = m_DescriptorsInfo[i];
-			if ( descriptor.Name == p_Name &&
-				(descriptor.Type == DescriptorType::IMAGE_SAMPLER ||
-				 descriptor.Type == DescriptorType::STORAGE_IMAGE))
-			{
-				descriptor.Textures.clear();
-				descriptor.Textures.resize(p_Count);
-				for (uint32_t j = 0; j < p_Count; j++)
-				{
-					descriptor.Textures[j] = p_TextureData[j];
-				}
-				m_Queue.push_back((int)i);
-				m_MustToBeUploaded = true;
-				return;
-			}
+			YM_CORE_ERROR(VULKAN_PREFIX "Unkown name {}", p_Name)
+			return;
 		}
 
-		YM_CORE_ERROR(VULKAN_PREFIX "Unkown name {}", p_Name)
+		SetTextureAt(handle, p_ArrayIndex, p_Texture);
 	}
 
 	void VulkanDescriptorSet::Upload(CommandBuffer* p_CommandBuffer)
@@ -216,15 +219,42 @@ namespace YUME
 		YM_PROFILE_FUNCTION()
 
 		YM_CORE_ASSERT(m_SetLayout)
+
+		// A set that was already bound can't be changed until its frame is done, the changes go to a new one
+		if (m_Transient && (IsStale() || (m_Bound.load(std::memory_order_relaxed) && !m_Queue.empty())))
+			AllocateTransient();
+
 		YM_CORE_ASSERT(m_DescriptorSet)
 
-		std::vector<VkWriteDescriptorSet> descWrites;
-		std::vector<VkDescriptorBufferInfo> buffersInfo;
-		std::unordered_map<int, std::vector<VkDescriptorImageInfo>> imagesInfoMap;
+		if (m_Queue.empty() && m_ElementQueue.empty())
+		{
+			// Nothing changed since the transient set was written this frame
+			if (!m_Transient)
+			{
+				YM_CORE_ERROR(VULKAN_PREFIX "You called upload before sending data")
+			}
+
+			m_MustToBeUploaded = false;
+			return;
+		}
+
+		// Reserved up front, the writes point into these vectors
+		size_t imageCount = m_ElementQueue.size();
+		for (int index : m_Queue)
+			imageCount += m_DescriptorsInfo[index].Textures.size();
+
+		m_Writes.clear();
+		m_BufferInfos.clear();
+		m_ImageInfos.clear();
+		m_BufferInfos.reserve(m_Queue.size());
+		m_ImageInfos.reserve(imageCount);
 
 		for (int index : m_Queue)
 		{
-			auto& data = m_DescriptorsInfo[index];
+			m_Dirty[index] = false;
+
+			auto& data	  = m_DescriptorsInfo[index];
+			auto& written = m_Written[index];
 
 			VkWriteDescriptorSet descriptorWrite{};
 
@@ -235,84 +265,76 @@ namespace YUME
 			descriptorWrite.descriptorType  = VKUtils::DescriptorTypeToVk(data.Type);
 			descriptorWrite.descriptorCount = 1;
 
-			auto& bufferInfo = buffersInfo.emplace_back();
-			auto& imagesInfo = imagesInfoMap[index];
-
-			if (data.Type == DescriptorType::IMAGE_SAMPLER)
+			if (data.Type == DescriptorType::IMAGE_SAMPLER || data.Type == DescriptorType::STORAGE_IMAGE)
 			{
+				size_t first = m_ImageInfos.size();
 				for (const auto& texture : data.Textures)
 				{
-					if (!texture)
-					{
-						YM_CORE_ERROR(VULKAN_PREFIX "Texture is nullptr")
+					VkDescriptorImageInfo info{};
+					if (!GetImageInfo(texture, p_CommandBuffer, info))
 						continue;
-					}
 
-					TransitionImageToCorrectLayout(texture, p_CommandBuffer);
+					if (data.Type == DescriptorType::STORAGE_IMAGE)
+						info.sampler = VK_NULL_HANDLE;
 
-					VkImageLayout layout	  = VK_IMAGE_LAYOUT_UNDEFINED;
-					VkImageView	  view		  = VK_NULL_HANDLE;
-					VkSampler	  sampler	  = VK_NULL_HANDLE;
+					m_ImageInfos.push_back(info);
+				}
 
-					if (texture->GetType() == AssetType::Texture2D)
+				// The layout transitions above still had to run, only the write is skipped
+				size_t count   = m_ImageInfos.size() - first;
+				bool unchanged = written.Images.size() == count && std::equal(written.Images.begin(), written.Images.end(), m_ImageInfos.begin() + first,
+					[](const VkDescriptorImageInfo& p_A, const VkDescriptorImageInfo& p_B)
 					{
-						const auto& vkTexture = texture.As<VulkanTexture2D>();
-						layout				  = vkTexture->GetLayout();
-						view				  = vkTexture->GetImageView();
-						sampler				  = vkTexture->GetImageSampler();
-					}
-					else if (texture->GetType() == AssetType::TextureArray)
-					{
-						const auto& vkTexture = texture.As<VulkanTextureArray>();
-						layout				  = vkTexture->GetLayout();
-						view				  = vkTexture->GetImageView();
-						sampler				  = vkTexture->GetImageSampler();
-					}
-					else
-					{
-						YM_CORE_ERROR(VULKAN_PREFIX "Unknown texture type - Texture: {}!", texture->GetSpecification().DebugName)
-						continue;
-					}
+						return p_A.imageView == p_B.imageView && p_A.sampler == p_B.sampler && p_A.imageLayout == p_B.imageLayout;
+					});
 
-					auto& info				  = imagesInfo.emplace_back();
-					info.imageLayout		  = layout;
-					info.imageView			  = view;
-					info.sampler			  = sampler;
+				if (unchanged)
+				{
+					m_ImageInfos.resize(first);
+					continue;
 				}
 
+				written.Images.assign(m_ImageInfos.begin() + first, m_ImageInfos.end());
+
 				descriptorWrite.descriptorCount = (uint32_t)data.Size;
-				descriptorWrite.pImageInfo		= imagesInfo.data();
+				descriptorWrite.pImageInfo		= m_ImageInfos.data() + first;
 			}
-			else if (data.Type == DescriptorType::STORAGE_IMAGE)
+			else if (data.Type == DescriptorType::UNIFORM_BUFFER || data.Type == DescriptorType::STORAGE_BUFFER)
 			{
-				for (const auto& texture : data.Textures)
+				VkDescriptorBufferInfo bufferInfo{};
+				if (data.Type == DescriptorType::UNIFORM_BUFFER)
 				{
-					auto vkTexture = texture.As<VulkanTexture2D>();
-					TransitionImageToCorrectLayout(vkTexture, p_CommandBuffer);
+					auto vkBuffer	  = data.UBuffer.As<VulkanUniformBuffer>();
+					bufferInfo.buffer = vkBuffer->GetBuffer();
+					bufferInfo.offset = vkBuffer->GetBufferOffset() + data.Offset;
+					bufferInfo.range  = data.Size == VK_WHOLE_SIZE ? vkBuffer->GetSizeBytes() : data.Size;
 
-					auto& info		 = imagesInfo.emplace_back();
-					info.imageLayout = vkTexture->GetLayout();
-					info.imageView	 = vkTexture->GetImageView();
+					// The suballocation offset moves to bind time, the descriptor stays the same while the buffer does
+					if (data.Dynamic)
+					{
+						m_DynamicOffsets[m_DynamicSlots[index]] = (uint32_t)bufferInfo.offset;
+						bufferInfo.offset = 0;
+						descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+					}
+				}
+				else
+				{
+					auto vkBuffer	  = data.SBuffer.As<VulkanStorageBuffer>();
+					bufferInfo.buffer = vkBuffer->GetBuffer();
+					bufferInfo.offset = vkBuffer->GetBufferOffset() + data.Offset;
+					bufferInfo.range  = data.Size == VK_WHOLE_SIZE && vkBuffer->IsDynamic() ? vkBuffer->GetSize() : data.Size;
 				}
 
-				descriptorWrite.descriptorCount = (uint32_t)data.Size;
-				descriptorWrite.pImageInfo		= imagesInfo.data();
-			}
-			else if (data.Type == DescriptorType::UNIFORM_BUFFER)
-			{
-				bufferInfo.buffer = data.UBuffer.As<VulkanUniformBuffer>()->GetBuffer();
-				bufferInfo.offset = data.Offset;
-				bufferInfo.range  = data.Size;
+				// Static buffers are usually set again with the same range every frame
+				if (written.Buffer == bufferInfo.buffer && written.Offset == bufferInfo.offset && written.Range == bufferInfo.range)
+					continue;
 
-				descriptorWrite.pBufferInfo = &bufferInfo;
-			}
-			else if (data.Type == DescriptorType::STORAGE_BUFFER)
-			{
-				bufferInfo.buffer = data.SBuffer.As<VulkanStorageBuffer>()->GetBuffer();
-				bufferInfo.offset = data.Offset;
-				bufferInfo.range  = data.Size;
+				written.Buffer = bufferInfo.buffer;
+				written.Offset = bufferInfo.offset;
+				written.Range  = bufferInfo.range;
 
-				descriptorWrite.pBufferInfo = &bufferInfo;
+				m_BufferInfos.push_back(bufferInfo);
+				descriptorWrite.pBufferInfo = &m_BufferInfos.back();
 			}
 			else
 			{
@@ -320,18 +342,42 @@ namespace YUME
 				continue;
 			}
 
-			descWrites.push_back(descriptorWrite);
+			m_Writes.push_back(descriptorWrite);
 		}
 
-		if (descWrites.empty())
+		for (const auto& element : m_ElementQueue)
 		{
-			YM_CORE_ERROR(VULKAN_PREFIX "You called upload before sending data")
-			m_Queue.clear();
-			m_MustToBeUploaded = false;
-			return;
+			if (!element.Texture || element.Texture->GetType() != AssetType::Texture2D)
+			{
+				YM_CORE_ERROR(VULKAN_PREFIX "Only Texture2D can be written as an array element")
+				continue;
+			}
+
+			auto& info = m_ImageInfos.emplace_back();
+			if (!GetImageInfo(element.Texture, p_CommandBuffer, info))
+			{
+				m_ImageInfos.pop_back();
+				continue;
+			}
+
+			// The array no longer matches the last full write
+			m_Written[element.Descriptor].Images.clear();
+
+			VkWriteDescriptorSet descriptorWrite{};
+			descriptorWrite.sType			= VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrite.dstSet			= m_DescriptorSet;
+			descriptorWrite.dstBinding		= m_DescriptorsInfo[element.Descriptor].Binding;
+			descriptorWrite.dstArrayElement = element.ArrayIndex;
+			descriptorWrite.descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+			descriptorWrite.descriptorCount = 1;
+			descriptorWrite.pImageInfo		= &info;
+
+			m_Writes.push_back(descriptorWrite);
 		}
+		m_ElementQueue.clear();
 
-		vkUpdateDescriptorSets(VulkanDevice::Get().GetDevice(), (uint32_t)descWrites.size(), descWrites.data(), 0, nullptr);
+		if (!m_Writes.empty())
+			vkUpdateDescriptorSets(VulkanDevice::Get().GetDevice(), (uint32_t)m_Writes.size(), m_Writes.data(), 0, nullptr);
 
 		m_Queue.clear();
 		m_MustToBeUploaded = false;
@@ -341,6 +387,10 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION()
 		YM_CORE_ASSERT(!m_MustToBeUploaded, "Did you call Upload()?")
+		YM_CORE_ASSERT(!m_Transient || !IsStale(), "Transient sets have to be uploaded every frame before they are bound!")
+
+		if (m_Transient)
+			m_Bound.store(true, std::memory_order_relaxed);
 
 		auto& commandBuffer = static_cast<VulkanCommandBuffer*>(p_CommandBuffer)->GetHandle();
 
@@ -351,11 +401,125 @@ namespace YUME
 			m_Set,
 			1,
 			&m_DescriptorSet,
-			0,
-			nullptr
+			(uint32_t)m_DynamicOffsets.size(),
+			m_DynamicOffsets.data()
 		);
 	}
 
+	void VulkanDescriptorSet::MarkDirty(int p_Index)
+	{
+		if (!m_Dirty[p_Index])
+		{
+			m_Dirty[p_Index] = true;
+			m_Queue.push_back(p_Index);
+		}
+
+		m_MustToBeUploaded = true;
+	}
+
+	void VulkanDescriptorSet::SetUniformMember(const std::string& p_BufferName, const std::string& p_MemberName, const void* p_Data, uint32_t p_Size)
+	{
+		YM_PROFILE_FUNCTION()
+
+		auto handle = GetDescriptorHandle(p_BufferName);
+		if (handle.IsValid() && m_DescriptorsInfo[handle.Index].Type == DescriptorType::UNIFORM_BUFFER)
+		{
+			auto& descriptor = m_DescriptorsInfo[handle.Index];
+			for (const auto& member : descriptor.Members)
+			{
+				if (member.Name != p_MemberName)
+					continue;
+
+				// Size is overwritten once a buffer is set, the members still describe the block
+				size_t blockSize = 0;
+				for (const auto& other : descriptor.Members)
+					blockSize = std::max(blockSize, (size_t)(other.Offset + other.Size));
+
+				uint32_t size = p_Size ? p_Size : (uint32_t)member.Size;
+				YM_CORE_VERIFY(member.Offset + size <= blockSize, "Uniform member data is bigger than the block")
+
+				// The whole block lives in the frame ring buffer, a member write doesn't create a buffer anymore
+				auto& buffer = m_MemberBuffers[handle.Index];
+				if (!buffer)
+					buffer = UniformBuffer::Create((uint32_t)blockSize);
+
+				buffer->SetData(p_Data, size, (uint32_t)member.Offset);
+
+				descriptor.UBuffer = buffer;
+				descriptor.Offset = 0;
+				descriptor.Size = VK_WHOLE_SIZE;
+				MarkDirty(handle.Index);
+				return;
+			}
+		}
+
+		YM_CORE_ERROR(VULKAN_PREFIX "Unkown buffer name {} or member name {}", p_BufferName, p_MemberName)
+	}
+
+	bool VulkanDescriptorSet::IsStale() const
+	{
+		auto allocator = VulkanSwapchain::Get().GetCurrentDescriptorAllocator();
+		return m_DescriptorSet == VK_NULL_HANDLE || m_Allocator != allocator || m_ResetCount != allocator->GetResetCount();
+	}
+
+	void VulkanDescriptorSet::AllocateTransient()
+	{
+		YM_PROFILE_FUNCTION()
+
+		m_Allocator	 = VulkanSwapchain::Get().GetCurrentDescriptorAllocator();
+		YM_CORE_ASSERT(m_Allocator, "Transient sets need the swapchain frame data!")
+
+		m_ResetCount = m_Allocator->GetResetCount();
+		m_Bound.store(false, std::memory_order_relaxed);
+
+		if (m_Allocator->Allocate(m_SetLayout, m_DescriptorSet) == VK_NULL_HANDLE)
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "Failed to allocate transient descriptor set!")
+		}
+
+		// The new set holds nothing, everything set so far is written again
+		for (size_t i = 0; i < m_DescriptorsInfo.size(); i++)
+		{
+			const auto& descriptor = m_DescriptorsInfo[i];
+			m_Written[i] = {};
+
+			if (descriptor.UBuffer || descriptor.SBuffer || !descriptor.Textures.empty())
+				MarkDirty((int)i);
+		}
+	}
+
+	bool VulkanDescriptorSet::GetImageInfo(const Ref<Texture>& p_Texture, CommandBuffer* p_CommandBuffer, VkDescriptorImageInfo& p_Info)
+	{
+		if (!p_Texture)
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "Texture is nullptr")
+			return false;
+		}
+
+		TransitionImageToCorrectLayout(p_Texture, p_CommandBuffer);
+
+		if (p_Texture->GetType() == AssetType::Texture2D)
+		{
+			const auto& vkTexture = p_Texture.As<VulkanTexture2D>();
+			p_Info.imageLayout	  = vkTexture->GetLayout();
+			p_Info.imageView	  = vkTexture->GetImageView();
+			p_Info.sampler		  = vkTexture->GetImageSampler();
+			return true;
+		}
+
+		if (p_Texture->GetType() == AssetType::TextureArray)
+		{
+			const auto& vkTexture = p_Texture.As<VulkanTextureArray>();
+			p_Info.imageLayout	  = vkTexture->GetLayout();
+			p_Info.imageView	  = vkTexture->GetImageView();
+			p_Info.sampler		  = vkTexture->GetImageSampler();
+			return true;
+		}
+
+		YM_CORE_ERROR(VULKAN_PREFIX "Unknown texture type - Texture: {}!", p_Texture->GetSpecification().DebugName)
+		return false;
+	}
+
 	void VulkanDescriptorSet::TransitionImageToCorrectLayout(const Ref<Texture>& p_Texture, CommandBuffer* p_CommandBuffer)
 	{
 		YM_PROFILE_FUNCTION()
@@ -1,8 +1,12 @@
 #pragma once
 #include "YUME/Renderer/descriptor_set.h"
+#include "Platform/Vulkan/Core/vulkan_descriptor_pool.h"
 
 #include <vulkan/vulkan.h>
 
+// std
+#include <atomic>
+
 
 namespace YUME
 {
@@ -12,6 +16,14 @@ namespace YUME
 			explicit VulkanDescriptorSet(const DescriptorSpec& p_Spec);
 			~VulkanDescriptorSet() override;
 
+			DescriptorHandle GetDescriptorHandle(const std::string& p_Name) const override;
+
+			void SetUniformData(DescriptorHandle p_Handle, const Ref<UniformBuffer>& p_UniformBuffer) override;
+			void SetStorageData(DescriptorHandle p_Handle, const Ref<StorageBuffer>& p_StorageBuffer) override;
+			void SetTexture(DescriptorHandle p_Handle, const Ref<Texture>& p_Texture) override;
+			void SetTexture(DescriptorHandle p_Handle, const Ref<Texture>* p_TextureData, uint32_t p_Count) override;
+			void SetTextureAt(DescriptorHandle p_Handle, uint32_t p_ArrayIndex, const Ref<Texture>& p_Texture) override;
+
 			void SetUniformData(const std::string& p_Name, const Ref<UniformBuffer>& p_UniformBuffer) override;
 			void SetUniform(const std::string& p_BufferName, const std::string& p_MemberName, void* p_Data) override;
 			void SetUniform(const std::string& p_BufferName, const std::string& p_MemberName, void* p_Data, uint32_t p_Size) override;
@@ -20,6 +32,7 @@ namespace YUME
 
 			void SetTexture(const std::string& p_Name, const Ref<Texture>& p_Texture) override;
 			void SetTexture(const std::string& p_Name, const Ref<Texture>* p_TextureData, uint32_t p_Count) override;
+			void SetTextureAt(const std::string& p_Name, uint32_t p_ArrayIndex, const Ref<Texture>& p_Texture) override;
 
 			void Upload(CommandBuffer* p_CommandBuffer = nullptr) override;
 
@@ -28,6 +41,11 @@ namespace YUME
 
 		private:
 			void TransitionImageToCorrectLayout(const Ref<Texture>& p_Texture, CommandBuffer* p_CommandBuffer);
+			void MarkDirty(int p_Index);
+			void SetUniformMember(const std::string& p_BufferName, const std::string& p_MemberName, const void* p_Data, uint32_t p_Size);
+			bool IsStale() const;
+			void AllocateTransient();
+			bool GetImageInfo(const Ref<Texture>& p_Texture, CommandBuffer* p_CommandBuffer, VkDescriptorImageInfo& p_Info);
 
 		private:
 			VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
@@ -35,8 +53,51 @@ namespace YUME
 			int m_Set = -1;
 			VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
 			VkDescriptorSetLayout m_SetLayout = VK_NULL_HANDLE;
+
+			// Where the set came from, persistent sets are given back to that pool
+			VulkanDescriptorAllocator* m_Allocator = nullptr;
+			VkDescriptorPool m_Pool = VK_NULL_HANDLE;
+
+			// Transient sets are reallocated when their frame pool was reset or when they change after being bound
+			bool m_Transient = false;
+			uint64_t m_ResetCount = 0;
+			std::atomic<bool> m_Bound = false;
+
 			std::vector<DescriptorInfo> m_DescriptorsInfo;
+			std::unordered_map<std::string, int> m_DescriptorIndices;
+
+			// One per dynamic uniform buffer in binding order, refreshed by Upload and given to vkCmdBindDescriptorSets
+			std::vector<int> m_DynamicSlots;
+			std::vector<uint32_t> m_DynamicOffsets;
+
+			// Blocks written member by member with SetUniform, created on the first write
+			std::unordered_map<int, Ref<UniformBuffer>> m_MemberBuffers;
+
+			// Each binding is queued once, Upload skips the ones that would write what the set already holds
 			std::vector<int> m_Queue;
+			std::vector<uint8_t> m_Dirty;
+
+			struct WrittenState
+			{
+				VkBuffer Buffer = VK_NULL_HANDLE;
+				VkDeviceSize Offset = 0;
+				VkDeviceSize Range = 0;
+				std::vector<VkDescriptorImageInfo> Images;
+			};
+			std::vector<WrittenState> m_Written;
+
+			// Kept between uploads so they don't allocate every frame
+			std::vector<VkWriteDescriptorSet> m_Writes;
+			std::vector<VkDescriptorBufferInfo> m_BufferInfos;
+			std::vector<VkDescriptorImageInfo> m_ImageInfos;
+
+			struct ElementWrite
+			{
+				int Descriptor = -1;
+				uint32_t ArrayIndex = 0;
+				Ref<Texture> Texture;
+			};
+			std::vector<ElementWrite> m_ElementQueue;
 
 			bool m_MustToBeUploaded = false;
 	};
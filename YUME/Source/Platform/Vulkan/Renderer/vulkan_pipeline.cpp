@@ -280,8 +280,21 @@ namespace YUME
 
 		TransitionAttachments();
 
+		m_RenderPass->Begin(p_CommandBuffer, GetFramebuffer(), GetWidth(), GetHeight(), glm::make_vec4(m_CreateInfo.ClearColor), p_Contents);
+
+		// Only vkCmdExecuteCommands is allowed in a pass that is recorded in secondaries
+		if (p_Contents != SubpassContents::SECONDARY)
+			Bind(p_CommandBuffer);
+	}
+
+	void VulkanPipeline::Bind(CommandBuffer* p_CommandBuffer)
+	{
+		YM_PROFILE_FUNCTION()
+
 		auto commandBuffer = static_cast<VulkanCommandBuffer*>(p_CommandBuffer)->GetHandle();
 
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline);
+
 		if (m_CreateInfo.DepthBiasEnabled)
 		{
 			vkCmdSetDepthBias(commandBuffer,
@@ -289,11 +302,6 @@ namespace YUME
 				0.0f,
 				m_CreateInfo.SlopeFactor);
 		}
-
-
-		m_RenderPass->Begin(p_CommandBuffer, GetFramebuffer(), GetWidth(), GetHeight(), glm::make_vec4(m_CreateInfo.ClearColor), p_Contents);
-
-		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline);
 	}
 
 	void VulkanPipeline::End(CommandBuffer* p_CommandBuffer)
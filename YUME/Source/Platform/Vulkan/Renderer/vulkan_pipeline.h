@@ -32,6 +32,9 @@ namespace YUME
 			void Begin(CommandBuffer* p_CommandBuffer, SubpassContents p_Contents = SubpassContents::INLINE) override;
 			void End(CommandBuffer* p_CommandBuffer) override;
 
+			// Binds the pipeline and its dynamic state, also done by every secondary that continues the pass
+			void Bind(CommandBuffer* p_CommandBuffer);
+
 			void SetPolygonMode(PolygonMode p_Mode) override
 			{
 				if (m_CreateInfo.PolygonMode != p_Mode)
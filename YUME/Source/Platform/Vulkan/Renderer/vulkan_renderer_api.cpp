@@ -5,6 +5,7 @@
 #include "Platform/Vulkan/Renderer/vulkan_swapchain.h"
 #include "Platform/Vulkan/Utils/vulkan_utils.h"
 #include "vulkan_texture.h"
+#include "vulkan_storage_buffer.h"
 #include "YUME/Core/application.h"
 
 
@@ -33,6 +34,10 @@ namespace YUME
 		m_Capabilities.SupportGeometry = features.geometryShader == VK_TRUE;
 		m_Capabilities.SupportTesselation = features.tessellationShader == VK_TRUE;
 		m_Capabilities.SupportCompute = VulkanDevice::Get().SupportCompute();
+		m_Capabilities.SupportBindless = VulkanDevice::Get().SupportBindless();
+		m_Capabilities.MaxBindlessTextures = VulkanDevice::Get().GetMaxBindlessTextures();
+		m_Capabilities.SupportMultiDrawIndirect = VulkanDevice::Get().SupportMultiDrawIndirect();
+		m_Capabilities.MaxDrawIndirectCount = VulkanDevice::Get().GetMaxDrawIndirectCount();
 	}
 
 	void VulkanRendererAPI::SetViewport(float p_X, float p_Y, uint32_t p_Width, uint32_t p_Height, CommandBuffer* p_CommandBuffer)
@@ -113,6 +118,20 @@ namespace YUME
 		}
 	}
 
+	bool VulkanRendererAPI::SupportsTextureFormat(TextureFormat p_Format) const
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (Texture::IsCompressedFormat(p_Format) && VulkanDevice::Get().GetFeatures().textureCompressionBC != VK_TRUE)
+			return false;
+
+		VkFormatProperties properties;
+		vkGetPhysicalDeviceFormatProperties(VulkanDevice::Get().GetPhysicalDevice(), VKUtils::TextureFormatToVk(p_Format), &properties);
+
+		VkFormatFeatureFlags required = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+		return (properties.optimalTilingFeatures & required) == required;
+	}
+
 	void VulkanRendererAPI::SaveScreenshot(const std::string& p_OutPath, const Ref<Texture>& p_Texture, bool p_Async)
 	{
 		YM_PROFILE_FUNCTION()
@@ -362,7 +381,7 @@ namespace YUME
 		vkCmdDraw(commandBuffer, p_VertexCount, p_InstanceCount, 0, 0);
 	}
 
-	void VulkanRendererAPI::DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount)
+	void VulkanRendererAPI::DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount, uint32_t p_IndexCount, uint32_t p_FirstIndex, int32_t p_VertexOffset)
 	{
 		YM_PROFILE_FUNCTION()
 		YM_CORE_ASSERT(p_IndexBuffer)
@@ -374,7 +393,31 @@ namespace YUME
 		
 		p_IndexBuffer->Bind(p_CommandBuffer);
 
-		vkCmdDrawIndexed(commandBuffer, p_IndexBuffer->GetCount(), p_InstanceCount, 0, 0, 0);
+		uint32_t indexCount = p_IndexCount ? p_IndexCount : p_IndexBuffer->GetCount();
+		vkCmdDrawIndexed(commandBuffer, indexCount, p_InstanceCount, p_FirstIndex, p_VertexOffset, 0);
+	}
+
+	void VulkanRendererAPI::DrawIndexedIndirect(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, const Ref<StorageBuffer>& p_Commands, uint32_t p_FirstDraw, uint32_t p_DrawCount)
+	{
+		YM_PROFILE_FUNCTION()
+		YM_CORE_ASSERT(p_IndexBuffer && p_Commands)
+		YM_CORE_ASSERT(p_DrawCount <= 1 || m_Capabilities.SupportMultiDrawIndirect, "multiDrawIndirect isn't supported!")
+
+		static_assert(sizeof(DrawIndexedIndirectCommand) == sizeof(VkDrawIndexedIndirectCommand));
+
+		if (p_DrawCount == 0)
+			return;
+
+		auto& commandBuffer = static_cast<VulkanCommandBuffer*>(p_CommandBuffer)->GetHandle();
+
+		if (p_VertexBuffer != nullptr)
+			p_VertexBuffer->Bind(p_CommandBuffer);
+
+		p_IndexBuffer->Bind(p_CommandBuffer);
+
+		auto commands		= p_Commands.As<VulkanStorageBuffer>();
+		VkDeviceSize offset = commands->GetBufferOffset() + (VkDeviceSize)p_FirstDraw * sizeof(VkDrawIndexedIndirectCommand);
+		vkCmdDrawIndexedIndirect(commandBuffer, commands->GetBuffer(), offset, p_DrawCount, sizeof(VkDrawIndexedIndirectCommand));
 	}
 
 }
@@ -23,11 +23,13 @@ namespace YUME
 			void ClearRenderTarget(const Ref<Texture2D>& p_Texture, const glm::vec4& p_Value = { 0.0f, 0.0f, 0.0f, 1.0f }) override;
 
 			const Capabilities& GetCapabilities() const override { return m_Capabilities; }
+			bool SupportsTextureFormat(TextureFormat p_Format) const override;
 
 			void SaveScreenshot(const std::string& p_OutPath, const Ref<Texture>& p_Texture, bool p_Async = true) override;
 
 			void Draw(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, uint32_t p_VertexCount, uint32_t p_InstanceCount = 1) override;
-			void DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount = 1) override;
+			void DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount = 1, uint32_t p_IndexCount = 0, uint32_t p_FirstIndex = 0, int32_t p_VertexOffset = 0) override;
+			void DrawIndexedIndirect(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, const Ref<StorageBuffer>& p_Commands, uint32_t p_FirstDraw, uint32_t p_DrawCount) override;
 
 		private:
 			VulkanContext* m_Context = nullptr;
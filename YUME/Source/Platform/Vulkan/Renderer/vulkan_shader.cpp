@@ -82,6 +82,8 @@ TBuiltInResource DefaultTBuiltInResource = {
 
 namespace YUME
 {
+	static const std::filesystem::path s_CacheDirectory = "assets/cache/shaders";
+
 	namespace Utils
 	{
 		static ShaderType ShaderTypeFromString(const std::string_view& p_Type)
@@ -136,25 +138,189 @@ namespace YUME
 					return "";
 			}
 		}
+
+		// FNV-1a, stable across runs and platforms unlike std::hash
+		static uint64_t HashBytes(const void* p_Data, size_t p_Size, uint64_t p_Seed = 14695981039346656037ull)
+		{
+			auto bytes	  = (const uint8_t*)p_Data;
+			uint64_t hash = p_Seed;
+			for (size_t i = 0; i < p_Size; i++)
+			{
+				hash ^= bytes[i];
+				hash *= 1099511628211ull;
+			}
+
+			return hash;
+		}
+
+		static uint64_t HashString(std::string_view p_String, uint64_t p_Seed = 14695981039346656037ull)
+		{
+			return HashBytes(p_String.data(), p_String.size(), p_Seed);
+		}
+
+		static std::string ToHex(uint64_t p_Value, int p_Digits = 16)
+		{
+			static const char* s_Digits = "0123456789abcdef";
+
+			std::string result(p_Digits, '0');
+			for (int i = p_Digits - 1; i >= 0; i--, p_Value >>= 4)
+				result[i] = s_Digits[p_Value & 0xf];
+
+			return result;
+		}
+	}
+
+	// Everything that changes the generated SPIR-V besides the source, it is part of the cache key
+	static constexpr int							   s_ClientInputSemanticsVersion = 100;
+	static constexpr glslang::EShTargetClientVersion   s_VulkanClientVersion		 = glslang::EShTargetVulkan_1_2;
+	static constexpr glslang::EShTargetLanguageVersion s_TargetVersion				 = glslang::EShTargetSpv_1_5;
+	static constexpr int							   s_DefaultVersion				 = 100;
+	static constexpr auto							   s_Messages					 = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
+
+	// Bumped when the cache file layout or the resource limit overrides in CompileOrGetVulkanBinaries change
+	static constexpr uint32_t s_CacheMagic	 = 0x4353594D; // "MYSC"
+	static constexpr uint32_t s_CacheVersion = 1;
+
+	struct ShaderCacheHeader
+	{
+		uint32_t Magic	   = s_CacheMagic;
+		uint32_t Version   = s_CacheVersion;
+		uint64_t Hash	   = 0;
+		uint64_t WordCount = 0;
+	};
+
+	static uint64_t ComputeCacheHash(const std::string& p_Source, ShaderType p_Stage)
+	{
+		auto version		= glslang::GetVersion();
+		std::string options = std::format("glslang {}.{}.{}{} | stage {} | input {} | client {} | target {} | default {} | messages {} | limits {}",
+			version.major, version.minor, version.patch, version.flavor ? version.flavor : "",
+			(int)p_Stage, s_ClientInputSemanticsVersion, (int)s_VulkanClientVersion, (int)s_TargetVersion,
+			s_DefaultVersion, (int)s_Messages, sizeof(TBuiltInResource));
+
+		uint64_t hash = Utils::HashString(options);
+		hash		  = Utils::HashBytes(&DefaultTBuiltInResource, sizeof(TBuiltInResource), hash);
+		return Utils::HashString(p_Source, hash);
+	}
+
+	static bool ReadCachedBinary(const std::filesystem::path& p_Path, uint64_t p_Hash, std::vector<uint32_t>& p_Data)
+	{
+		std::ifstream in(p_Path, std::ios::in | std::ios::binary | std::ios::ate);
+		if (!in.is_open())
+			return false;
+
+		auto size = (size_t)in.tellg();
+		in.seekg(0, std::ios::beg);
+
+		ShaderCacheHeader header{};
+		if (size < sizeof(header) || !in.read((char*)&header, sizeof(header)))
+			return false;
+
+		if (header.Magic != s_CacheMagic || header.Version != s_CacheVersion || header.Hash != p_Hash ||
+			header.WordCount == 0 || size != sizeof(header) + header.WordCount * sizeof(uint32_t))
+		{
+			YM_CORE_WARN("Rejecting shader cache entry {}", p_Path.string())
+			return false;
+		}
+
+		p_Data.resize(header.WordCount);
+		return (bool)in.read((char*)p_Data.data(), header.WordCount * sizeof(uint32_t));
+	}
+
+	static void WriteCachedBinary(const std::filesystem::path& p_Path, uint64_t p_Hash, const std::vector<uint32_t>& p_Data)
+	{
+		// Written next to the entry and renamed, so a crash never leaves a truncated binary behind
+		auto tempPath = p_Path;
+		tempPath	  += ".tmp";
+
+		{
+			std::ofstream out(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!out.is_open())
+				return;
+
+			ShaderCacheHeader header{};
+			header.Hash		 = p_Hash;
+			header.WordCount = p_Data.size();
+
+			out.write((const char*)&header, sizeof(header));
+			out.write((const char*)p_Data.data(), p_Data.size() * sizeof(uint32_t));
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, p_Path, error);
+		if (error)
+			std::filesystem::remove(tempPath, error);
+	}
+
+	// Entries of the same shader and stage with another hash can never be hit again
+	static void RemoveStaleCacheEntries(const std::string& p_Prefix, const std::string& p_Extension, const std::filesystem::path& p_Current)
+	{
+		std::error_code error;
+		for (const auto& entry : std::filesystem::directory_iterator(s_CacheDirectory, error))
+		{
+			auto name = entry.path().filename().string();
+			if (entry.path() == p_Current || !name.starts_with(p_Prefix) || !name.ends_with(p_Extension))
+				continue;
+
+			YM_CORE_TRACE("Removing stale shader cache entry {}", name)
+			std::filesystem::remove(entry.path(), error);
+		}
 	}
 
-	static const std::filesystem::path s_CacheDirectory = "assets/cache/shaders";
 
 	VulkanShader::VulkanShader(const std::string_view& p_ShaderPath)
 		: m_FilePath(p_ShaderPath)
 	{
 		YM_PROFILE_FUNCTION()
 
+		if (!Load())
+		{
+			YM_CORE_ASSERT(false)
+		}
+	}
+
+	Ref<VulkanShader> VulkanShader::TryCreate(const std::string_view& p_ShaderPath)
+	{
+		YM_PROFILE_FUNCTION()
+
+		auto shader		   = CreateRef<VulkanShader>();
+		shader->m_FilePath = p_ShaderPath;
+
+		if (!shader->Load())
+			return nullptr;
+
+		return shader;
+	}
+
+	bool VulkanShader::Load()
+	{
+		YM_PROFILE_FUNCTION()
+
 		Utils::CreateDirectoryIfNeeded(s_CacheDirectory.string());
 
-		std::string source = ReadFile(p_ShaderPath);
-		auto shaderSources = PreProcess(source);
+		// Extract name from shaderPath
+		std::string_view shaderPath = m_FilePath;
+		auto lastSlash = shaderPath.find_last_of("/\\");
+		lastSlash = (lastSlash == std::string::npos) ? 0 : lastSlash + 1;
+		auto lastDot = shaderPath.rfind('.');
+		lastDot = (lastDot == std::string::npos) ? shaderPath.size() : lastDot;
+
+		m_Name = shaderPath.substr(lastSlash, lastDot - lastSlash);
+
+		std::string source = ReadFile(m_FilePath);
+		auto shaderSources = PreProcess(source, m_Includes);
+		if (shaderSources.empty())
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "'{}' has no shader stages", m_FilePath)
+			return false;
+		}
 
 
 		Timer timer;
 		timer.Start();
 	
-		CompileOrGetVulkanBinaries(shaderSources);
+		if (!CompileOrGetVulkanBinaries(shaderSources))
+			return false;
+
 		CreateShaderModules();
 		CreatePipelineLayout();
 
@@ -166,19 +332,17 @@ namespace YUME
 		timer.Stop();
 		YM_CORE_WARN("Shader creation took {0} ms", timer.Elapsed())
 
-		// Extract name from shaderPath
-		auto lastSlash = p_ShaderPath.find_last_of("/\\");
-		lastSlash = (lastSlash == std::string::npos) ? 0 : lastSlash + 1;
-		auto lastDot = p_ShaderPath.rfind('.');
-		lastDot = (lastDot == std::string::npos) ? p_ShaderPath.size() : lastDot;
-
-		m_Name = p_ShaderPath.substr(lastSlash, lastDot - lastSlash);
+		return true;
 	}
 
 	VulkanShader::~VulkanShader()
 	{
 		YM_PROFILE_FUNCTION()
 
+		// Never got past compiling, and may be destroyed off the main thread
+		if (m_ShaderModules.empty() && m_PipelineLayout == VK_NULL_HANDLE && m_DescriptorSetLayouts.empty())
+			return;
+
 		auto shaderModules = m_ShaderModules;
 		auto layout = m_PipelineLayout;
 		auto descriptorSetLayouts = m_DescriptorSetLayouts;
@@ -236,6 +400,88 @@ namespace YUME
 		return m_Name;
 	}
 
+	bool VulkanShader::Replace(Shader& p_Shader)
+	{
+		YM_PROFILE_FUNCTION()
+
+		auto& other = static_cast<VulkanShader&>(p_Shader);
+		if (!HasSameInterface(other))
+		{
+			YM_CORE_ERROR(VULKAN_PREFIX "'{}' changed its descriptor sets or push constants, restart to use the new version", m_FilePath)
+			return false;
+		}
+
+		// The old modules leave with p_Shader and are destroyed with it, the pipeline layout stays
+		std::swap(m_VulkanSPIRV, other.m_VulkanSPIRV);
+		std::swap(m_ShaderModules, other.m_ShaderModules);
+		std::swap(m_ShaderStages, other.m_ShaderStages);
+		m_Includes = other.m_Includes;
+
+		return true;
+	}
+
+	bool VulkanShader::HasSameInterface(const VulkanShader& p_Other) const
+	{
+		if (m_Stages != p_Other.m_Stages || m_PushConstants.size() != p_Other.m_PushConstants.size() ||
+			m_DescriptorSetLayoutBindings.size() != p_Other.m_DescriptorSetLayoutBindings.size())
+			return false;
+
+		for (size_t i = 0; i < m_PushConstants.size(); i++)
+		{
+			if (m_PushConstants[i].Size != p_Other.m_PushConstants[i].Size || m_PushConstants[i].ShaderStage != p_Other.m_PushConstants[i].ShaderStage)
+				return false;
+		}
+
+		auto SortedBindings = [](std::vector<VkDescriptorSetLayoutBinding> p_Bindings)
+		{
+			std::sort(p_Bindings.begin(), p_Bindings.end(), [](const auto& p_Lhs, const auto& p_Rhs) { return p_Lhs.binding < p_Rhs.binding; });
+			return p_Bindings;
+		};
+
+		for (const auto& [set, bindings] : m_DescriptorSetLayoutBindings)
+		{
+			auto other = p_Other.m_DescriptorSetLayoutBindings.find(set);
+			if (other == p_Other.m_DescriptorSetLayoutBindings.end() || other->second.size() != bindings.size())
+				return false;
+
+			auto lhs = SortedBindings(bindings);
+			auto rhs = SortedBindings(other->second);
+			for (size_t i = 0; i < lhs.size(); i++)
+			{
+				if (lhs[i].binding != rhs[i].binding || lhs[i].descriptorType != rhs[i].descriptorType ||
+					lhs[i].descriptorCount != rhs[i].descriptorCount || lhs[i].stageFlags != rhs[i].stageFlags)
+					return false;
+			}
+		}
+
+		// Buffers are sized and written from the reflected blocks
+		for (const auto& [set, descriptors] : m_DescriptorsInfo)
+		{
+			auto other = p_Other.m_DescriptorsInfo.find(set);
+			if (other == p_Other.m_DescriptorsInfo.end() || other->second.size() != descriptors.size())
+				return false;
+
+			for (const auto& descriptor : descriptors)
+			{
+				auto match = std::find_if(other->second.begin(), other->second.end(), [&](const DescriptorInfo& p_Info)
+				{
+					return p_Info.Binding == descriptor.Binding && p_Info.Stage == descriptor.Stage;
+				});
+
+				if (match == other->second.end() || match->Type != descriptor.Type || match->Size != descriptor.Size || match->Members.size() != descriptor.Members.size())
+					return false;
+
+				for (size_t i = 0; i < descriptor.Members.size(); i++)
+				{
+					if (match->Members[i].Offset != descriptor.Members[i].Offset || match->Members[i].Size != descriptor.Members[i].Size)
+						return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
 	void VulkanShader::SetLayout(const InputLayout& p_Layout)
 	{
 		YM_PROFILE_FUNCTION()
@@ -287,7 +533,7 @@ namespace YUME
 
 					attDesc.location = m_VertexBufferLocation;
 					attDesc.binding = m_VertexBufferBinding;
-					attDesc.format = VKUtils::DataTypeToVkFormat(element.Type);
+					attDesc.format = VKUtils::DataTypeToVkFormat(element.Type, element.Normalized);
 					attDesc.offset = element.Offset;
 
 					m_VertexBufferLocation++;
@@ -326,6 +572,23 @@ namespace YUME
 		);
 	}
 
+	void VulkanShader::BindPushConstants(CommandBuffer* p_CommandBuffer, const void* p_Data, uint32_t p_Size) const
+	{
+		auto commandBuffer = static_cast<VulkanCommandBuffer*>(p_CommandBuffer)->GetHandle();
+
+		auto& push = m_PushConstants[0];
+		YM_CORE_ASSERT(p_Size <= push.Size, "Push constant data is bigger than the block")
+
+		vkCmdPushConstants(
+			commandBuffer,
+			m_PipelineLayout,
+			m_Stages,
+			push.Offset,
+			p_Size,
+			p_Data
+		);
+	}
+
 
 	std::string VulkanShader::ReadFile(const std::string_view& p_Filepath) const
 	{
@@ -350,7 +613,7 @@ namespace YUME
 		return result;
 	}
 
-	std::string VulkanShader::ProcessIncludeFiles(const std::string& p_Code) const
+	std::string VulkanShader::ProcessIncludeFiles(const std::string& p_Code, std::vector<std::string>& p_Includes) const
 	{
 		YM_PROFILE_FUNCTION()
 
@@ -382,6 +645,9 @@ namespace YUME
 			auto path = (filepath.parent_path() / includeFilepath).string();
 			std::string includeCode = ReadFile(path);
 
+			if (std::find(p_Includes.begin(), p_Includes.end(), path) == p_Includes.end())
+				p_Includes.push_back(path);
+
 			result += includeCode;
 
 			pos = p_Code.find(includeToken, end + 1);
@@ -399,11 +665,12 @@ namespace YUME
 	}
 
 
-	VulkanShader::ShaderSource VulkanShader::PreProcess(const std::string& p_Source) const
+	VulkanShader::ShaderSource VulkanShader::PreProcess(const std::string& p_Source, std::vector<std::string>& p_Includes) const
 	{
 		YM_PROFILE_FUNCTION()
 
 		ShaderSource shaderSources;
+		p_Includes.clear();
 
 		const char* typeToken = "@type";
 		size_t typeTokenLength = strlen(typeToken);
@@ -427,14 +694,14 @@ namespace YUME
 				nextLinePos,
 				pos - (nextLinePos == std::string::npos ? p_Source.size() - 1 : nextLinePos)
 			);
-			auto newCode = ProcessIncludeFiles(code);
+			auto newCode = ProcessIncludeFiles(code, p_Includes);
 			shaderSources[Utils::ShaderTypeFromString(type)] = newCode;
 		}
 
 		return shaderSources;
 	}
 
-	void VulkanShader::CompileOrGetVulkanBinaries(const ShaderSource& p_ShaderSources)
+	bool VulkanShader::CompileOrGetVulkanBinaries(const ShaderSource& p_ShaderSources)
 	{
 		YM_PROFILE_FUNCTION()
 
@@ -442,21 +709,16 @@ namespace YUME
 		shaderData.clear();
 		for (auto&& [stage, source] : p_ShaderSources)
 		{
+			// The source already has its includes resolved, so editing an included file changes the hash too.
+			// The path hash keeps shaders with the same file name in different folders apart.
 			std::filesystem::path shaderFilePath = m_FilePath;
-			std::filesystem::path cachedPath = s_CacheDirectory / (shaderFilePath.filename().string() + Utils::ShaderStageCachedVulkanFileExtension(stage));
+			std::string extension = Utils::ShaderStageCachedVulkanFileExtension(stage);
+			std::string prefix	  = shaderFilePath.filename().string() + "." + Utils::ToHex(Utils::HashString(shaderFilePath.generic_string()), 8) + ".";
 
-			std::ifstream in(cachedPath, std::ios::in | std::ios::binary);
-			if (in.is_open())
-			{
-				in.seekg(0, std::ios::end);
-				auto size = in.tellg();
-				in.seekg(0, std::ios::beg);
+			uint64_t hash = ComputeCacheHash(source, stage);
+			std::filesystem::path cachedPath = s_CacheDirectory / (prefix + Utils::ToHex(hash) + extension);
 
-				auto& data = shaderData[stage];
-				data.resize(size / sizeof(uint32_t));
-				in.read((char*)data.data(), size);
-			}
-			else
+			if (!ReadCachedBinary(cachedPath, hash, shaderData[stage]))
 			{
 				glslang::InitializeProcess();
 
@@ -465,13 +727,9 @@ namespace YUME
 				const char* shaderStrings = source.c_str();
 				shader.setStrings(&shaderStrings, 1);
 
-				int ClientInputSemanticsVersion = 100;
-				glslang::EShTargetClientVersion VulkanClientVersion = glslang::EShTargetVulkan_1_2;
-				glslang::EShTargetLanguageVersion TargetVersion = glslang::EShTargetSpv_1_5;
-
-				shader.setEnvInput(glslang::EShSourceGlsl, shaderType, glslang::EShClientVulkan, ClientInputSemanticsVersion);
-				shader.setEnvClient(glslang::EShClientVulkan, VulkanClientVersion);
-				shader.setEnvTarget(glslang::EShTargetSpv, TargetVersion);
+				shader.setEnvInput(glslang::EShSourceGlsl, shaderType, glslang::EShClientVulkan, s_ClientInputSemanticsVersion);
+				shader.setEnvClient(glslang::EShClientVulkan, s_VulkanClientVersion);
+				shader.setEnvTarget(glslang::EShTargetSpv, s_TargetVersion);
 
 				TBuiltInResource Resources = DefaultTBuiltInResource;
 				Resources.limits.generalVaryingIndexing = true;
@@ -481,44 +739,43 @@ namespace YUME
 				Resources.limits.nonInductiveForLoops = true;
 				Resources.limits.generalSamplerIndexing = true;
 				
-				if (auto messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
-					!shader.parse(&Resources, 100, false, messages))
+				if (!shader.parse(&Resources, s_DefaultVersion, false, s_Messages))
 				{
-					YM_CORE_ERROR("GLSL Parsing Failed for shader: ")
+					YM_CORE_ERROR("GLSL Parsing Failed for shader: {}", m_FilePath)
 					YM_CORE_ERROR("{}", shader.getInfoLog())
 					YM_CORE_ERROR("{}", shader.getInfoDebugLog())
-					YM_CORE_ASSERT(false)
+					glslang::FinalizeProcess();
+					return false;
 				}
 
 				glslang::TProgram program;
 				program.addShader(&shader);
 
 
-				if (auto messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
-					!program.link(messages))
+				if (!program.link(s_Messages))
 				{
-					YM_CORE_ERROR("Program Linking Failed")
+					YM_CORE_ERROR("Program Linking Failed: {}", m_FilePath)
 					YM_CORE_ERROR("{}", program.getInfoLog())
 					YM_CORE_ERROR("{}", program.getInfoDebugLog())
-					YM_CORE_ASSERT(false)
+					glslang::FinalizeProcess();
+					return false;
 				}
 
 				std::vector<uint32_t> spirv;
 				glslang::GlslangToSpv(*program.getIntermediate(shaderType), spirv);
 
 				shaderData[stage] = spirv;
-				
-				if (std::ofstream out(cachedPath, std::ios::out | std::ios::binary);
-					out.is_open())
-				{
-					auto& data = shaderData[stage];
-					out.write((char*)data.data(), data.size() * sizeof(uint32_t));
-					out.flush();
-					out.close();
-				}
+
+				WriteCachedBinary(cachedPath, hash, shaderData[stage]);
 
 				glslang::FinalizeProcess();
 			}
+
+			RemoveStaleCacheEntries(prefix, extension, cachedPath);
+
+			// Entries from before the cache was keyed by content
+			std::error_code error;
+			std::filesystem::remove(s_CacheDirectory / (shaderFilePath.filename().string() + extension), error);
 		}
 
 		for (const auto& [stage, data] : shaderData)
@@ -526,6 +783,7 @@ namespace YUME
 			Reflect(stage, data);
 		}
 
+		return true;
 	}
 
 	void VulkanShader::Reflect(ShaderType p_Stage, const std::vector<uint32_t>& p_ShaderData)
@@ -653,6 +911,15 @@ namespace YUME
 			const auto& Type = compiler.get_type(resource.type_id);
 			auto descriptorCount = (Type.array.size() > 0) ? Type.array[0] : 1;
 
+			// Runtime sized array (sampler2D u_Textures[]), sized to the bindless limit and updated after bind
+			if (Type.array.size() > 0 && Type.array[0] == 0)
+			{
+				YM_CORE_VERIFY(VulkanDevice::Get().SupportBindless(), "Runtime sized texture arrays need descriptor indexing!")
+
+				descriptorCount = VulkanDevice::Get().GetMaxBindlessTextures();
+				m_BindlessBindings[set].push_back(binding);
+			}
+
 			YM_CORE_TRACE("  Name: {0}", resource.name)
 			YM_CORE_TRACE("    Set  = {0}", set)
 			YM_CORE_TRACE("    Binding = {0}", binding)
@@ -781,6 +1048,37 @@ namespace YUME
 
 		auto device = VulkanDevice::Get().GetDevice();
 
+		// Uniform buffers use dynamic offsets, so the descriptor only depends on the buffer and sets
+		// pointing at suballocations of the same buffer are written once. Lower sets get them first
+		// when the device limit is reached, update after bind sets can't have them.
+		std::vector<uint32_t> sets;
+		for (const auto& [set, layoutBindings] : m_DescriptorSetLayoutBindings)
+			sets.push_back(set);
+		std::sort(sets.begin(), sets.end());
+
+		uint32_t maxDynamic	  = VulkanDevice::Get().GetPhysicalDeviceStruct().Properties.limits.maxDescriptorSetUniformBuffersDynamic;
+		uint32_t dynamicCount = 0;
+		for (uint32_t set : sets)
+		{
+			if (IsUpdateAfterBind(set))
+				continue;
+
+			for (auto& layoutBinding : m_DescriptorSetLayoutBindings[set])
+			{
+				if (layoutBinding.descriptorType != VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || layoutBinding.descriptorCount != 1 || dynamicCount + 1 > maxDynamic)
+					continue;
+
+				layoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+				dynamicCount++;
+
+				for (auto& descriptor : m_DescriptorsInfo[set])
+				{
+					if (descriptor.Binding == (int)layoutBinding.binding)
+						descriptor.Dynamic = true;
+				}
+			}
+		}
+
 		std::vector<VkDescriptorSetLayout> descriptorSetLayouts;
 		for (const auto& [set, layoutBindings] : m_DescriptorSetLayoutBindings)
 		{
@@ -789,6 +1087,30 @@ namespace YUME
 			SetLayoutInfo.bindingCount = (uint32_t)layoutBindings.size();
 			SetLayoutInfo.pBindings = layoutBindings.data();
 
+			// Bindless arrays are written while the set is bound, only the slots in use have to be valid
+			std::vector<VkDescriptorBindingFlags> bindingFlags;
+			VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
+			if (auto it = m_BindlessBindings.find(set); it != m_BindlessBindings.end())
+			{
+				bindingFlags.resize(layoutBindings.size(), 0);
+				for (size_t i = 0; i < layoutBindings.size(); i++)
+				{
+					if (std::find(it->second.begin(), it->second.end(), layoutBindings[i].binding) != it->second.end())
+					{
+						bindingFlags[i] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+										  VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+										  VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+					}
+				}
+
+				bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+				bindingFlagsInfo.bindingCount = (uint32_t)bindingFlags.size();
+				bindingFlagsInfo.pBindingFlags = bindingFlags.data();
+
+				SetLayoutInfo.pNext = &bindingFlagsInfo;
+				SetLayoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+			}
+
 			VkDescriptorSetLayout layout;
 			vkCreateDescriptorSetLayout(device, &SetLayoutInfo, VK_NULL_HANDLE, &layout);
 			descriptorSetLayouts.push_back(layout);
@@ -24,18 +24,27 @@ namespace YUME
 			explicit VulkanShader(const std::string_view& p_ShaderPath);
 			~VulkanShader() override;
 
+			// nullptr when the source can't be read or doesn't compile
+			static Ref<VulkanShader> TryCreate(const std::string_view& p_ShaderPath);
+
 			void CleanUp();
 
 			void Bind() override;
 			void Unbind() override;
 
 			const std::string_view& GetName() const override;
+			const std::string& GetFilePath() const override { return m_FilePath; }
+			const std::vector<std::string>& GetIncludes() const override { return m_Includes; }
+
+			bool Replace(Shader& p_Shader) override;
 
 			void SetLayout(const InputLayout& p_Layout) override;
 
 			VkPipelineLayout& GetLayout() { return m_PipelineLayout; }
 			const std::vector<DescriptorInfo>& GetDescriptorsInfo(int p_Set) { return m_DescriptorsInfo[p_Set];  }
 			VkDescriptorSetLayout& GetDescriptorSetLayout(int p_Set) { return m_DescriptorSetLayouts[p_Set]; }
+			// The set holds a bindless array, so it must come from an update after bind pool
+			bool IsUpdateAfterBind(int p_Set) const { return m_BindlessBindings.contains(p_Set); }
 			std::vector<VkPipelineShaderStageCreateInfo>& GetShaderStages() { return m_ShaderStages; }
 
 			const std::vector<VkVertexInputAttributeDescription>& GetAttributeDescription() const { return m_AttributeDescs; }
@@ -43,21 +52,28 @@ namespace YUME
 
 			void SetPushValue(const std::string& p_Name, void* p_Value) override;
 			void BindPushConstants(CommandBuffer* p_CommandBuffer) const override;
+			void BindPushConstants(CommandBuffer* p_CommandBuffer, const void* p_Data, uint32_t p_Size) const override;
 
 		private:
+			bool Load();
+
 			std::string ReadFile(const std::string_view& p_Filepath) const;
-			std::string ProcessIncludeFiles(const std::string& p_Code) const;
-			ShaderSource PreProcess(const std::string& p_Source) const;
+			std::string ProcessIncludeFiles(const std::string& p_Code, std::vector<std::string>& p_Includes) const;
+			ShaderSource PreProcess(const std::string& p_Source, std::vector<std::string>& p_Includes) const;
 
-			void CompileOrGetVulkanBinaries(const ShaderSource& p_ShaderSources);
+			bool CompileOrGetVulkanBinaries(const ShaderSource& p_ShaderSources);
 			void Reflect(ShaderType p_Stage, const std::vector<uint32_t>& p_ShaderData);
 
 			void CreateShaderModules();
 			void CreatePipelineLayout();
 
+			// Same descriptor sets and push constants, so the layouts made for one work with the other
+			bool HasSameInterface(const VulkanShader& p_Other) const;
+
 		private:
-			std::string_view m_FilePath;
+			std::string m_FilePath;
 			std::string_view m_Name = "Untitled";
+			std::vector<std::string> m_Includes;
 			
 			std::unordered_map<ShaderType, VkShaderModule> m_ShaderModules;
 			std::vector<VkPipelineShaderStageCreateInfo> m_ShaderStages;
@@ -79,5 +95,6 @@ namespace YUME
 
 			std::unordered_map<uint32_t, std::vector<VkDescriptorSetLayoutBinding>> m_DescriptorSetLayoutBindings;
 			std::unordered_map<uint32_t, VkDescriptorSetLayout> m_DescriptorSetLayouts;
+			std::unordered_map<uint32_t, std::vector<uint32_t>> m_BindlessBindings;
 	};
 }
\ No newline at end of file
@@ -6,12 +6,21 @@
 
 namespace YUME
 {
-	VulkanStorageBuffer::VulkanStorageBuffer(size_t p_SizeBytes)
+	VulkanStorageBuffer::VulkanStorageBuffer(size_t p_SizeBytes, bool p_Dynamic)
 	{
 		YM_PROFILE_FUNCTION()
 
+		if (p_Dynamic)
+		{
+			YM_CORE_VERIFY(p_SizeBytes > 0)
+
+			m_Size = p_SizeBytes;
+			m_Dynamic = true;
+			return;
+		}
+
 		m_Buffer = CreateUnique<VulkanMemoryBuffer>(
-			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
 			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 			p_SizeBytes
 		);
@@ -22,27 +31,87 @@ namespace YUME
 		YM_PROFILE_FUNCTION()
 
 		m_Offset = p_Offset;
-		m_Size = p_SizeBytes;
-		m_Buffer->SetData(p_SizeBytes, p_Data, p_Offset);
+
+		if (!m_Dynamic)
+		{
+			m_Size = p_SizeBytes;
+			m_Buffer->SetData(p_SizeBytes, p_Data, p_Offset);
+			return;
+		}
+
+		YM_CORE_VERIFY(p_Data != nullptr && p_Offset + p_SizeBytes <= m_Size)
+
+		// Written straight into this frame's slice, so it has to happen before the draws that read it are recorded
+		if (m_Allocation.Frame != VulkanRingBuffer::Get().GetFrameCount())
+			Allocate();
+
+		memcpy((uint8_t*)m_Allocation.Mapped + p_Offset, p_Data, p_SizeBytes);
 	}
 
 	void VulkanStorageBuffer::Fill(uint32_t p_Data)
 	{
 		YM_PROFILE_FUNCTION()
 
-		m_Buffer->Fill(p_Data, m_Size);
+		Fill(p_Data, m_Size);
 	}
 
 	void VulkanStorageBuffer::Fill(uint32_t p_Data, size_t p_SizeBytes)
 	{
-		m_Buffer->Fill(p_Data, p_SizeBytes);
+		if (!m_Dynamic)
+		{
+			m_Buffer->Fill(p_Data, p_SizeBytes);
+			return;
+		}
+
+		if (m_Allocation.Frame != VulkanRingBuffer::Get().GetFrameCount())
+			Allocate();
+
+		auto data = (uint32_t*)m_Allocation.Mapped;
+		std::fill(data, data + std::min(p_SizeBytes, m_Size) / sizeof(uint32_t), p_Data);
 	}
 
 	void VulkanStorageBuffer::Resize(size_t p_SizeBytes)
 	{
 		if (p_SizeBytes > 0 && p_SizeBytes != m_Size)
 		{
+			if (m_Dynamic)
+			{
+				// The next write takes a slice of the new size
+				m_Size = p_SizeBytes;
+				m_Allocation = {};
+				return;
+			}
+
 			m_Buffer->Resize(p_SizeBytes);
 		}
 	}
+
+	VkBuffer VulkanStorageBuffer::GetBuffer()
+	{
+		if (!m_Dynamic)
+			return m_Buffer->GetBuffer();
+
+		if (m_Allocation.Frame != VulkanRingBuffer::Get().GetFrameCount())
+			Allocate();
+
+		return m_Allocation.Buffer;
+	}
+
+	VkDeviceSize VulkanStorageBuffer::GetBufferOffset()
+	{
+		if (!m_Dynamic)
+			return 0;
+
+		if (m_Allocation.Frame != VulkanRingBuffer::Get().GetFrameCount())
+			Allocate();
+
+		return m_Allocation.Offset;
+	}
+
+	void VulkanStorageBuffer::Allocate()
+	{
+		YM_PROFILE_FUNCTION()
+
+		m_Allocation = VulkanRingBuffer::Get().Allocate(m_Size);
+	}
 }
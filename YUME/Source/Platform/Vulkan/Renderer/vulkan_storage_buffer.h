@@ -1,6 +1,7 @@
 #pragma once
 #include "YUME/Renderer/storage_buffer.h"
 #include <Platform/Vulkan/Core/vulkan_memory_buffer.h>
+#include "Platform/Vulkan/Core/vulkan_ring_buffer.h"
 
 
 
@@ -9,7 +10,7 @@ namespace YUME
 	class VulkanStorageBuffer : public StorageBuffer
 	{
 		public:
-			VulkanStorageBuffer(size_t p_SizeBytes);
+			VulkanStorageBuffer(size_t p_SizeBytes, bool p_Dynamic = false);
 			~VulkanStorageBuffer() override = default;
 
 			void SetData(void* p_Data, size_t p_SizeBytes, size_t p_Offset = 0ull) override;
@@ -19,12 +20,22 @@ namespace YUME
 
 			size_t GetOffset() const override { return m_Offset; }
 			size_t GetSize() const override { return m_Size; }
-			VkBuffer GetBuffer() { return m_Buffer->GetBuffer(); }
+			bool IsDynamic() const { return m_Dynamic; }
+
+			VkBuffer GetBuffer();
+			VkDeviceSize GetBufferOffset();
+
+		private:
+			void Allocate();
 
 		private:
 			size_t m_Offset = 0ull;
 			size_t m_Size = 0ull;
+			bool m_Dynamic = false;
 
 			Unique<VulkanMemoryBuffer> m_Buffer;
+
+			// DYNAMIC usage, no CPU copy is kept since the data is rewritten every frame
+			VulkanRingAllocation m_Allocation;
 	};
-}
\ No newline at end of file
+}
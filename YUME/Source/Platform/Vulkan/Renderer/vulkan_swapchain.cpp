@@ -1,9 +1,13 @@
 #include "YUME/yumepch.h"
 #include "vulkan_swapchain.h"
 #include "Platform/Vulkan/Core/vulkan_device.h"
+#include "Platform/Vulkan/Core/vulkan_upload_service.h"
 #include "vulkan_context.h"
 #include "Platform/Vulkan/Utils/vulkan_utils.h"
 #include "vulkan_texture.h"
+#include "YUME/Core/engine.h"
+#include "YUME/Core/jobs.h"
+#include "YUME/Utils/timer.h"
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
@@ -18,13 +22,18 @@ namespace YUME
 		VKUtils::WaitIdle();
 
 		YM_CORE_TRACE(VULKAN_PREFIX "Destroying swapchain frame data...")
-		for (uint32_t i = 0; i < m_BufferCount; i++)
+		for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
 		{
-			if (m_BufferCount >= MAX_SWAPCHAIN_BUFFERS)
-				break;
+			m_Frames[i].FrameDeletionQueue.Flush();
+
+			if (!m_Frames[i].MainCommandBuffer)
+				continue;
 
 			m_Frames[i].MainCommandBuffer->Reset();
 
+			m_Frames[i].ThreadCommands.clear();
+			m_Frames[i].DescriptorAllocator->Destroy();
+			m_Frames[i].DescriptorAllocator.reset();
 			m_Frames[i].MainCommandBuffer.reset();
 			m_Frames[i].CommandPool.reset();
 			m_Frames[i].ImageAcquireSemaphore.reset();
@@ -72,6 +81,17 @@ namespace YUME
 
 		m_Vsync = p_Vsync;
 
+		if (VulkanContext::IsHeadless())
+		{
+			m_Extent2D		 = p_Extent;
+			m_FramesInFlight = std::clamp(Engine::GetFramesInFlight(), 1u, (uint32_t)MAX_FRAMES_IN_FLIGHT);
+			m_CurrentFrame	 = m_CurrentFrame % m_FramesInFlight;
+
+			CreateHeadlessBuffers();
+			CreateFrameData();
+			return;
+		}
+
 		// Surface
 		if (p_Window != nullptr && m_Surface == VK_NULL_HANDLE)
 		{
@@ -116,6 +136,9 @@ namespace YUME
 
 		YM_CORE_ASSERT(m_BufferCount > 1);
 
+		m_FramesInFlight = std::clamp(Engine::GetFramesInFlight(), 1u, (uint32_t)MAX_FRAMES_IN_FLIGHT);
+		m_CurrentFrame	 = m_CurrentFrame % m_FramesInFlight;
+
 		VkSurfaceTransformFlagBitsKHR preTransform;
 		if (surfaceCapabilities.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR)
 			preTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
@@ -173,15 +196,16 @@ namespace YUME
 		{
 			YM_CORE_TRACE(VULKAN_PREFIX "Destroying old swapchain...")
 
-			for (uint32_t i = 0; i < m_BufferCount; i++)
+			for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
 			{
-				if (i >= MAX_SWAPCHAIN_BUFFERS)
-					break;
+				if (!m_Frames[i].MainCommandBuffer)
+					continue;
 
 				if (m_Frames[i].MainCommandBuffer->GetState() == CommandBufferState::Submitted)
 					m_Frames[i].MainCommandBuffer->Wait();
 
 				m_Frames[i].MainCommandBuffer->Reset();
+				m_Frames[i].FrameDeletionQueue.Flush();
 
 				m_Frames[i].ImageAcquireSemaphore.reset();
 			}
@@ -246,10 +270,17 @@ namespace YUME
 		if (m_BufferCount == 1 && m_AcquireImageIndex != std::numeric_limits<uint32_t>::max())
 			return;
 
+		if (m_SwapChain == VK_NULL_HANDLE)
+		{
+			// Headless, each frame in flight renders into its own offscreen buffer
+			m_AcquireImageIndex = m_CurrentFrame % m_BufferCount;
+			return;
+		}
+
 		{
 			YM_PROFILE_SCOPE("vkAcquireNextImageKHR")
 			uint32_t imageIndex;
-			auto& semaphore = m_Frames[m_CurrentBuffer].ImageAcquireSemaphore->GetHandle();
+			auto& semaphore = m_Frames[m_CurrentFrame].ImageAcquireSemaphore->GetHandle();
 			auto result = vkAcquireNextImageKHR(VulkanDevice::Get().GetDevice(), m_SwapChain, UINT64_MAX, semaphore, VK_NULL_HANDLE, &imageIndex);
 
 			if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
@@ -280,6 +311,9 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION();
 
+		if (m_SwapChain == VK_NULL_HANDLE)
+			return;
+
 		VkSemaphore vkWaitSemaphores[MAX_SWAPCHAIN_BUFFERS];
 		uint32_t semaphoreCount = 0;
 
@@ -293,10 +327,10 @@ namespace YUME
 
 		if (p_WaitSemaphores.empty())
 		{
+			// The acquire semaphore is already consumed by the frame submit
 			auto& frame			= GetCurrentFrameData();
 			vkWaitSemaphores[0] = frame.MainCommandBuffer->GetSemaphore()->GetHandle();
-			vkWaitSemaphores[1] = frame.ImageAcquireSemaphore->GetHandle();
-			semaphoreCount		= 2;
+			semaphoreCount		= 1;
 		}
 
 		VkPresentInfoKHR present{};
@@ -334,7 +368,17 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION()
 
+		// Pending uploads must be on the graphics queue before the frame that uses them
+		VulkanUploadService::Get().Flush();
+
 		auto& frame = GetCurrentFrameData();
+		if (m_SwapChain == VK_NULL_HANDLE)
+		{
+			// Nothing was acquired and nothing will be presented
+			frame.MainCommandBuffer->Execute(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_NULL_HANDLE, true, false);
+			return;
+		}
+
 		frame.MainCommandBuffer->Execute(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, frame.ImageAcquireSemaphore->GetHandle(), true);
 	}
 
@@ -342,16 +386,34 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION()
 
-		m_CurrentBuffer = (m_CurrentBuffer + 1) % m_BufferCount;
+		m_CurrentFrame = (m_CurrentFrame + 1) % m_FramesInFlight;
 
-		auto& commandBuffer = GetCurrentFrameData().MainCommandBuffer;
+		auto& frame			= m_Frames[m_CurrentFrame];
+		auto& commandBuffer = frame.MainCommandBuffer;
+
+		// Only wait for the GPU to finish the last use of this frame slot,
+		// the other frames in flight keep running.
+		Timer waitTimer;
+		waitTimer.Start();
 		if (commandBuffer->GetState() == CommandBufferState::Submitted)
 		{
+			YM_PROFILE_SCOPE_T("Wait Frame Fence", Optick::Category::Wait)
 			if (!commandBuffer->Wait())
 			{
 				return;
 			}
 		}
+		m_FrameWaitTimeMs = waitTimer.Elapsed() * 1000.0;
+
+		frame.FrameDeletionQueue.Flush();
+		frame.DescriptorAllocator->Reset();
+
+		for (auto& thread : frame.ThreadCommands)
+		{
+			if (thread.CommandPool)
+				thread.CommandPool->Reset(false);
+			thread.UsedCount = 0;
+		}
 
 		commandBuffer->Reset();
 		AcquireNextImage();
@@ -360,7 +422,7 @@ namespace YUME
 		YM_PROFILE_GPU_CONTEXT(commandBuffer->GetHandle())
 		commandBuffer->Begin();
 
-		m_Buffers[m_CurrentBuffer].As<VulkanTexture2D>()->TransitionImage(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+		m_Buffers[m_AcquireImageIndex].As<VulkanTexture2D>()->TransitionImage(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, commandBuffer.get());
 	}
 
 	void VulkanSwapchain::End()
@@ -368,7 +430,8 @@ namespace YUME
 		YM_PROFILE_FUNCTION()
 
 		auto& commandBuffer = GetCurrentFrameData().MainCommandBuffer;
-		m_Buffers[m_CurrentBuffer].As<VulkanTexture2D>()->TransitionImage(VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+		VkImageLayout finalLayout = m_SwapChain != VK_NULL_HANDLE ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		m_Buffers[m_AcquireImageIndex].As<VulkanTexture2D>()->TransitionImage(finalLayout, commandBuffer.get());
 
 		commandBuffer->End();
 		QueueSubmit();
@@ -457,9 +520,36 @@ namespace YUME
 		}
 	}
 
+	void VulkanSwapchain::CreateHeadlessBuffers()
+	{
+		YM_PROFILE_FUNCTION()
+
+		m_BufferCount = m_FramesInFlight;
+
+		TextureSpecification spec{};
+		spec.Width			  = m_Extent2D.width;
+		spec.Height			  = m_Extent2D.height;
+		spec.Format			  = TextureFormat::RGBA8_SRGB;
+		spec.Usage			  = TextureUsage::TEXTURE_COLOR_ATTACHMENT;
+		spec.GenerateMips	  = false;
+		spec.AnisotropyEnable = false;
+
+		for (uint32_t i = 0; i < MAX_SWAPCHAIN_BUFFERS; i++)
+		{
+			if (i >= m_BufferCount)
+			{
+				m_Buffers[i] = nullptr;
+				continue;
+			}
+
+			spec.DebugName = "HeadlessBuffer " + std::to_string(i);
+			m_Buffers[i]   = Texture2D::Create(spec);
+		}
+	}
+
 	void VulkanSwapchain::CreateFrameData()
 	{
-		for (int i = 0; i < MAX_SWAPCHAIN_BUFFERS; i++)
+		for (uint32_t i = 0; i < m_FramesInFlight; i++)
 		{
 			m_Frames[i].ImageAcquireSemaphore = CreateUnique<VulkanSemaphore>(SemaphoreType::None);
 			if (!m_Frames[i].MainCommandBuffer)
@@ -474,7 +564,42 @@ namespace YUME
 					"SwapchainCommandBuffer Frame " + std::to_string(i)
 				);
 				m_Frames[i].MainCommandBuffer->Init(RecordingLevel::PRIMARY, m_Frames[i].CommandPool->GetHandle());
+
+				m_Frames[i].ThreadCommands.resize(JobSystem::GetWorkerCount() + 1);
+
+				m_Frames[i].DescriptorAllocator = CreateUnique<VulkanDescriptorAllocator>();
+				m_Frames[i].DescriptorAllocator->Init(64, 512, 0);
 			}
 		}
 	}
+
+	VulkanCommandBuffer* VulkanSwapchain::GetSecondaryCommandBuffer(uint32_t p_ThreadIndex)
+	{
+		YM_PROFILE_FUNCTION()
+
+		auto& frame = m_Frames[m_CurrentFrame];
+		YM_CORE_ASSERT(p_ThreadIndex < frame.ThreadCommands.size(), "Thread index out of range")
+
+		auto& thread = frame.ThreadCommands[p_ThreadIndex];
+		if (!thread.CommandPool)
+		{
+			// The whole pool is reset each frame, the buffers don't need to be reset one by one
+			int graphic = VulkanDevice::Get().GetPhysicalDeviceStruct().Indices.Graphics;
+			thread.CommandPool = CreateUnique<VulkanCommandPool>(
+				graphic,
+				VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+				"ThreadCommandPool Frame " + std::to_string(m_CurrentFrame) + " Thread " + std::to_string(p_ThreadIndex)
+			);
+		}
+
+		if (thread.UsedCount == thread.SecondaryCommandBuffers.size())
+		{
+			auto& commandBuffer = thread.SecondaryCommandBuffers.emplace_back(CreateUnique<VulkanCommandBuffer>(
+				"SecondaryCommandBuffer Frame " + std::to_string(m_CurrentFrame) + " Thread " + std::to_string(p_ThreadIndex)
+			));
+			commandBuffer->Init(RecordingLevel::SECONDARY, thread.CommandPool->GetHandle());
+		}
+
+		return thread.SecondaryCommandBuffers[thread.UsedCount++].get();
+	}
 }
\ No newline at end of file
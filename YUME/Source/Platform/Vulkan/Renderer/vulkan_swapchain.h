@@ -4,18 +4,37 @@
 #include "YUME/Renderer/texture.h"
 #include "Platform/Vulkan/Core/vulkan_commandpool.h"
 #include "Platform/Vulkan/Core/vulkan_command_buffer.h"
+#include "Platform/Vulkan/Core/vulkan_descriptor_pool.h"
 #include "Platform/Vulkan/Core/vulkan_sync.h"
 #include "YUME/Core/reference.h"
+#include "YUME/Utils/deletion_queue.h"
 
 
 
 namespace YUME
 {
+	// Command pools are externally synchronized, so every job system thread records secondaries from its own
+	struct ThreadCommandData
+	{
+		Unique<VulkanCommandPool> CommandPool;
+		std::vector<Unique<VulkanCommandBuffer>> SecondaryCommandBuffers;
+		uint32_t UsedCount = 0;
+	};
+
 	struct FrameData
 	{
 		Unique<VulkanSemaphore> ImageAcquireSemaphore;
 		Unique<VulkanCommandPool> CommandPool;
 		Unique<VulkanCommandBuffer> MainCommandBuffer;
+
+		// Indexed by JobSystem::GetThreadIndex(), reset once this frame's fence has signaled
+		std::vector<ThreadCommandData> ThreadCommands;
+
+		// Flushed once this frame's fence has signaled
+		DeletionQueue FrameDeletionQueue;
+
+		// Transient descriptor sets, reset once this frame's fence has signaled
+		Unique<VulkanDescriptorAllocator> DescriptorAllocator;
 	};
 
 
@@ -44,10 +63,19 @@ namespace YUME
 			VkExtent2D GetExtent2D() const { return m_Extent2D; }
 			VkSurfaceFormatKHR GetFormat() const { return m_Format; }
 
-			const FrameData& GetCurrentFrameData() const { return m_Frames[m_CurrentBuffer]; }
+			const FrameData& GetCurrentFrameData() const { return m_Frames[m_CurrentFrame]; }
+			DeletionQueue& GetCurrentDeletionQueue() { return m_Frames[m_CurrentFrame].FrameDeletionQueue; }
+			VulkanDescriptorAllocator* GetCurrentDescriptorAllocator() { return m_Frames[m_CurrentFrame].DescriptorAllocator.get(); }
+
+			// Only valid for the frame that is being recorded, call it from the thread that records into it
+			VulkanCommandBuffer* GetSecondaryCommandBuffer(uint32_t p_ThreadIndex);
+
+			uint32_t GetFramesInFlight() const { return m_FramesInFlight; }
+			uint32_t GetCurrentFrame() const { return m_CurrentFrame; }
+			double GetFrameWaitTimeMs() const { return m_FrameWaitTimeMs; }
 
 			uint32_t GetBufferCount() const { return m_BufferCount; }
-			uint32_t GetCurrentBuffer() const { return m_CurrentBuffer; }
+			uint32_t GetCurrentBuffer() const { return m_AcquireImageIndex; }
 			uint32_t GetImageIndex() const { return m_AcquireImageIndex; }
 			const Ref<Texture2D>* GetBuffers() const { return m_Buffers; }
 
@@ -55,16 +83,19 @@ namespace YUME
 			void ChooseSwapExtent2D(void* p_Window);
 			void ChooseSurfaceFormat();
 			void CreateFrameData();
+			void CreateHeadlessBuffers();
 
 		private:
-			FrameData				 m_Frames[MAX_SWAPCHAIN_BUFFERS];
+			FrameData				 m_Frames[MAX_FRAMES_IN_FLIGHT];
 			Ref<Texture2D>			 m_Buffers[MAX_SWAPCHAIN_BUFFERS];
 			std::vector<VkImageView> m_ImageViews;
 
 			bool	 m_Vsync				  = false;
-			uint32_t m_CurrentBuffer		  = 0;
+			uint32_t m_CurrentFrame			  = 0;
+			uint32_t m_FramesInFlight		  = 0;
 			uint32_t m_BufferCount			  = 0;
 			uint32_t m_AcquireImageIndex	  = 0;
+			double	 m_FrameWaitTimeMs		  = 0.0;
 
 			VkSurfaceKHR	   m_Surface	  = VK_NULL_HANDLE;
 			VkSwapchainKHR	   m_OldSwapChain = VK_NULL_HANDLE;
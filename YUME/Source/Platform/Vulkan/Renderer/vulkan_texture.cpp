@@ -2,6 +2,7 @@
 #include "vulkan_texture.h"
 #include "Platform/Vulkan/Core/vulkan_device.h"
 #include "Platform/Vulkan/Core/vulkan_memory_buffer.h"
+#include "Platform/Vulkan/Core/vulkan_upload_service.h"
 #include "Platform/Vulkan/Utils/vulkan_utils.h"
 #include "vulkan_context.h"
 #include "YUME/Renderer/renderer_command.h"
@@ -22,7 +23,7 @@ namespace YUME
 			p_Format == VK_FORMAT_D32_SFLOAT_S8_UINT;
 	}
 
-	static void GenerateMipmaps(VkImage p_Image, VkFormat p_Format, int32_t p_Width, int32_t p_Height, uint32_t p_MipLevels, uint32_t p_Layer = 0, uint32_t p_LayerCount = 1)
+	static void GenerateMipmaps(VkCommandBuffer p_CommandBuffer, VkImage p_Image, VkFormat p_Format, int32_t p_Width, int32_t p_Height, uint32_t p_MipLevels, uint32_t p_Layer = 0, uint32_t p_LayerCount = 1)
 	{
 		// Check if image format supports linear blitting
 		VkFormatProperties formatProperties;
@@ -34,7 +35,7 @@ namespace YUME
 			return;
 		}
 
-		VkCommandBuffer commandBuffer			  = VKUtils::BeginSingleTimeCommand();
+		VkCommandBuffer commandBuffer			  = p_CommandBuffer;
 
 		VkImageMemoryBarrier barrier{};
 		barrier.sType							  = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -111,8 +112,6 @@ namespace YUME
 			0, nullptr,
 			0, nullptr,
 			1, &barrier);
-
-		VKUtils::EndSingleTimeCommand(commandBuffer);
 	}
 
 #ifndef USE_VMA_ALLOCATOR
@@ -258,74 +257,35 @@ namespace YUME
 		return imageView;
 	}
 
+	// Shared through the device's sampler cache, textures never own their sampler
 	static VkSampler CreateImageSampler(TextureFilter p_MinFilter, TextureFilter p_MagFilter, TextureWrap  p_WrapU, TextureWrap p_WrapV, TextureWrap p_WrapW,
 		VkFormat p_Format, bool p_AnisotropyEnable, float p_MaxLod, TextureBorderColor p_BorderColorFlag, glm::vec4 p_BorderColor)
 	{
-		VkSamplerCreateInfo samplerInfo		= {};
-		samplerInfo.sType					= VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-		samplerInfo.pNext					= VK_NULL_HANDLE;
-		samplerInfo.minFilter				= VKUtils::TextureFilterToVk(p_MinFilter);
-		samplerInfo.magFilter				= VKUtils::TextureFilterToVk(p_MagFilter);
-		samplerInfo.addressModeU			= VKUtils::TextureWrapToVk(p_WrapU);
-		samplerInfo.addressModeV			= VKUtils::TextureWrapToVk(p_WrapV);
-		samplerInfo.addressModeW			= VKUtils::TextureWrapToVk(p_WrapW);
+		VulkanSamplerKey key{};
+		key.MinFilter		= VKUtils::TextureFilterToVk(p_MinFilter);
+		key.MagFilter		= VKUtils::TextureFilterToVk(p_MagFilter);
+		key.MipmapMode		= VK_SAMPLER_MIPMAP_MODE_LINEAR;
+		key.AddressModeU	= VKUtils::TextureWrapToVk(p_WrapU);
+		key.AddressModeV	= VKUtils::TextureWrapToVk(p_WrapV);
+		key.AddressModeW	= VKUtils::TextureWrapToVk(p_WrapW);
 
 		if (p_AnisotropyEnable && RendererCommand::GetCapabilities().SamplerAnisotropy)
-		{
-			samplerInfo.anisotropyEnable	= VK_TRUE;
-			auto properties					= VulkanDevice::Get().GetPhysicalDeviceStruct().Properties;
-			samplerInfo.maxAnisotropy		= properties.limits.maxSamplerAnisotropy;
-		}
-		else
-		{
-			samplerInfo.anisotropyEnable	= VK_FALSE;
-			samplerInfo.maxAnisotropy		= 1.0f;
-		}
+			key.MaxAnisotropy = VulkanDevice::Get().GetPhysicalDeviceStruct().Properties.limits.maxSamplerAnisotropy;
 
-		samplerInfo.maxLod					= p_MaxLod;
-
-		auto borderColor					= VKUtils::TextureBorderColorToVk(p_BorderColorFlag);
-		VkSamplerCustomBorderColorCreateInfoEXT borderColorCI{};
-		{
-			samplerInfo.compareEnable		= VK_FALSE;
-			samplerInfo.compareOp			= VK_COMPARE_OP_ALWAYS;
-			samplerInfo.borderColor			= borderColor;
-
-			if (borderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT)
-			{
-				borderColorCI.sType						 = VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT;
-				borderColorCI.customBorderColor.int32[0] = (int32_t)p_BorderColor.x;
-				borderColorCI.customBorderColor.int32[1] = (int32_t)p_BorderColor.y;
-				borderColorCI.customBorderColor.int32[2] = (int32_t)p_BorderColor.z;
-				borderColorCI.customBorderColor.int32[3] = (int32_t)p_BorderColor.w;
-				borderColorCI.format					 = p_Format;
-				samplerInfo.pNext						 = &borderColorCI;
-			}
-			else if (borderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT)
-			{
-				borderColorCI.sType						   = VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT;
-				borderColorCI.customBorderColor.float32[0] = p_BorderColor.x;
-				borderColorCI.customBorderColor.float32[1] = p_BorderColor.y;
-				borderColorCI.customBorderColor.float32[2] = p_BorderColor.z;
-				borderColorCI.customBorderColor.float32[3] = p_BorderColor.w;
-				borderColorCI.format					   = p_Format;
-				samplerInfo.pNext						   = &borderColorCI;
-			}
-		}
+		// The image clamps to its own mip count, so one sampler covers every mipmapped texture
+		key.MaxLod			= p_MaxLod > 0.0f ? VK_LOD_CLAMP_NONE : 0.0f;
 
-		samplerInfo.mipmapMode				= VK_SAMPLER_MIPMAP_MODE_LINEAR;
-		samplerInfo.unnormalizedCoordinates = VK_FALSE;
-		samplerInfo.mipLodBias				= 0.0f;
-		samplerInfo.minLod					= 0.0f;
+		key.CompareEnable	= false;
+		key.CompareOp		= VK_COMPARE_OP_ALWAYS;
+		key.BorderColor		= VKUtils::TextureBorderColorToVk(p_BorderColorFlag);
 
-		VkSampler sampler;
-		if (vkCreateSampler(VulkanDevice::Get().GetDevice(), &samplerInfo, VK_NULL_HANDLE, &sampler) != VK_SUCCESS)
+		if (key.BorderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT || key.BorderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT)
 		{
-			YM_CORE_ERROR(VULKAN_PREFIX "Failed to create texture sampler!")
-			return VK_NULL_HANDLE;
+			key.CustomBorderColor  = p_BorderColor;
+			key.CustomBorderFormat = p_Format;
 		}
 
-		return sampler;
+		return VulkanDevice::Get().GetSamplerCache().Get(key);
 	}
 
 	static VkImageSubresourceRange GetRange(TextureFormat p_Format)
@@ -350,6 +310,66 @@ namespace YUME
 		return range;
 	}
 
+	// One region per level covering every layer, matching the layout described by TextureSpecification::MipLevels
+	static std::vector<VkBufferImageCopy> GetMipCopyRegions(TextureFormat p_Format, uint32_t p_BytesPerPixel, uint32_t p_Width, uint32_t p_Height, uint32_t p_MipLevels, uint32_t p_LayerCount, size_t p_Size)
+	{
+		std::vector<VkBufferImageCopy> regions;
+		regions.reserve(p_MipLevels);
+
+		uint64_t offset = 0;
+		for (uint32_t level = 0; level < p_MipLevels; level++)
+		{
+			uint32_t width	   = std::max(p_Width >> level, 1u);
+			uint32_t height	   = std::max(p_Height >> level, 1u);
+			uint64_t levelSize = Texture::IsCompressedFormat(p_Format) ? Texture::GetCompressedSize(p_Format, width, height) : uint64_t(width) * height * p_BytesPerPixel;
+			levelSize		  *= p_LayerCount;
+
+			if (offset + levelSize > p_Size)
+			{
+				YM_CORE_ERROR(VULKAN_PREFIX "Texture data is smaller than its {} mip levels, only {} were uploaded", p_MipLevels, level)
+				break;
+			}
+
+			VkBufferImageCopy region{};
+			region.bufferOffset					   = offset;
+			region.imageSubresource.aspectMask	   = VK_IMAGE_ASPECT_COLOR_BIT;
+			region.imageSubresource.mipLevel	   = level;
+			region.imageSubresource.baseArrayLayer = 0;
+			region.imageSubresource.layerCount	   = p_LayerCount;
+			region.imageExtent					   = { width, height, 1 };
+
+			regions.push_back(region);
+			offset += levelSize;
+		}
+
+		return regions;
+	}
+
+	static uint32_t GetMipLevelCount(const TextureSpecification& p_Spec)
+	{
+		if (p_Spec.MipLevels > 0)
+			return p_Spec.MipLevels;
+
+		// Compressed formats can't be blit into, their mips have to come with the data
+		if (p_Spec.GenerateMips && p_Spec.Width > 1 && p_Spec.Height > 1 && !Texture::IsCompressedFormat(p_Spec.Format))
+			return static_cast<uint32_t>(std::floor(std::log2(std::max(p_Spec.Width, p_Spec.Height)))) + 1;
+
+		return 1;
+	}
+
+	static uint64_t GetImageSize(const TextureSpecification& p_Spec, uint32_t p_BytesPerPixel, uint32_t p_MipLevels)
+	{
+		uint64_t size = 0;
+		for (uint32_t level = 0; level < p_MipLevels; level++)
+		{
+			uint32_t width	= std::max(p_Spec.Width >> level, 1u);
+			uint32_t height = std::max(p_Spec.Height >> level, 1u);
+			size		   += Texture::IsCompressedFormat(p_Spec.Format) ? Texture::GetCompressedSize(p_Spec.Format, width, height) : uint64_t(width) * height * p_BytesPerPixel;
+		}
+
+		return size;
+	}
+
 	#pragma region TEXTURE_2D
 
 	VulkanTexture2D::VulkanTexture2D(const TextureSpecification& p_Spec)
@@ -373,24 +393,38 @@ namespace YUME
 
 		Init(p_Spec);
 
-		auto stagingBuffer = new VulkanMemoryBuffer(
-			VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, p_Size);
-
-		stagingBuffer->SetData(p_Size, p_Data);
-
-		TransitionImage(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		std::vector<VkBufferImageCopy> regions;
+		if (p_Spec.MipLevels > 0)
+		{
+			regions = GetMipCopyRegions(p_Spec.Format, m_Channels * m_BytesPerChannel, p_Spec.Width, p_Spec.Height, m_MipLevels, 1, p_Size);
+		}
+		else
+		{
+			VkBufferImageCopy region{};
+			region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			region.imageSubresource.layerCount = 1;
+			region.imageExtent				   = { p_Spec.Width, p_Spec.Height, 1 };
+			regions.push_back(region);
+		}
 
-		VKUtils::CopyBufferToImage(stagingBuffer->GetBuffer(), m_TextureImage, p_Spec.Width, p_Spec.Height, m_VkFormat);
+		bool generateMips = p_Spec.MipLevels == 0 && p_Spec.GenerateMips && p_Spec.Width > 1 && p_Spec.Height > 1 && m_MipLevels > 1;
+		auto image		  = m_TextureImage;
+		auto format		  = m_VkFormat;
+		auto mipLevels	  = m_MipLevels;
+		auto width		  = p_Spec.Width;
+		auto height		  = p_Spec.Height;
 
-		stagingBuffer->SetDeleteWithoutQueue(true);
-		delete stagingBuffer;
+		// Copied on the transfer queue, mips and the final layout are done on the graphics queue
+		VulkanUploadService::Get().UploadImage(m_TextureImage, GetSubresourceRange(), p_Data, p_Size, regions,
+			[=](VkCommandBuffer p_CommandBuffer)
+			{
+				if (generateMips)
+					GenerateMipmaps(p_CommandBuffer, image, format, width, height, mipLevels);
 
-		if (p_Spec.GenerateMips && p_Spec.Width > 1 && p_Spec.Height > 1 && m_MipLevels > 1)
-		{
-			GenerateMipmaps(m_TextureImage, m_VkFormat, p_Spec.Width, p_Spec.Height, m_MipLevels);
-		}
+				VKUtils::TransitionImageLayout(image, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, p_CommandBuffer, 0, mipLevels);
+			});
 
-		TransitionImage(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		m_TextureImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 	}
 
 	VulkanTexture2D::VulkanTexture2D(VkImage p_Image, VkImageView p_ImageView, VkFormat p_Format, uint32_t p_Width, uint32_t p_Height)
@@ -415,17 +449,11 @@ namespace YUME
 
 		auto image = m_TextureImage;
 		auto imageView = m_TextureImageView;
-		auto sampler = m_TextureSampler;
 
-		VulkanContext::PushFunction([imageView, sampler]()
+		VulkanContext::PushFunction([imageView]()
 		{
 			auto device = VulkanDevice::Get().GetDevice();
 
-			if (sampler != VK_NULL_HANDLE)
-			{
-				vkDestroySampler(device, sampler, VK_NULL_HANDLE);
-			}
-
 			if (imageView != VK_NULL_HANDLE)
 			{
 				vkDestroyImageView(device, imageView, VK_NULL_HANDLE);
@@ -462,21 +490,18 @@ namespace YUME
 
 		auto image = m_TextureImage;
 		auto imageView = m_TextureImageView;
-		auto sampler = m_TextureSampler;
 #ifdef USE_VMA_ALLOCATOR
 		auto alloc = m_Allocation;
-		VulkanContext::PushFunction([image, imageView, sampler, alloc]()
+		VulkanContext::PushFunction([image, imageView, alloc]()
 #else
 		auto memory = m_TextureImageMemory;
-		VulkanContext::PushFunction([image, imageView, sampler, memory]()
+		VulkanContext::PushFunction([image, imageView, memory]()
 #endif
 			{
 				YM_CORE_TRACE(VULKAN_PREFIX "Destroying texture image...")
 
 					auto device = VulkanDevice::Get().GetDevice();
 
-				vkDestroySampler(device, sampler, VK_NULL_HANDLE);
-
 				vkDestroyImageView(device, imageView, VK_NULL_HANDLE);
 
 #ifdef USE_VMA_ALLOCATOR		
@@ -514,6 +539,11 @@ namespace YUME
 	}
 
 
+	uint64_t VulkanTexture2D::GetEstimatedSize() const
+	{
+		return GetImageSize(m_Specification, m_Channels * m_BytesPerChannel, m_MipLevels);
+	}
+
 	VkImageSubresourceRange VulkanTexture2D::GetSubresourceRange() const
 	{
 		VkImageSubresourceRange range = GetRange(m_Specification.Format);
@@ -565,9 +595,9 @@ namespace YUME
 		usageFlagBits |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
 		usageFlagBits |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
-		if (p_Spec.GenerateMips && p_Spec.Width > 1 && p_Spec.Height > 1 && p_Spec.Usage == TextureUsage::TEXTURE_SAMPLED)
+		if (p_Spec.Usage == TextureUsage::TEXTURE_SAMPLED)
 		{
-			m_MipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(p_Spec.Width, p_Spec.Height)))) + 1;
+			m_MipLevels = GetMipLevelCount(p_Spec);
 		}
 
 		VkImageCreateFlags cflags = 0;
@@ -599,18 +629,12 @@ namespace YUME
 		if (p_Spec.Usage != TextureUsage::TEXTURE_STORAGE)
 		{
 			float maxLod = 0.0f;
-			if (p_Spec.GenerateMips && m_MipLevels > 1)
+			if (m_MipLevels > 1)
 			{
 				maxLod = float(m_MipLevels);
 			}
 			m_TextureSampler = CreateImageSampler(p_Spec.MinFilter, p_Spec.MagFilter, p_Spec.WrapU, p_Spec.WrapV, p_Spec.WrapW, m_VkFormat,
 				p_Spec.AnisotropyEnable, maxLod, p_Spec.BorderColorFlag, p_Spec.BorderColor);
-
-			if (!p_Spec.DebugName.empty())
-			{
-				std::string debugName = p_Spec.DebugName + " - VkSampler";
-				VKUtils::SetDebugUtilsObjectName(VulkanDevice::Get().GetDevice(), VK_OBJECT_TYPE_SAMPLER, debugName.c_str(), m_TextureSampler);
-			}
 		}
 	}
 
@@ -635,16 +659,9 @@ namespace YUME
 
 	VulkanTextureArray::VulkanTextureArray(const TextureArraySpecification& p_Spec, const uint8_t* p_Data, size_t p_Size)
 	{
-		Init(p_Spec);
-
-		auto stagingBuffer = new VulkanMemoryBuffer(
-			VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, p_Size);
-
-		stagingBuffer->SetData(p_Size, p_Data);
-
-		TransitionImage(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		YM_PROFILE_FUNCTION()
 
-		VkCommandBuffer commandBuffer						 = VKUtils::BeginSingleTimeCommand();;
+		Init(p_Spec);
 
 		std::vector<VkBufferImageCopy> bufferCopyRegions;
 		uint32_t offset										 = 0;
@@ -652,45 +669,51 @@ namespace YUME
 		auto width											 = p_Spec.Spec.Width;
 		auto height											 = p_Spec.Spec.Height;
 
-		for (uint32_t layer = 0; layer < p_Spec.Count; layer++)
+		if (p_Spec.Spec.MipLevels > 0)
 		{
-			VkBufferImageCopy bufferCopyRegion				 = {};
-			bufferCopyRegion.imageSubresource.aspectMask	 = VK_IMAGE_ASPECT_COLOR_BIT;
-			bufferCopyRegion.imageSubresource.mipLevel		 = 0;
-			bufferCopyRegion.imageSubresource.baseArrayLayer = layer;
-			bufferCopyRegion.imageSubresource.layerCount	 = 1;
-			bufferCopyRegion.imageExtent.width				 = width;
-			bufferCopyRegion.imageExtent.height				 = height;
-			bufferCopyRegion.imageExtent.depth				 = 1;
-			bufferCopyRegion.bufferOffset					 = offset;
-
-			bufferCopyRegions.push_back(bufferCopyRegion);
-
-			offset											+= width * height * m_Channels * m_BytesPerChannel;
+			bufferCopyRegions = GetMipCopyRegions(p_Spec.Spec.Format, m_Channels * m_BytesPerChannel, width, height, m_MipLevels, m_LayerCount, p_Size);
 		}
-
-		vkCmdCopyBufferToImage(
-			commandBuffer,
-			stagingBuffer->GetBuffer(),
-			m_TextureImage,
-			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-			static_cast<uint32_t>(bufferCopyRegions.size()),
-			bufferCopyRegions.data());
-
-		VKUtils::EndSingleTimeCommand(commandBuffer);
-
-		if (p_Spec.Spec.GenerateMips && width > 1 && height > 1 && m_MipLevels > 1)
+		else
 		{
-			for (uint32_t i = 0; i < m_LayerCount; i++)
+			for (uint32_t layer = 0; layer < p_Spec.Count; layer++)
 			{
-				GenerateMipmaps(m_TextureImage, m_VkFormat, width, height, m_MipLevels, i, 1);
+				VkBufferImageCopy bufferCopyRegion				 = {};
+				bufferCopyRegion.imageSubresource.aspectMask	 = VK_IMAGE_ASPECT_COLOR_BIT;
+				bufferCopyRegion.imageSubresource.mipLevel		 = 0;
+				bufferCopyRegion.imageSubresource.baseArrayLayer = layer;
+				bufferCopyRegion.imageSubresource.layerCount	 = 1;
+				bufferCopyRegion.imageExtent.width				 = width;
+				bufferCopyRegion.imageExtent.height				 = height;
+				bufferCopyRegion.imageExtent.depth				 = 1;
+				bufferCopyRegion.bufferOffset					 = offset;
+
+				bufferCopyRegions.push_back(bufferCopyRegion);
+
+				offset											+= width * height * m_Channels * m_BytesPerChannel;
 			}
 		}
 
-		TransitionImage(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		bool generateMips = p_Spec.Spec.MipLevels == 0 && p_Spec.Spec.GenerateMips && width > 1 && height > 1 && m_MipLevels > 1;
+		auto image		  = m_TextureImage;
+		auto format		  = m_VkFormat;
+		auto mipLevels	  = m_MipLevels;
+		auto layerCount	  = m_LayerCount;
 
-		stagingBuffer->SetDeleteWithoutQueue(true);
-		delete stagingBuffer;
+		VulkanUploadService::Get().UploadImage(m_TextureImage, GetSubresourceRange(), p_Data, p_Size, bufferCopyRegions,
+			[=](VkCommandBuffer p_CommandBuffer)
+			{
+				if (generateMips)
+				{
+					for (uint32_t i = 0; i < layerCount; i++)
+					{
+						GenerateMipmaps(p_CommandBuffer, image, format, width, height, mipLevels, i, 1);
+					}
+				}
+
+				VKUtils::TransitionImageLayout(image, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, p_CommandBuffer, 0, mipLevels, 0, layerCount);
+			});
+
+		m_TextureImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 	}
 
 	VulkanTextureArray::~VulkanTextureArray()
@@ -699,17 +722,11 @@ namespace YUME
 
 		auto image		= m_TextureImage;
 		auto imageView  = m_TextureImageView;
-		auto sampler	= m_TextureSampler;
 
-		VulkanContext::PushFunction([imageView, sampler]()
+		VulkanContext::PushFunction([imageView]()
 		{
 			auto device = VulkanDevice::Get().GetDevice();
 
-			if (sampler != VK_NULL_HANDLE)
-			{
-				vkDestroySampler(device, sampler, VK_NULL_HANDLE);
-			}
-
 			if (imageView != VK_NULL_HANDLE)
 			{
 				vkDestroyImageView(device, imageView, VK_NULL_HANDLE);
@@ -770,6 +787,11 @@ namespace YUME
 			TransitionImage(VK_IMAGE_LAYOUT_GENERAL);
 	}
 
+	uint64_t VulkanTextureArray::GetEstimatedSize() const
+	{
+		return GetImageSize(m_Specification.Spec, m_Channels * m_BytesPerChannel, m_MipLevels) * m_LayerCount;
+	}
+
 	VkImageSubresourceRange VulkanTextureArray::GetSubresourceRange() const
 	{
 		VkImageSubresourceRange range = GetRange(m_Specification.Spec.Format);
@@ -812,10 +834,7 @@ namespace YUME
 		usageFlagBits	   |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
 		usageFlagBits	   |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
-		if (spec.GenerateMips && spec.Width > 1 && spec.Height > 1)
-		{
-			m_MipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(spec.Width, spec.Height)))) + 1;
-		}
+		m_MipLevels			= GetMipLevelCount(spec);
 		
 		VkImageCreateFlags cFlags = VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT;
 
@@ -860,18 +879,12 @@ namespace YUME
 		if (spec.Usage != TextureUsage::TEXTURE_STORAGE)
 		{
 			float maxLod = 0.0f;
-			if (spec.GenerateMips && m_MipLevels > 1)
+			if (m_MipLevels > 1)
 			{
 				maxLod = float(m_MipLevels);
 			}
 			m_TextureSampler = CreateImageSampler(spec.MinFilter, spec.MagFilter, spec.WrapU, spec.WrapV, spec.WrapW, m_VkFormat,
 				spec.AnisotropyEnable, maxLod, spec.BorderColorFlag, spec.BorderColor);
-
-			if (!spec.DebugName.empty())
-			{
-				std::string debugName = spec.DebugName + " - VkSampler";
-				VKUtils::SetDebugUtilsObjectName(VulkanDevice::Get().GetDevice(), VK_OBJECT_TYPE_SAMPLER, debugName.c_str(), m_TextureSampler);
-			}
 		}
 	}
 
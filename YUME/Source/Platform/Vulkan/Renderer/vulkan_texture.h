@@ -28,7 +28,7 @@ namespace YUME
 			uint32_t GetWidth() const override { return m_Specification.Width; }
 			uint32_t GetHeight() const override { return m_Specification.Height; }
 			uint32_t GetChannels() const override { return m_Channels; }
-			uint64_t GetEstimatedSize() const override { return m_Specification.Width * m_Specification.Height * m_Channels * m_BytesPerChannel; }
+			uint64_t GetEstimatedSize() const override;
 			const TextureSpecification& GetSpecification() const override { return m_Specification; }
 			VkImage GetImage() { return m_TextureImage; }
 			VkImageView GetImageView() { return m_TextureImageView; }
@@ -84,7 +84,7 @@ namespace YUME
 			uint32_t GetWidth() const override { return m_Specification.Spec .Width; }
 			uint32_t GetHeight() const override { return m_Specification.Spec.Height; }
 			uint32_t GetChannels() const override { return m_Channels; }
-			uint64_t GetEstimatedSize() const override { return m_Specification.Spec.Width * m_Specification.Spec.Height * m_Channels * m_BytesPerChannel; }
+			uint64_t GetEstimatedSize() const override;
 			const TextureSpecification& GetSpecification() const override { return m_Specification.Spec; }
 			VkImage GetImage() { return m_TextureImage; }
 			VkImageView GetImageView() { return m_TextureImageView; }
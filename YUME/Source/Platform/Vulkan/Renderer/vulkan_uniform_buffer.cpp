@@ -13,33 +13,84 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION()
 
+		YM_CORE_VERIFY(p_SizeBytes > 0)
+
 		m_SizeBytes = p_SizeBytes;
-		m_Buffer = CreateUnique<VulkanMemoryBuffer>(
-			VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-			p_SizeBytes
-		);
+		m_Dynamic = true;
+		m_Data.resize(p_SizeBytes, 0);
 	}
 
 	VulkanUniformBuffer::VulkanUniformBuffer(const void* p_Data, uint32_t p_SizeBytes)
 	{
 		YM_PROFILE_FUNCTION()
 
-		m_Buffer = CreateUnique<VulkanMemoryBuffer>(
-			VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-			p_SizeBytes
-		);
+		m_SizeBytes = p_SizeBytes;
+		m_Block = VulkanUniformArena::Get().Allocate(p_SizeBytes);
 
-		m_Buffer->SetData(p_SizeBytes, p_Data, 0);
+		VulkanUniformArena::Get().Upload(m_Block, p_Data, p_SizeBytes);
+	}
+
+	VulkanUniformBuffer::~VulkanUniformBuffer()
+	{
+		if (!m_Dynamic)
+			VulkanUniformArena::Get().Free(m_Block);
 	}
 
 	void VulkanUniformBuffer::SetData(const void* p_Data, uint32_t p_SizeBytes, uint32_t p_Offset)
 	{
 		YM_PROFILE_FUNCTION()
 
-		m_SizeBytes = p_SizeBytes;
 		m_Offset = p_Offset;
-		m_Buffer->SetData(p_SizeBytes, p_Data, (uint64_t)p_Offset);
+
+		if (!m_Dynamic)
+		{
+			// Doesn't fit the block anymore, move to a bigger one
+			if (p_Offset + p_SizeBytes > m_Block.Size)
+			{
+				VulkanUniformArena::Get().Free(m_Block);
+
+				m_SizeBytes = p_Offset + p_SizeBytes;
+				m_Block		= VulkanUniformArena::Get().Allocate(m_SizeBytes);
+			}
+
+			VulkanUniformArena::Get().Upload(m_Block, p_Data, p_SizeBytes, p_Offset);
+			return;
+		}
+
+		YM_CORE_VERIFY(p_Data != nullptr && p_Offset + p_SizeBytes <= m_SizeBytes)
+
+		// Every update gets a fresh slice, draws recorded earlier this frame keep reading the old one
+		memcpy(m_Data.data() + p_Offset, p_Data, p_SizeBytes);
+		Commit();
+	}
+
+	VkBuffer VulkanUniformBuffer::GetBuffer()
+	{
+		if (!m_Dynamic)
+			return m_Block.Buffer;
+
+		if (m_Allocation.Frame != VulkanRingBuffer::Get().GetFrameCount())
+			Commit();
+
+		return m_Allocation.Buffer;
+	}
+
+	VkDeviceSize VulkanUniformBuffer::GetBufferOffset()
+	{
+		if (!m_Dynamic)
+			return m_Block.Offset;
+
+		if (m_Allocation.Frame != VulkanRingBuffer::Get().GetFrameCount())
+			Commit();
+
+		return m_Allocation.Offset;
+	}
+
+	void VulkanUniformBuffer::Commit()
+	{
+		YM_PROFILE_FUNCTION()
+
+		m_Allocation = VulkanRingBuffer::Get().Allocate(m_SizeBytes);
+		memcpy(m_Allocation.Mapped, m_Data.data(), m_SizeBytes);
 	}
-}
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "YUME/Renderer/uniform_buffer.h"
-#include "Platform/Vulkan/Core/vulkan_memory_buffer.h"
+#include "Platform/Vulkan/Core/vulkan_ring_buffer.h"
+#include "Platform/Vulkan/Core/vulkan_uniform_arena.h"
 
 // Lib
 #include <vulkan/vulkan.h>
@@ -13,18 +14,30 @@ namespace YUME
 		public:
 			VulkanUniformBuffer(uint32_t p_SizeBytes);
 			VulkanUniformBuffer(const void* p_Data, uint32_t p_SizeBytes);
-			~VulkanUniformBuffer() override = default;
+			~VulkanUniformBuffer() override;
 
 			void SetData(const void* p_Data, uint32_t p_SizeBytes, uint32_t p_Offset = 0) override;
 			
 			uint32_t GetOffset() const override { return m_Offset; }
 			uint32_t GetSizeBytes() const { return m_SizeBytes; }
-			VkBuffer GetBuffer() { return m_Buffer->GetBuffer(); }
+			bool IsDynamic() const { return m_Dynamic; }
+
+			VkBuffer GetBuffer();
+			VkDeviceSize GetBufferOffset();
+
+		private:
+			void Commit();
 
 		private:
 			uint32_t m_Offset = 0;
 			uint32_t m_SizeBytes = 0;
+			bool m_Dynamic = false;
+
+			// STATIC usage is a block of the shared uniform arena
+			VulkanUniformAllocation m_Block;
 
-			Unique<VulkanMemoryBuffer> m_Buffer;
+			// DYNAMIC usage lives in the frame ring buffer, m_Data keeps the last contents
+			std::vector<uint8_t> m_Data;
+			VulkanRingAllocation m_Allocation;
 	};
 }
\ No newline at end of file
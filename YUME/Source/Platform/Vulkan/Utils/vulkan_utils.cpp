@@ -2,6 +2,7 @@
 #include "vulkan_utils.h"
 
 #include "Platform/Vulkan/Core/vulkan_device.h"
+#include "Platform/Vulkan/Core/vulkan_upload_service.h"
 #include "Platform/Vulkan/Renderer/vulkan_context.h"
 #include "YUME/Core/application.h"
 #include "Platform/Vulkan/Core/vulkan_command_buffer.h"
@@ -450,6 +451,8 @@ namespace YUME::VKUtils
 
 		vkEndCommandBuffer(p_CommandBuffer);
 
+		VulkanUploadService::Get().Flush();
+
 		VkSubmitInfo submitInfo = {};
 		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 		submitInfo.commandBufferCount = 1;
@@ -484,9 +487,19 @@ namespace YUME::VKUtils
 			case RGB8_SRGB:			 return VK_FORMAT_R8G8B8_SRGB;
 
 			case RGBA8_SRGB:		 return VK_FORMAT_R8G8B8A8_SRGB;
+			case RGBA8_UNORM:		 return VK_FORMAT_R8G8B8A8_UNORM;
 			case RGBA16_FLOAT:		 return VK_FORMAT_R16G16B16A16_SFLOAT;
 			case RGBA32_FLOAT:		 return VK_FORMAT_R32G32B32A32_SFLOAT;
 
+			case BC1_SRGB:			 return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+			case BC1_UNORM:			 return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+			case BC3_SRGB:			 return VK_FORMAT_BC3_SRGB_BLOCK;
+			case BC3_UNORM:			 return VK_FORMAT_BC3_UNORM_BLOCK;
+			case BC4_UNORM:			 return VK_FORMAT_BC4_UNORM_BLOCK;
+			case BC5_UNORM:			 return VK_FORMAT_BC5_UNORM_BLOCK;
+			case BC7_SRGB:			 return VK_FORMAT_BC7_SRGB_BLOCK;
+			case BC7_UNORM:			 return VK_FORMAT_BC7_UNORM_BLOCK;
+
 			case D16_UNORM:			 return VK_FORMAT_D16_UNORM;
 			case D32_FLOAT:			 return VK_FORMAT_D32_SFLOAT;
 			case D16_UNORM_S8_UINT:  return VK_FORMAT_D16_UNORM_S8_UINT;
@@ -512,18 +525,27 @@ namespace YUME::VKUtils
 			case R32_UINT:
 			case R32_FLOAT:
 			case R16_FLOAT:
+			case BC4_UNORM:
 				return 1;
 
 			case RG8_SRGB:
 			case RG32_UINT:
+			case BC5_UNORM:
 				return 2;
 
 			case RGB8_SRGB:
 				return 3;
 
 			case RGBA8_SRGB:
+			case RGBA8_UNORM:
 			case RGBA16_FLOAT:
 			case RGBA32_FLOAT:
+			case BC1_SRGB:
+			case BC1_UNORM:
+			case BC3_SRGB:
+			case BC3_UNORM:
+			case BC7_SRGB:
+			case BC7_UNORM:
 				return 4;
 
 			case D16_UNORM:
@@ -553,6 +575,18 @@ namespace YUME::VKUtils
 			case R8_UINT:
 			case RGB8_SRGB:
 			case RGBA8_SRGB:
+			case RGBA8_UNORM:
+				return 1;
+
+			// Not meaningful per texel, see Texture::GetCompressedSize
+			case BC1_SRGB:
+			case BC1_UNORM:
+			case BC3_SRGB:
+			case BC3_UNORM:
+			case BC4_UNORM:
+			case BC5_UNORM:
+			case BC7_SRGB:
+			case BC7_UNORM:
 				return 1;
 
 			case RGBA16_FLOAT:
@@ -738,7 +772,7 @@ namespace YUME::VKUtils
 		}
 	}
 
-	VkFormat DataTypeToVkFormat(DataType p_Type)
+	VkFormat DataTypeToVkFormat(DataType p_Type, bool p_Normalized)
 	{
 		switch (p_Type)
 		{
@@ -762,12 +796,28 @@ namespace YUME::VKUtils
 
 			case Bool:   return VK_FORMAT_R8_UINT;
 
+			case Half2:  return VK_FORMAT_R16G16_SFLOAT;
+			case Short2: return p_Normalized ? VK_FORMAT_R16G16_SNORM : VK_FORMAT_R16G16_SINT;
+			case UByte4: return p_Normalized ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_UINT;
+
 			default:
 				YM_CORE_ASSERT(false, "Unknown DataType!")
 				return (VkFormat)0;
 		}
 	}
 
+	VkIndexType IndexTypeToVk(IndexType p_Type)
+	{
+		switch (p_Type)
+		{
+			case IndexType::UINT16: return VK_INDEX_TYPE_UINT16;
+			case IndexType::UINT32: return VK_INDEX_TYPE_UINT32;
+			default:
+				YM_CORE_ASSERT(false, "Unknown IndexType!")
+				return VK_INDEX_TYPE_UINT32;
+		}
+	}
+
 	VkSubpassContents SubpassContentsToVk(SubpassContents p_Contents)
 	{
 		switch (p_Contents)
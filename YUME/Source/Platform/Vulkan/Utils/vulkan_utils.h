@@ -29,7 +29,8 @@ namespace YUME::VKUtils
 	VkImageUsageFlags TextureUsageToVk(TextureUsage p_Usage);
 	VkShaderStageFlagBits ShaderTypeToVK(ShaderType p_Type);
 	VkDescriptorType DescriptorTypeToVk(DescriptorType p_Type);
-	VkFormat DataTypeToVkFormat(DataType p_Type);
+	VkFormat DataTypeToVkFormat(DataType p_Type, bool p_Normalized = false);
+	VkIndexType IndexTypeToVk(IndexType p_Type);
 	VkSubpassContents SubpassContentsToVk(SubpassContents p_Contents);
 
 	void TransitionImageLayout(const VkImage& p_Image, VkFormat p_Format, VkImageLayout p_CurrentLayout, VkImageLayout p_NewLayout, VkCommandBuffer p_CommandBuffer = nullptr, uint32_t p_BaseMipLevel = 0, uint32_t p_MipLevels = 1, uint32_t p_Layer = 0, uint32_t p_LayerCount = 1);
@@ -9,10 +9,13 @@
 #include "YUME/Utils/clock.h"
 
 #include "YUME/Core/engine.h"
+#include "YUME/Core/jobs.h"
+#include "YUME/Debug/profiler.h"
 
 #include "YUME/Renderer/renderpass.h"
 #include "YUME/Renderer/framebuffer.h"
 #include "YUME/Renderer/pipeline.h"
+#include "YUME/Renderer/shader_reloader.h"
 
 #include <iostream>
 #include <imgui/imgui.h>
@@ -24,7 +27,7 @@ namespace YUME
 {
 	Application* Application::s_Instance = nullptr;
 
-	Application::Application()
+	Application::Application(const WindowProps& p_Props)
 	{
 		YM_PROFILE_FUNCTION()
 
@@ -32,24 +35,41 @@ namespace YUME
 		s_Instance = this;
 
 		Engine::Init();
+		JobSystem::Init();
 
-		WindowProps props{};
-		props.Title = "Sandbox";
-		props.Width = 1360;
-		props.Height = 766;
+	#ifndef YM_DIST
+		// Before the renderer creates its shaders, they are only watched if created after this
+		ShaderReloader::Init("assets/shaders");
+	#endif
 
-		m_Window = std::unique_ptr<Window>(Window::Create(props));
+		// e.g. YM_TRACE_FRAMES=120 writes yume_trace.json after the first 120 frames
+		if (const char* traceFrames = std::getenv("YM_TRACE_FRAMES"))
+		{
+			Profiler::BeginCapture("yume_trace.json", (uint32_t)std::max(std::atoi(traceFrames), 1));
+		}
+
+		m_Window = std::unique_ptr<Window>(Window::Create(p_Props));
 		m_Window->SetEventCallback(YM_BIND_EVENT_FN(Application::OnEvent));
 
 		RendererCommand::Init(m_Window->GetContext());
 		Renderer::Init();
 
-		m_ImGuiLayer = ImGuiLayer::Create();
-		PushOverlay(m_ImGuiLayer);
+		// There is no swapchain to draw the UI into
+		if (!m_Window->IsHeadless())
+		{
+			m_ImGuiLayer = ImGuiLayer::Create();
+			PushOverlay(m_ImGuiLayer);
+		}
 	}
 
 	Application::~Application()
 	{
+		// Jobs may still own GPU resources
+		JobSystem::Shutdown();
+
+		// Holds the compiled shaders that were never swapped in
+		ShaderReloader::Shutdown();
+
 		Pipeline::ClearCache();
 		Framebuffer::ClearCache();
 		RenderPass::ClearCache();
@@ -65,6 +85,8 @@ namespace YUME
 
 	void Application::Run()
 	{
+		YM_PROFILE_THREAD("Main Thread")
+
 		while (m_Running)
 		{
 			YM_PROFILE_FRAME("Application::MainLoop")
@@ -83,7 +105,7 @@ namespace YUME
 					m_FPSCounter = 0;
 				}
 
-				if (m_ReloadImGui)
+				if (m_ReloadImGui && m_ImGuiLayer)
 				{
 					// TODO: 
 
@@ -103,12 +125,15 @@ namespace YUME
 				for (auto& layer : m_LayerStack)
 					layer->OnUpdate(timestep);
 
-				m_ImGuiLayer->Begin();
+				if (m_ImGuiLayer)
 				{
-					for (Layer* layer : m_LayerStack)
-						layer->OnImGuiRender();
+					m_ImGuiLayer->Begin();
+					{
+						for (Layer* layer : m_LayerStack)
+							layer->OnImGuiRender();
+					}
+					m_ImGuiLayer->End();
 				}
-				m_ImGuiLayer->End();
 
 				//YM_CORE_INFO("FPS -> {}", (int)m_FPS)
 
@@ -121,6 +146,9 @@ namespace YUME
 
 			m_Window->OnUpdate();
 
+			// Between frames, so the new code is only used by the pipelines of the next one
+			ShaderReloader::Update();
+
 			Pipeline::DeleteUnusedCache();
 			Framebuffer::DeleteUnusedCache();
 			RenderPass::DeleteUnusedCache();
@@ -15,10 +15,12 @@ namespace YUME
 	class YM_API Application
 	{
 		public:
-			Application();
+			explicit Application(const WindowProps& p_Props = WindowProps("Sandbox", 1360, 766));
 			virtual ~Application();
 
 			void Run();
+			// Leaves the main loop after the current frame
+			void Close() { m_Running = false; }
 
 			void PushLayer(Layer* p_Layer);
 			void PushOverlay(Layer* p_Overlay);
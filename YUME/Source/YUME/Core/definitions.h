@@ -11,6 +11,8 @@ namespace YUME
 	static constexpr uint8_t  MAX_FRAMES_IN_FLIGHT					  = 3;
 	static constexpr uint8_t  MAX_SWAPCHAIN_BUFFERS					  = 3;
 	static constexpr uint8_t  MAX_RENDER_TARGETS					  = 4;
+	static constexpr uint32_t RING_BUFFER_FRAME_SIZE				  = 8 * 1024 * 1024; // Per frame in flight
+	static constexpr uint32_t UNIFORM_ARENA_PAGE_SIZE				  = 1 * 1024 * 1024;
 
 	// Descriptor set limits
 	static constexpr uint16_t DESCRIPTOR_MAX_SETS					  = 1024;
@@ -21,6 +23,7 @@ namespace YUME
 	static constexpr uint16_t DESCRIPTOR_MAX_CONSTANT_BUFFERS_DYNAMIC = 1024;
 	static constexpr uint16_t DESCRIPTOR_MAX_SAMPLERS				  = 1024;
 	static constexpr uint16_t DESCRIPTOR_MAX_TEXTURES				  = 1024;
+	static constexpr uint32_t DESCRIPTOR_MAX_BINDLESS_TEXTURES		  = 4096; // Clamped to the device limit
 
 
 
@@ -160,9 +163,21 @@ namespace YUME
 		RGB8_SRGB,
 
 		RGBA8_SRGB,
+		RGBA8_UNORM,
 		RGBA16_FLOAT,
 		RGBA32_FLOAT,
 
+		// Block compressed Format, 4x4 texel blocks
+
+		BC1_SRGB,
+		BC1_UNORM,
+		BC3_SRGB,
+		BC3_UNORM,
+		BC4_UNORM,
+		BC5_UNORM,
+		BC7_SRGB,
+		BC7_UNORM,
+
 		// Depth Format
 
 		D16_UNORM,
@@ -181,7 +196,15 @@ namespace YUME
 		Mat3, Mat4,
 		UInt, UInt2,
 		Int, Int2, Int3, Int4,
-		Bool
+		Bool,
+		// Packed vertex attributes, InputElement::Normalized reads Short2/UByte4 as snorm/unorm
+		Half2, Short2, UByte4
+	};
+
+	enum class IndexType : uint8_t
+	{
+		UINT16 = 0,
+		UINT32
 	};
 
 	enum class DescriptorType : uint8_t
@@ -249,6 +272,8 @@ namespace YUME
 		std::string Name;
 		DescriptorType Type;
 		ShaderType Stage;
+		// Uniform buffer bound with a dynamic offset, the offset is given when the set is bound
+		bool Dynamic = false;
 
 		std::vector<MemberInfo> Members;
 	};
@@ -18,4 +18,9 @@ namespace YUME
 		if (s_Instance != nullptr)
 			delete s_Instance;
 	}
+
+	void Engine::SetFramesInFlight(uint32_t p_Count)
+	{
+		s_Instance->m_FramesInFlight = std::clamp(p_Count, 1u, (uint32_t)MAX_FRAMES_IN_FLIGHT);
+	}
 }
@@ -17,11 +17,16 @@ namespace YUME
 			static RenderAPI GetAPI() { return s_Instance->m_API; }
 			static void SetAPI(RenderAPI p_API) { s_Instance->m_API = p_API; }
 
+			// Clamped to [1, MAX_FRAMES_IN_FLIGHT], applied when the swapchain is (re)created
+			static uint32_t GetFramesInFlight() { return s_Instance->m_FramesInFlight; }
+			static void SetFramesInFlight(uint32_t p_Count);
+
 		private:
 			Engine() = default;
 
 		private:
 			static Engine* s_Instance;
 			RenderAPI m_API = RenderAPI::Vulkan;
+			uint32_t m_FramesInFlight = 2;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,283 @@
+#include "YUME/yumepch.h"
+#include "jobs.h"
+
+// std
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+
+
+
+namespace YUME
+{
+	// The owner pushes and pops at the back, other threads steal from the front
+	struct JobQueue
+	{
+		std::mutex Mutex;
+		std::deque<JobFunction> Jobs;
+
+		void Push(JobFunction&& p_Job)
+		{
+			std::scoped_lock<std::mutex> lock(Mutex);
+			Jobs.push_back(std::move(p_Job));
+		}
+
+		bool Pop(JobFunction& p_Job)
+		{
+			std::scoped_lock<std::mutex> lock(Mutex);
+			if (Jobs.empty())
+				return false;
+
+			p_Job = std::move(Jobs.back());
+			Jobs.pop_back();
+			return true;
+		}
+
+		bool Steal(JobFunction& p_Job)
+		{
+			std::scoped_lock<std::mutex> lock(Mutex);
+			if (Jobs.empty())
+				return false;
+
+			p_Job = std::move(Jobs.front());
+			Jobs.pop_front();
+			return true;
+		}
+	};
+
+	struct JobSystemData
+	{
+		std::vector<std::thread> Workers;
+		std::vector<Unique<JobQueue>> Queues; // [0] main thread, [1..N] workers
+
+		std::atomic<uint32_t> PendingJobs = 0;
+		std::atomic<bool> Running		  = false;
+
+		std::mutex WakeMutex;
+		std::condition_variable WakeCondition;
+	};
+
+	static JobSystemData s_Data;
+	static thread_local uint32_t s_ThreadIndex = 0;
+
+
+	void JobCounter::Increment(uint32_t p_Value)
+	{
+		m_Count.fetch_add(p_Value, std::memory_order_acq_rel);
+	}
+
+	void JobCounter::Decrement()
+	{
+		// Registered before the count can reach zero, waiters keep waiting until it is released
+		m_Finishing.fetch_add(1);
+
+		if (m_Count.fetch_sub(1) == 1)
+		{
+			std::vector<JobFunction> continuations;
+			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
+				continuations.swap(m_Continuations);
+			}
+
+			for (auto& job : continuations)
+				JobSystem::Schedule(std::move(job));
+		}
+
+		// Last use of the counter, it may be destroyed right after
+		m_Finishing.fetch_sub(1);
+	}
+
+
+	void JobSystem::Init(uint32_t p_WorkerCount)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_ASSERT(!s_Data.Running, "JobSystem already initialized")
+
+		if (p_WorkerCount == 0)
+		{
+			uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			p_WorkerCount			 = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		YM_CORE_TRACE("Creating job system with {} workers...", p_WorkerCount)
+
+		s_Data.Running = true;
+
+		s_Data.Queues.clear();
+		for (uint32_t i = 0; i <= p_WorkerCount; i++)
+			s_Data.Queues.push_back(CreateUnique<JobQueue>());
+
+		s_ThreadIndex = 0;
+		for (uint32_t i = 1; i <= p_WorkerCount; i++)
+			s_Data.Workers.emplace_back(&JobSystem::WorkerLoop, i);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (!s_Data.Running)
+			return;
+
+		YM_CORE_TRACE("Destroying job system...")
+
+		// Finish everything that was queued, jobs may still be scheduling continuations
+		while (s_Data.PendingJobs.load(std::memory_order_acquire) > 0)
+		{
+			if (!RunPendingJob())
+				std::this_thread::yield();
+		}
+
+		{
+			std::scoped_lock<std::mutex> lock(s_Data.WakeMutex);
+			s_Data.Running = false;
+		}
+		s_Data.WakeCondition.notify_all();
+
+		for (auto& worker : s_Data.Workers)
+			worker.join();
+
+		s_Data.Workers.clear();
+		s_Data.Queues.clear();
+	}
+
+	void JobSystem::Execute(const JobFunction& p_Job, JobCounter* p_Counter, JobCounter* p_Dependency)
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (p_Counter)
+			p_Counter->Increment();
+
+		JobFunction job = [p_Job, p_Counter]()
+		{
+			p_Job();
+
+			if (p_Counter)
+				p_Counter->Decrement();
+		};
+
+		if (p_Dependency)
+		{
+			// The count and not IsDone, a job that reached zero takes the continuations after this lock
+			std::unique_lock<std::mutex> lock(p_Dependency->m_Mutex);
+			if (p_Dependency->m_Count.load() != 0)
+			{
+				p_Dependency->m_Continuations.push_back(std::move(job));
+				return;
+			}
+		}
+
+		Schedule(std::move(job));
+	}
+
+	void JobSystem::ParallelFor(uint32_t p_Count, uint32_t p_GroupSize, const std::function<void(uint32_t p_Index)>& p_Function, JobCounter* p_Counter)
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (p_Count == 0)
+			return;
+
+		p_GroupSize = std::max(p_GroupSize, 1u);
+
+		JobCounter localCounter;
+		JobCounter* counter = p_Counter ? p_Counter : &localCounter;
+
+		for (uint32_t start = 0; start < p_Count; start += p_GroupSize)
+		{
+			uint32_t end = std::min(start + p_GroupSize, p_Count);
+
+			Execute([start, end, p_Function]()
+			{
+				for (uint32_t i = start; i < end; i++)
+					p_Function(i);
+			}, counter);
+		}
+
+		if (!p_Counter)
+			Wait(localCounter);
+	}
+
+	void JobSystem::Wait(const JobCounter& p_Counter)
+	{
+		YM_PROFILE_FUNCTION()
+
+		while (!p_Counter.IsDone())
+		{
+			if (!RunPendingJob())
+				std::this_thread::yield();
+		}
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return (uint32_t)s_Data.Workers.size();
+	}
+
+	uint32_t JobSystem::GetThreadIndex()
+	{
+		return s_ThreadIndex;
+	}
+
+	void JobSystem::Schedule(JobFunction&& p_Job)
+	{
+		if (!s_Data.Running)
+		{
+			// Nothing to run it on, keep the call synchronous
+			p_Job();
+			return;
+		}
+
+		s_Data.PendingJobs.fetch_add(1, std::memory_order_acq_rel);
+		s_Data.Queues[s_ThreadIndex]->Push(std::move(p_Job));
+
+		{
+			std::scoped_lock<std::mutex> lock(s_Data.WakeMutex);
+		}
+		s_Data.WakeCondition.notify_one();
+	}
+
+	bool JobSystem::RunPendingJob()
+	{
+		if (s_Data.Queues.empty())
+			return false;
+
+		JobFunction job;
+		bool found		= s_Data.Queues[s_ThreadIndex]->Pop(job);
+
+		uint32_t count	= (uint32_t)s_Data.Queues.size();
+		for (uint32_t i = 1; i < count && !found; i++)
+		{
+			found = s_Data.Queues[(s_ThreadIndex + i) % count]->Steal(job);
+		}
+
+		if (!found)
+			return false;
+
+		s_Data.PendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+		job();
+
+		return true;
+	}
+
+	void JobSystem::WorkerLoop(uint32_t p_ThreadIndex)
+	{
+		s_ThreadIndex = p_ThreadIndex;
+
+		std::string name = "Worker " + std::to_string(p_ThreadIndex);
+		YM_PROFILE_THREAD(name.c_str())
+
+		while (true)
+		{
+			if (RunPendingJob())
+				continue;
+
+			std::unique_lock<std::mutex> lock(s_Data.WakeMutex);
+			s_Data.WakeCondition.wait(lock, []() { return !s_Data.Running || s_Data.PendingJobs.load(std::memory_order_acquire) > 0; });
+
+			if (!s_Data.Running)
+				break;
+		}
+	}
+}
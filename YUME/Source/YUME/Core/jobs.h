@@ -0,0 +1,73 @@
+#pragma once
+#include "YUME/Core/base.h"
+
+// std
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+
+
+namespace YUME
+{
+	using JobFunction = std::function<void()>;
+
+	// Number of jobs still pending, jobs scheduled with a dependency run when it reaches zero
+	class YM_API JobCounter
+	{
+		friend class JobSystem;
+
+		public:
+			JobCounter() = default;
+			~JobCounter() = default;
+
+			// Also waits for the last job to be done with the counter, so it can be destroyed once this returns true
+			bool IsDone() const { return m_Count.load() == 0 && m_Finishing.load() == 0; }
+			uint32_t GetCount() const { return m_Count.load(std::memory_order_acquire); }
+
+		private:
+			void Increment(uint32_t p_Value = 1);
+			void Decrement();
+
+		private:
+			std::atomic<uint32_t> m_Count = 0;
+			// Jobs inside Decrement, the one that reaches zero still uses the mutex and continuations
+			std::atomic<uint32_t> m_Finishing = 0;
+
+			std::mutex m_Mutex;
+			std::vector<JobFunction> m_Continuations;
+
+			YM_NONCOPYABLEANDMOVE(JobCounter)
+	};
+
+	class YM_API JobSystem
+	{
+		friend class JobCounter;
+
+		public:
+			// 0 uses one worker per hardware thread, minus the main thread
+			static void Init(uint32_t p_WorkerCount = 0);
+			static void Shutdown();
+
+			// p_Counter is incremented now and decremented when the job finishes.
+			// If p_Dependency is set the job is only queued once it is done.
+			static void Execute(const JobFunction& p_Job, JobCounter* p_Counter = nullptr, JobCounter* p_Dependency = nullptr);
+
+			// Splits [0, p_Count) into groups of p_GroupSize indices, one job per group.
+			// Without a counter the call blocks until every index has been processed.
+			static void ParallelFor(uint32_t p_Count, uint32_t p_GroupSize, const std::function<void(uint32_t p_Index)>& p_Function, JobCounter* p_Counter = nullptr);
+
+			// Runs other jobs while waiting, so it is safe to call from inside a job
+			static void Wait(const JobCounter& p_Counter);
+
+			static uint32_t GetWorkerCount();
+
+			// 0 for the main thread (and any thread the system doesn't own), 1..N for workers
+			static uint32_t GetThreadIndex();
+
+		private:
+			static void Schedule(JobFunction&& p_Job);
+			static bool RunPendingJob();
+			static void WorkerLoop(uint32_t p_ThreadIndex);
+	};
+}
@@ -23,11 +23,14 @@ namespace YUME
 		std::string Title;
 		uint32_t Width;
 		uint32_t Height;
+		// No GLFW window or surface, frames are only rendered offscreen
+		bool Headless;
 
 		WindowProps(const std::string& title = "YUME Engine",
 			uint32_t width = 800,
-			uint32_t height = 600)
-			: Title(title), Width(width), Height(height)
+			uint32_t height = 600,
+			bool headless = false)
+			: Title(title), Width(width), Height(height), Headless(headless)
 		{
 		}
 	};
@@ -58,6 +61,7 @@ namespace YUME
 			virtual bool IsVSync() const = 0;
 
 			virtual void* GetNativeWindow() const = 0;
+			virtual bool IsHeadless() const { return false; }
 			virtual const std::vector<Resolution>& GetResolutions() = 0;
 
 			virtual void SetCursorMode(CursorMode p_Mode) = 0;
@@ -8,12 +8,38 @@
 	#define YM_PROFILE_FUNCTION() OPTICK_EVENT();
 	#define YM_PROFILE_SCOPE_T(NAME, CATEGORY) OPTICK_CATEGORY(NAME, CATEGORY);
 	#define YM_PROFILE_SCOPE(NAME) YM_PROFILE_SCOPE_T(NAME, Optick::Category::Debug);
+	#define YM_PROFILE_THREAD(NAME) OPTICK_THREAD(NAME);
 	#define YM_PROFILE_SHUTDOWN() OPTICK_SHUTDOWN();
 	#define YM_PROFILE_GPU_INIT_VULKAN(DEVICES, PHYSICAL_DEVICES, CMD_QUEUES, CMD_QUEUES_FAMILY, NUM_CMD_QUEUS, FUNCTIONS) OPTICK_GPU_INIT_VULKAN(DEVICES, PHYSICAL_DEVICES, CMD_QUEUES, CMD_QUEUES_FAMILY, NUM_CMD_QUEUS, FUNCTIONS);
 	#define YM_PROFILE_GPU_CONTEXT(cmdBuffer) OPTICK_GPU_CONTEXT(cmdBuffer);
 	#define YM_PROFILE_GPU_FLIP(swapchain) OPTICK_GPU_FLIP(swapchain);
 	#define YM_PROFILE_TAG(NAME, ...) OPTICK_TAG(NAME, ##__VA_ARGS__);
 
+#elif defined(YM_PROFILE)
+
+	// Built-in recorder, see YUME/Debug/profiler.h
+	#include "YUME/Debug/profiler.h"
+
+	#define YM_PROFILE_CONCAT_IMPL(A, B) A##B
+	#define YM_PROFILE_CONCAT(A, B) YM_PROFILE_CONCAT_IMPL(A, B)
+
+	#if defined(__GNUC__) || defined(__clang__)
+		#define YM_PROFILE_FUNCTION_NAME __PRETTY_FUNCTION__
+	#else
+		#define YM_PROFILE_FUNCTION_NAME __FUNCSIG__
+	#endif
+
+	#define YM_PROFILE_FRAME(NAME, ...) ::YUME::Profiler::BeginFrame(); ::YUME::ProfileScope YM_PROFILE_CONCAT(ym_profile_scope_, __LINE__)(NAME);
+	#define YM_PROFILE_FUNCTION() ::YUME::ProfileScope YM_PROFILE_CONCAT(ym_profile_scope_, __LINE__)(YM_PROFILE_FUNCTION_NAME);
+	#define YM_PROFILE_SCOPE_T(NAME, CATEGORY) ::YUME::ProfileScope YM_PROFILE_CONCAT(ym_profile_scope_, __LINE__)(NAME);
+	#define YM_PROFILE_SCOPE(NAME) YM_PROFILE_SCOPE_T(NAME, 0)
+	#define YM_PROFILE_THREAD(NAME) ::YUME::Profiler::SetThreadName(NAME);
+	#define YM_PROFILE_SHUTDOWN() ::YUME::Profiler::Shutdown();
+	#define YM_PROFILE_GPU_INIT_VULKAN(DEVICES, PHYSICAL_DEVICES, CMD_QUEUES, CMD_QUEUES_FAMILY, NUM_CMD_QUEUS, FUNCTIONS)
+	#define YM_PROFILE_GPU_CONTEXT(cmdBuffer)
+	#define YM_PROFILE_GPU_FLIP(swapchain)
+	#define YM_PROFILE_TAG(NAME, ...)
+
 #else
 
 	#ifdef USE_OPTICK
@@ -25,6 +51,7 @@
 	#define YM_PROFILE_FUNCTION()
 	#define YM_PROFILE_SCOPE_T(NAME, CATEGORY)
 	#define YM_PROFILE_SCOPE(NAME)
+	#define YM_PROFILE_THREAD(NAME)
 	#define YM_PROFILE_SHUTDOWN()
 	#define YM_PROFILE_GPU_INIT_VULKAN(DEVICES, PHYSICAL_DEVICES, CMD_QUEUES, CMD_QUEUES_FAMILY, NUM_CMD_QUEUS, FUNCTIONS)
 	#define YM_PROFILE_GPU_CONTEXT(cmdBuffer)
@@ -0,0 +1,230 @@
+#include "YUME/yumepch.h"
+#include "profiler.h"
+
+// std
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+
+
+
+namespace YUME
+{
+	static constexpr uint32_t s_MaxEventsPerThread = 1 << 18;
+
+	struct ProfileEvent
+	{
+		const char* Name = nullptr;
+		uint64_t StartNs = 0;
+		uint64_t EndNs	 = 0;
+	};
+
+	// Only the owning thread writes, Count is published after the event so the writer can read it at any time
+	struct ThreadBuffer
+	{
+		uint32_t ThreadID = 0;
+		std::string Name;
+
+		std::unique_ptr<ProfileEvent[]> Events;
+		std::atomic<uint32_t> Count	  = 0;
+		std::atomic<uint32_t> Dropped = 0;
+		std::atomic<uint64_t> Session = 0;
+	};
+
+	struct ProfilerData
+	{
+		std::mutex Mutex;
+		std::vector<Unique<ThreadBuffer>> Buffers;
+
+		std::string Path;
+		uint32_t FramesRequested = 0;
+		uint32_t FramesRecorded	 = 0;
+		bool Pending			 = false;
+
+		std::atomic<uint64_t> Session = 0;
+		uint64_t StartNs			  = 0;
+	};
+
+	static ProfilerData s_Data;
+	static thread_local ThreadBuffer* s_ThreadBuffer = nullptr;
+
+	std::atomic<bool> Profiler::s_Capturing = false;
+
+
+	static ThreadBuffer* GetThreadBuffer()
+	{
+		if (s_ThreadBuffer)
+			return s_ThreadBuffer;
+
+		std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+
+		auto& buffer	 = s_Data.Buffers.emplace_back(CreateUnique<ThreadBuffer>());
+		buffer->ThreadID = (uint32_t)s_Data.Buffers.size() - 1;
+		buffer->Name	 = "Thread " + std::to_string(buffer->ThreadID);
+
+		s_ThreadBuffer	 = buffer.get();
+		return s_ThreadBuffer;
+	}
+
+	static void WriteEscaped(std::ofstream& p_Stream, const char* p_String)
+	{
+		for (const char* c = p_String; *c; c++)
+		{
+			if (*c == '"' || *c == '\\')
+				p_Stream << '\\';
+			p_Stream << *c;
+		}
+	}
+
+	static void WriteCapture()
+	{
+		uint64_t session = s_Data.Session.load(std::memory_order_acquire);
+
+		std::ofstream stream(s_Data.Path, std::ios::out | std::ios::trunc);
+		if (!stream.is_open())
+		{
+			YM_CORE_ERROR("Profiler - Could not open '{}'", s_Data.Path)
+			return;
+		}
+
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		bool first			= true;
+		uint64_t eventCount = 0;
+		uint32_t dropped	= 0;
+
+		for (auto& buffer : s_Data.Buffers)
+		{
+			if (buffer->Session.load(std::memory_order_acquire) != session)
+				continue;
+
+			stream << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->ThreadID
+				<< ",\"args\":{\"name\":\"";
+			WriteEscaped(stream, buffer->Name.c_str());
+			stream << "\"}}";
+			first = false;
+
+			uint32_t count = buffer->Count.load(std::memory_order_acquire);
+			for (uint32_t i = 0; i < count; i++)
+			{
+				const auto& event = buffer->Events[i];
+				if (event.StartNs < s_Data.StartNs)
+					continue;
+
+				double ts		  = double(event.StartNs - s_Data.StartNs) / 1000.0;
+				double dur		  = double(event.EndNs - event.StartNs) / 1000.0;
+
+				stream << ",\n{\"name\":\"";
+				WriteEscaped(stream, event.Name);
+				stream << "\",\"cat\":\"YUME\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->ThreadID
+					<< ",\"ts\":" << std::fixed << ts << ",\"dur\":" << dur << "}";
+			}
+
+			eventCount += count;
+			dropped	   += buffer->Dropped.load(std::memory_order_relaxed);
+		}
+
+		stream << "\n]}\n";
+
+		YM_CORE_INFO("Profiler - Wrote {} events over {} frames to '{}'", eventCount, s_Data.FramesRecorded, s_Data.Path)
+		if (dropped > 0)
+			YM_CORE_WARN("Profiler - {} events were dropped, the per thread buffer holds {} events", dropped, s_MaxEventsPerThread)
+	}
+
+
+	void Profiler::BeginCapture(const std::string& p_Path, uint32_t p_FrameCount)
+	{
+		std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+
+		if (s_Capturing || s_Data.Pending)
+		{
+			YM_CORE_WARN("Profiler - A capture is already in progress")
+			return;
+		}
+
+		s_Data.Path			   = p_Path;
+		s_Data.FramesRequested = std::max(p_FrameCount, 1u);
+		s_Data.Pending		   = true;
+	}
+
+	void Profiler::EndCapture()
+	{
+		std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+
+		s_Data.Pending = false;
+		if (!s_Capturing)
+			return;
+
+		s_Capturing = false;
+		WriteCapture();
+	}
+
+	void Profiler::BeginFrame()
+	{
+		std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+
+		if (s_Data.Pending)
+		{
+			s_Data.Pending		  = false;
+			s_Data.FramesRecorded = 0;
+			s_Data.StartNs		  = GetTimeNs();
+			s_Data.Session.fetch_add(1, std::memory_order_acq_rel);
+			s_Capturing			  = true;
+
+			YM_CORE_INFO("Profiler - Capturing {} frames...", s_Data.FramesRequested)
+			return;
+		}
+
+		if (s_Capturing && ++s_Data.FramesRecorded >= s_Data.FramesRequested)
+		{
+			s_Capturing = false;
+			WriteCapture();
+		}
+	}
+
+	void Profiler::SetThreadName(const std::string& p_Name)
+	{
+		auto buffer = GetThreadBuffer();
+
+		std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+		buffer->Name = p_Name;
+	}
+
+	void Profiler::Shutdown()
+	{
+		EndCapture();
+	}
+
+	void Profiler::Record(const char* p_Name, uint64_t p_StartNs, uint64_t p_EndNs)
+	{
+		auto buffer		 = GetThreadBuffer();
+		uint64_t session = s_Data.Session.load(std::memory_order_acquire);
+
+		if (buffer->Session.load(std::memory_order_relaxed) != session)
+		{
+			buffer->Count.store(0, std::memory_order_relaxed);
+			buffer->Dropped.store(0, std::memory_order_relaxed);
+			buffer->Session.store(session, std::memory_order_release);
+		}
+
+		uint32_t index = buffer->Count.load(std::memory_order_relaxed);
+		if (index >= s_MaxEventsPerThread)
+		{
+			buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		if (!buffer->Events)
+			buffer->Events = std::make_unique<ProfileEvent[]>(s_MaxEventsPerThread);
+
+		buffer->Events[index] = { p_Name, p_StartNs, p_EndNs };
+		buffer->Count.store(index + 1, std::memory_order_release);
+	}
+
+	uint64_t Profiler::GetTimeNs()
+	{
+		using namespace std::chrono;
+		return (uint64_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "YUME/Core/base.h"
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+
+
+namespace YUME
+{
+	// Built-in scope recorder used by the YM_PROFILE_* macros where Optick isn't available.
+	// Each thread writes into its own preallocated buffer, the capture is written as
+	// Chrome Trace Event JSON (chrome://tracing, ui.perfetto.dev) once the frames are recorded.
+	class YM_API Profiler
+	{
+		public:
+			// Starts recording on the next frame and writes p_Path after p_FrameCount frames
+			static void BeginCapture(const std::string& p_Path, uint32_t p_FrameCount);
+			// Writes whatever was recorded so far
+			static void EndCapture();
+
+			static bool IsCapturing() { return s_Capturing.load(std::memory_order_relaxed); }
+
+			static void BeginFrame();
+			static void SetThreadName(const std::string& p_Name);
+			static void Shutdown();
+
+			static void Record(const char* p_Name, uint64_t p_StartNs, uint64_t p_EndNs);
+			static uint64_t GetTimeNs();
+
+		private:
+			static std::atomic<bool> s_Capturing;
+	};
+
+	class YM_API ProfileScope
+	{
+		public:
+			explicit ProfileScope(const char* p_Name)
+			{
+				if (Profiler::IsCapturing())
+				{
+					m_Name	  = p_Name;
+					m_StartNs = Profiler::GetTimeNs();
+				}
+			}
+
+			~ProfileScope()
+			{
+				if (m_Name)
+					Profiler::Record(m_Name, m_StartNs, Profiler::GetTimeNs());
+			}
+
+		private:
+			const char* m_Name = nullptr;
+			uint64_t m_StartNs = 0;
+
+			YM_NONCOPYABLEANDMOVE(ProfileScope)
+	};
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "YUME/Core/base.h"
+
+// lib
+#include <glm/glm.hpp>
+
+// std
+#include <cfloat>
+
+
+
+namespace YUME::Math
+{
+	struct YM_API BoundingSphere
+	{
+		glm::vec3 Center{ 0.0f };
+		float Radius = 0.0f;
+	};
+
+	struct YM_API BoundingBox
+	{
+		glm::vec3 Min{ FLT_MAX };
+		glm::vec3 Max{ -FLT_MAX };
+
+		bool IsValid() const { return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z; }
+
+		void Merge(const glm::vec3& p_Point)
+		{
+			Min = glm::min(Min, p_Point);
+			Max = glm::max(Max, p_Point);
+		}
+
+		glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+		glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+		// Box enclosing this one after p_Matrix, stays axis aligned
+		BoundingBox Transformed(const glm::mat4& p_Matrix) const
+		{
+			glm::vec3 center  = glm::vec3(p_Matrix * glm::vec4(GetCenter(), 1.0f));
+			glm::vec3 extents = GetExtents();
+
+			glm::vec3 worldExtents{ 0.0f };
+			for (int i = 0; i < 3; i++)
+			{
+				worldExtents[i] = glm::abs(p_Matrix[0][i]) * extents.x +
+								  glm::abs(p_Matrix[1][i]) * extents.y +
+								  glm::abs(p_Matrix[2][i]) * extents.z;
+			}
+
+			return { center - worldExtents, center + worldExtents };
+		}
+
+		BoundingSphere GetSphere() const
+		{
+			return { GetCenter(), glm::length(GetExtents()) };
+		}
+	};
+
+	inline BoundingSphere TransformSphere(const BoundingSphere& p_Sphere, const glm::mat4& p_Matrix)
+	{
+		float scale = glm::max(glm::length(glm::vec3(p_Matrix[0])), glm::max(glm::length(glm::vec3(p_Matrix[1])), glm::length(glm::vec3(p_Matrix[2]))));
+		return { glm::vec3(p_Matrix * glm::vec4(p_Sphere.Center, 1.0f)), p_Sphere.Radius * scale };
+	}
+
+} // YUME::Math
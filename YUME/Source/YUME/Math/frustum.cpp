@@ -0,0 +1,56 @@
+#include "YUME/yumepch.h"
+#include "frustum.h"
+
+
+
+namespace YUME::Math
+{
+	void Frustum::Define(const glm::mat4& p_ViewProjection)
+	{
+		YM_PROFILE_FUNCTION()
+
+		glm::mat4 matrix = glm::transpose(p_ViewProjection);
+
+		m_Planes[Left]	 = matrix[3] + matrix[0];
+		m_Planes[Right]	 = matrix[3] - matrix[0];
+		m_Planes[Bottom] = matrix[3] + matrix[1];
+		m_Planes[Top]		 = matrix[3] - matrix[1];
+		m_Planes[Near]	 = matrix[3] + matrix[2];
+		m_Planes[Far]		 = matrix[3] - matrix[2];
+
+		for (auto& plane : m_Planes)
+		{
+			plane /= glm::length(glm::vec3(plane));
+		}
+	}
+
+	bool Frustum::IsInside(const BoundingSphere& p_Sphere) const
+	{
+		for (const auto& plane : m_Planes)
+		{
+			if (glm::dot(glm::vec3(plane), p_Sphere.Center) + plane.w < -p_Sphere.Radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool Frustum::IsInside(const BoundingBox& p_Box) const
+	{
+		for (const auto& plane : m_Planes)
+		{
+			// Corner furthest along the plane normal
+			glm::vec3 positive = {
+				plane.x >= 0.0f ? p_Box.Max.x : p_Box.Min.x,
+				plane.y >= 0.0f ? p_Box.Max.y : p_Box.Min.y,
+				plane.z >= 0.0f ? p_Box.Max.z : p_Box.Min.z
+			};
+
+			if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f)
+				return false;
+		}
+
+		return true;
+	}
+
+} // YUME::Math
@@ -0,0 +1,30 @@
+#pragma once
+#include "YUME/Core/base.h"
+#include "bounding_volume.h"
+
+// lib
+#include <glm/glm.hpp>
+
+
+
+namespace YUME::Math
+{
+	class YM_API Frustum
+	{
+		public:
+			Frustum() = default;
+			explicit Frustum(const glm::mat4& p_ViewProjection) { Define(p_ViewProjection); }
+
+			// Planes are extracted from the clip space matrix, they point inwards
+			void Define(const glm::mat4& p_ViewProjection);
+
+			bool IsInside(const BoundingSphere& p_Sphere) const;
+			bool IsInside(const BoundingBox& p_Box) const;
+
+		private:
+			enum Side { Left = 0, Right, Bottom, Top, Near, Far };
+
+			glm::vec4 m_Planes[6];
+	};
+
+} // YUME::Math
@@ -20,6 +20,17 @@ namespace YUME
 		return nullptr;
 	}
 
+	Ref<VertexBuffer> VertexBuffer::Create(uint64_t p_SizeBytes)
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (Engine::GetAPI() == RenderAPI::Vulkan)
+			return CreateRef<VulkanVertexBuffer>(p_SizeBytes);
+
+		YM_CORE_ASSERT(false, "Unknown RendererAPI!")
+		return nullptr;
+	}
+
 
 	Ref<IndexBuffer> IndexBuffer::Create(const uint32_t* p_Indices, uint32_t p_Count)
 	{
@@ -32,4 +43,15 @@ namespace YUME
 		return nullptr;
 	}
 
+	Ref<IndexBuffer> IndexBuffer::Create(uint32_t p_Count, IndexType p_Type)
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (Engine::GetAPI() == RenderAPI::Vulkan)
+			return CreateRef<VulkanIndexBuffer>(p_Count, p_Type);
+
+		YM_CORE_ASSERT(false, "Unknown RendererAPI!")
+		return nullptr;
+	}
+
 }
@@ -16,10 +16,15 @@ namespace YUME
 			virtual void Unbind() const = 0;
 
 			virtual void SetData(const void* p_Data, uint64_t p_SizeBytes) = 0;
+			// Device local buffers only, copied through the upload queue. Ranges that are drawn from may be rewritten,
+			// the copy is then ordered after the frames already submitted.
+			virtual void Upload(const void* p_Data, uint64_t p_SizeBytes, uint64_t p_Offset) = 0;
 
 			virtual void Flush() {};
 
 			static Ref<VertexBuffer> Create(const void* p_Data, uint64_t p_SizeBytes);
+			// Device local without initial data, filled with Upload
+			static Ref<VertexBuffer> Create(uint64_t p_SizeBytes);
 	};
 
 
@@ -29,11 +34,19 @@ namespace YUME
 			virtual ~IndexBuffer() = default;
 
 			virtual uint32_t GetCount() const = 0;
+			virtual IndexType GetIndexType() const = 0;
 
 			virtual void Bind(CommandBuffer* p_CommandBuffer) const = 0;
 			virtual void Unbind() const = 0;
 
+			// p_Indices are of the buffer's index type
+			virtual void Upload(const void* p_Indices, uint32_t p_Count, uint32_t p_FirstIndex) = 0;
+
+			static uint32_t GetIndexSize(IndexType p_Type) { return p_Type == IndexType::UINT16 ? sizeof(uint16_t) : sizeof(uint32_t); }
+
 			static Ref<IndexBuffer> Create(const uint32_t* p_Indices, uint32_t p_Count);
+			// Filled with Upload
+			static Ref<IndexBuffer> Create(uint32_t p_Count, IndexType p_Type = IndexType::UINT32);
 	};
 }
 
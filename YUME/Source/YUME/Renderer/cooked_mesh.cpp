@@ -0,0 +1,472 @@
+#include "YUME/yumepch.h"
+#include "cooked_mesh.h"
+
+// std
+#include <fstream>
+
+
+
+namespace YUME
+{
+	static const Ref<Texture2D> PBRTextures::* s_TextureSlots[YMesh::TextureSlotCount] = {
+		&PBRTextures::AlbedoMap,
+		&PBRTextures::OpacityMap,
+		&PBRTextures::NormalMap,
+		&PBRTextures::SpecularMap,
+		&PBRTextures::MetallicMap,
+		&PBRTextures::RoughnessMap,
+		&PBRTextures::AoMap
+	};
+
+	// Size and write time, Size is UINT64_MAX when the file can't be read
+	static YMesh::Dependency GetFileStamp(const std::filesystem::path& p_Path)
+	{
+		YMesh::Dependency stamp{};
+
+		std::error_code error;
+		stamp.Size = std::filesystem::file_size(p_Path, error);
+		if (error)
+		{
+			stamp.Size = UINT64_MAX;
+			return stamp;
+		}
+
+		stamp.WriteTime = (int64_t)std::filesystem::last_write_time(p_Path, error).time_since_epoch().count();
+		if (error)
+			stamp.Size = UINT64_MAX;
+
+		return stamp;
+	}
+
+	static uint64_t AlignOffset(uint64_t p_Offset, uint64_t p_Alignment = 16)
+	{
+		return (p_Offset + p_Alignment - 1) & ~(p_Alignment - 1);
+	}
+
+	#pragma region WRITER
+
+	void CookedMeshWriter::AddGeometry(const Mesh* p_Mesh, const MeshVertex* p_Vertices, uint32_t p_VertexCount, const uint32_t* p_Indices, uint32_t p_IndexCount)
+	{
+		auto& geometry = m_Geometry[p_Mesh];
+		geometry.Vertices.assign(p_Vertices, p_Vertices + p_VertexCount);
+		geometry.Indices.assign(p_Indices, p_Indices + p_IndexCount);
+	}
+
+	void CookedMeshWriter::AddDependency(const std::filesystem::path& p_Path)
+	{
+		auto path = p_Path.lexically_normal();
+		if (!m_Dependencies.contains(path))
+			m_Dependencies[path] = GetFileStamp(path);
+	}
+
+	void CookedMeshWriter::AddTexture(const Texture2D* p_Texture, const std::string& p_Path)
+	{
+		m_Textures[p_Texture].Path = p_Path;
+		AddDependency(p_Path);
+	}
+
+	void CookedMeshWriter::AddTexture(const Texture2D* p_Texture, const uint8_t* p_Data, size_t p_Size)
+	{
+		m_Textures[p_Texture].Data.assign(p_Data, p_Data + p_Size);
+	}
+
+	bool CookedMeshWriter::Write(const std::filesystem::path& p_Path, const std::filesystem::path& p_Directory, const std::vector<Ref<Mesh>>& p_Meshes, bool p_FlipYTexCoord) const
+	{
+		YM_PROFILE_FUNCTION()
+
+		YMesh::Header header{};
+		header.Flags = p_FlipYTexCoord ? YMesh::FlagFlipYTexCoord : 0;
+
+		std::vector<YMesh::Submesh> submeshes;
+		std::vector<YMesh::Material> materials;
+		std::vector<YMesh::Texture> textures;
+		std::vector<YMesh::Dependency> dependencies;
+		std::string strings;
+
+		std::unordered_map<const Material*, int32_t> materialIndices;
+		std::unordered_map<const Texture2D*, int32_t> textureIndices;
+		std::vector<const TextureSource*> textureSources;
+
+		auto AddString = [&](const std::string& p_String)
+		{
+			YMesh::String result{ (uint32_t)strings.size(), (uint32_t)p_String.size() };
+			strings += p_String;
+			return result;
+		};
+
+		auto AddTextureRecord = [&](const Ref<Texture2D>& p_Texture) -> int32_t
+		{
+			if (!p_Texture)
+				return -1;
+
+			auto it = textureIndices.find(p_Texture.get());
+			if (it != textureIndices.end())
+				return it->second;
+
+			auto source = m_Textures.find(p_Texture.get());
+			if (source == m_Textures.end())
+			{
+				YM_CORE_WARN("Cooked mesh - Texture '{}' has no known source, it won't be referenced", p_Texture->GetSpecification().DebugName)
+				return -1;
+			}
+
+			const auto& spec		= p_Texture->GetSpecification();
+
+			YMesh::Texture texture{};
+			if (!source->second.Path.empty())
+				texture.Path		= AddString(std::filesystem::path(source->second.Path).lexically_relative(p_Directory).generic_string());
+			texture.DebugName		= AddString(spec.DebugName);
+			texture.DataSize		= source->second.Data.size();
+			texture.Width			= spec.Width;
+			texture.Height			= spec.Height;
+			texture.Format			= (uint8_t)spec.Format;
+			texture.MinFilter		= (uint8_t)spec.MinFilter;
+			texture.MagFilter		= (uint8_t)spec.MagFilter;
+			texture.WrapU			= (uint8_t)spec.WrapU;
+			texture.WrapV			= (uint8_t)spec.WrapV;
+			texture.Anisotropy		= spec.AnisotropyEnable ? 1 : 0;
+			texture.GenerateMips	= spec.GenerateMips ? 1 : 0;
+
+			int32_t index = (int32_t)textures.size();
+			textures.push_back(texture);
+			textureSources.push_back(&source->second);
+			textureIndices[p_Texture.get()] = index;
+
+			return index;
+		};
+
+		auto AddMaterialRecord = [&](const Ref<Material>& p_Material) -> int32_t
+		{
+			if (!p_Material)
+				return -1;
+
+			auto it = materialIndices.find(p_Material.get());
+			if (it != materialIndices.end())
+				return it->second;
+
+			const auto& properties = p_Material->GetProperties();
+
+			YMesh::Material material{};
+			material.Name		 = AddString(properties.Name);
+			material.AlbedoColor = properties.AlbedoColor;
+			material.AlphaCutOff = properties.AlphaCutOff;
+			material.Surface	 = (uint8_t)properties.Surface;
+			material.NormalMap	 = properties.NormalMap ? 1 : 0;
+			material.SpecularMap = properties.SpecularMap ? 1 : 0;
+
+			for (uint32_t slot = 0; slot < YMesh::TextureSlotCount; slot++)
+				material.Textures[slot] = AddTextureRecord(properties.Textures.*s_TextureSlots[slot]);
+
+			int32_t index = (int32_t)materials.size();
+			materials.push_back(material);
+			materialIndices[p_Material.get()] = index;
+
+			return index;
+		};
+
+		Math::BoundingBox bounds;
+		std::vector<const Geometry*> geometries;
+		geometries.reserve(p_Meshes.size());
+
+		for (const auto& mesh : p_Meshes)
+		{
+			auto geometry = m_Geometry.find(mesh.get());
+			if (geometry == m_Geometry.end())
+			{
+				YM_CORE_ERROR("Cooked mesh - Missing geometry for mesh '{}'", mesh->GetName())
+				return false;
+			}
+
+			const auto& box			= mesh->GetBoundingBox();
+			const auto& sphere		= mesh->GetBoundingSphere();
+
+			YMesh::Submesh submesh{};
+			submesh.Name			= AddString(mesh->GetName());
+			submesh.Material		= AddMaterialRecord(mesh->GetMaterial());
+			submesh.FirstVertex		= header.VertexCount;
+			submesh.VertexCount		= (uint32_t)geometry->second.Vertices.size();
+			submesh.IndexCount		= (uint32_t)geometry->second.Indices.size();
+			submesh.IndexType		= (uint8_t)Mesh::GetIndexType(submesh.VertexCount);
+			// Relative to the index blob until its offset is known, 4 byte aligned for the 32 bit ranges
+			submesh.IndexOffset		= AlignOffset(header.IndexSize, 4);
+			submesh.BoundsMin		= box.Min;
+			submesh.BoundsMax		= box.Max;
+			submesh.SphereCenter	= sphere.Center;
+			submesh.SphereRadius	= sphere.Radius;
+
+			header.VertexCount	   += submesh.VertexCount;
+			header.IndexSize		= uint32_t(submesh.IndexOffset + uint64_t(submesh.IndexCount) * IndexBuffer::GetIndexSize((IndexType)submesh.IndexType));
+
+			bounds.Merge(box.Min);
+			bounds.Merge(box.Max);
+
+			submeshes.push_back(submesh);
+			geometries.push_back(&geometry->second);
+		}
+
+		if (bounds.IsValid())
+		{
+			header.BoundsMin = bounds.Min;
+			header.BoundsMax = bounds.Max;
+		}
+
+		for (const auto& [path, stamp] : m_Dependencies)
+		{
+			// A file that couldn't be read when importing is left out, nothing can be compared to it
+			if (stamp.Size == UINT64_MAX)
+				continue;
+
+			auto& dependency = dependencies.emplace_back(stamp);
+			dependency.Path	 = AddString(path.lexically_relative(p_Directory).generic_string());
+		}
+
+		header.SubmeshCount	  = (uint32_t)submeshes.size();
+		header.MaterialCount  = (uint32_t)materials.size();
+		header.TextureCount	  = (uint32_t)textures.size();
+		header.StringSize	  = (uint32_t)strings.size();
+		header.DependencyCount = (uint32_t)dependencies.size();
+
+		// Tables first, then the geometry, then the embedded pixels
+		header.SubmeshOffset  = AlignOffset(sizeof(YMesh::Header));
+		header.MaterialOffset = AlignOffset(header.SubmeshOffset + submeshes.size() * sizeof(YMesh::Submesh));
+		header.TextureOffset  = AlignOffset(header.MaterialOffset + materials.size() * sizeof(YMesh::Material));
+		header.DependencyOffset = AlignOffset(header.TextureOffset + textures.size() * sizeof(YMesh::Texture));
+		header.StringOffset	  = AlignOffset(header.DependencyOffset + dependencies.size() * sizeof(YMesh::Dependency));
+		header.VertexOffset	  = AlignOffset(header.StringOffset + strings.size());
+		header.IndexOffset	  = AlignOffset(header.VertexOffset + uint64_t(header.VertexCount) * sizeof(PackedMeshVertex));
+
+		for (auto& submesh : submeshes)
+			submesh.IndexOffset += header.IndexOffset;
+
+		uint64_t offset		  = AlignOffset(header.IndexOffset + header.IndexSize);
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			if (textures[i].DataSize == 0)
+				continue;
+
+			textures[i].DataOffset = offset;
+			offset				   = AlignOffset(offset + textures[i].DataSize);
+		}
+
+		// Written next to the final file and renamed, so a reader never maps a half written one
+		std::filesystem::path tempPath = p_Path;
+		tempPath += ".tmp";
+
+		{
+			std::ofstream stream(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!stream.is_open())
+			{
+				YM_CORE_WARN("Cooked mesh - Could not open '{}' for writing", tempPath.string())
+				return false;
+			}
+
+			auto WriteAt = [&](uint64_t p_Offset, const void* p_Data, size_t p_Size)
+			{
+				static const char s_Zeros[16] = {};
+
+				uint64_t position = (uint64_t)stream.tellp();
+				YM_CORE_ASSERT(p_Offset >= position && p_Offset - position < 16)
+				stream.write(s_Zeros, std::streamsize(p_Offset - position));
+
+				if (p_Size > 0)
+					stream.write((const char*)p_Data, std::streamsize(p_Size));
+			};
+
+			WriteAt(0, &header, sizeof(header));
+			WriteAt(header.SubmeshOffset, submeshes.data(), submeshes.size() * sizeof(YMesh::Submesh));
+			WriteAt(header.MaterialOffset, materials.data(), materials.size() * sizeof(YMesh::Material));
+			WriteAt(header.TextureOffset, textures.data(), textures.size() * sizeof(YMesh::Texture));
+			WriteAt(header.DependencyOffset, dependencies.data(), dependencies.size() * sizeof(YMesh::Dependency));
+			WriteAt(header.StringOffset, strings.data(), strings.size());
+
+			uint64_t vertexOffset = header.VertexOffset;
+			std::vector<PackedMeshVertex> vertices;
+			for (const auto* geometry : geometries)
+			{
+				vertices.resize(geometry->Vertices.size());
+				for (size_t i = 0; i < vertices.size(); i++)
+					vertices[i] = Mesh::PackVertex(geometry->Vertices[i]);
+
+				WriteAt(vertexOffset, vertices.data(), vertices.size() * sizeof(PackedMeshVertex));
+				vertexOffset += vertices.size() * sizeof(PackedMeshVertex);
+			}
+
+			std::vector<uint16_t> indices16;
+			for (size_t i = 0; i < geometries.size(); i++)
+			{
+				const auto& indices = geometries[i]->Indices;
+				if ((IndexType)submeshes[i].IndexType == IndexType::UINT16)
+				{
+					indices16.assign(indices.begin(), indices.end());
+					WriteAt(submeshes[i].IndexOffset, indices16.data(), indices16.size() * sizeof(uint16_t));
+				}
+				else
+					WriteAt(submeshes[i].IndexOffset, indices.data(), indices.size() * sizeof(uint32_t));
+			}
+
+			for (size_t i = 0; i < textures.size(); i++)
+			{
+				if (textures[i].DataSize > 0)
+					WriteAt(textures[i].DataOffset, textureSources[i]->Data.data(), textureSources[i]->Data.size());
+			}
+
+			if (!stream.good())
+			{
+				YM_CORE_WARN("Cooked mesh - Failed to write '{}'", tempPath.string())
+				return false;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, p_Path, error);
+		if (error)
+		{
+			YM_CORE_WARN("Cooked mesh - Could not replace '{}': {}", p_Path.string(), error.message())
+			std::filesystem::remove(tempPath, error);
+			return false;
+		}
+
+		return true;
+	}
+
+	#pragma endregion
+
+	#pragma region READER
+
+	bool CookedMeshFile::Open(const std::filesystem::path& p_Path)
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (!m_File.Open(p_Path))
+			return false;
+
+		if (!Validate())
+		{
+			YM_CORE_WARN("Cooked mesh - '{}' is invalid or out of date", p_Path.string())
+			m_File.Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	std::string_view CookedMeshFile::GetString(const YMesh::String& p_String) const
+	{
+		return std::string_view((const char*)m_File.GetData() + GetHeader().StringOffset + p_String.Offset, p_String.Length);
+	}
+
+	bool CookedMeshFile::IsUpToDate(const std::filesystem::path& p_Directory) const
+	{
+		YM_PROFILE_FUNCTION()
+
+		const auto& header = GetHeader();
+		for (uint32_t i = 0; i < header.DependencyCount; i++)
+		{
+			const auto& dependency = GetDependencies()[i];
+
+			auto stamp = GetFileStamp(p_Directory / std::string(GetString(dependency.Path)));
+			if (stamp.Size != dependency.Size || stamp.WriteTime != dependency.WriteTime)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool CookedMeshFile::ValidIndices(const YMesh::Submesh& p_Submesh) const
+	{
+		YM_PROFILE_FUNCTION()
+
+		// The writer aligns every range, a misaligned one isn't a file it wrote
+		if (p_Submesh.IndexOffset % IndexBuffer::GetIndexSize((IndexType)p_Submesh.IndexType) != 0)
+			return false;
+
+		auto Check = [&](const auto* p_Indices)
+		{
+			uint32_t maxIndex = 0;
+			for (uint32_t i = 0; i < p_Submesh.IndexCount; i++)
+				maxIndex = std::max<uint32_t>(maxIndex, p_Indices[i]);
+
+			return p_Submesh.IndexCount == 0 || maxIndex < p_Submesh.VertexCount;
+		};
+
+		if ((IndexType)p_Submesh.IndexType == IndexType::UINT16)
+			return Check((const uint16_t*)GetIndices(p_Submesh));
+
+		return Check((const uint32_t*)GetIndices(p_Submesh));
+	}
+
+	bool CookedMeshFile::Validate() const
+	{
+		uint64_t size = m_File.GetSize();
+		if (size < sizeof(YMesh::Header))
+			return false;
+
+		const auto& header = GetHeader();
+		if (header.Magic != YMesh::Magic || header.Version != YMesh::Version || header.VertexStride != sizeof(PackedMeshVertex))
+			return false;
+
+		auto InRange = [size](uint64_t p_Offset, uint64_t p_Count, uint64_t p_Stride)
+		{
+			return p_Offset <= size && p_Count * p_Stride <= size - p_Offset;
+		};
+
+		if (!InRange(header.SubmeshOffset, header.SubmeshCount, sizeof(YMesh::Submesh)) ||
+			!InRange(header.MaterialOffset, header.MaterialCount, sizeof(YMesh::Material)) ||
+			!InRange(header.TextureOffset, header.TextureCount, sizeof(YMesh::Texture)) ||
+			!InRange(header.DependencyOffset, header.DependencyCount, sizeof(YMesh::Dependency)) ||
+			!InRange(header.StringOffset, header.StringSize, 1) ||
+			!InRange(header.VertexOffset, header.VertexCount, sizeof(PackedMeshVertex)) ||
+			!InRange(header.IndexOffset, header.IndexSize, 1))
+			return false;
+
+		auto ValidString = [&](const YMesh::String& p_String)
+		{
+			return uint64_t(p_String.Offset) + p_String.Length <= header.StringSize;
+		};
+
+		for (uint32_t i = 0; i < header.SubmeshCount; i++)
+		{
+			const auto& submesh = GetSubmeshes()[i];
+			if (!ValidString(submesh.Name) || submesh.Material >= (int32_t)header.MaterialCount ||
+				uint64_t(submesh.FirstVertex) + submesh.VertexCount > header.VertexCount ||
+				submesh.IndexType > (uint8_t)IndexType::UINT32 || submesh.IndexOffset < header.IndexOffset ||
+				!InRange(submesh.IndexOffset, submesh.IndexCount, IndexBuffer::GetIndexSize((IndexType)submesh.IndexType)) ||
+				submesh.IndexOffset + uint64_t(submesh.IndexCount) * IndexBuffer::GetIndexSize((IndexType)submesh.IndexType) > header.IndexOffset + header.IndexSize)
+				return false;
+
+			// Uploaded as is into a shared geometry page, an index past the submesh would read another mesh's vertices
+			if (!ValidIndices(submesh))
+				return false;
+		}
+
+		for (uint32_t i = 0; i < header.MaterialCount; i++)
+		{
+			const auto& material = GetMaterials()[i];
+			if (!ValidString(material.Name))
+				return false;
+
+			for (int32_t texture : material.Textures)
+			{
+				if (texture >= (int32_t)header.TextureCount)
+					return false;
+			}
+		}
+
+		for (uint32_t i = 0; i < header.TextureCount; i++)
+		{
+			const auto& texture = GetTextures()[i];
+			if (!ValidString(texture.Path) || !ValidString(texture.DebugName) || !InRange(texture.DataOffset, texture.DataSize, 1))
+				return false;
+		}
+
+		for (uint32_t i = 0; i < header.DependencyCount; i++)
+		{
+			if (!ValidString(GetDependencies()[i].Path))
+				return false;
+		}
+
+		return true;
+	}
+
+	#pragma endregion
+}
@@ -0,0 +1,212 @@
+#pragma once
+#include "YUME/Core/base.h"
+#include "YUME/Core/reference.h"
+#include "YUME/Utils/mapped_file.h"
+#include "mesh.h"
+#include "texture.h"
+
+// Lib
+#include <glm/glm.hpp>
+
+// std
+#include <filesystem>
+#include <map>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace YUME
+{
+	// .ymesh is a model after import. Every table is an array of fixed size records and the vertex and
+	// index blobs are stored exactly as PackedMeshVertex and 16 or 32 bit indices (chosen per submesh),
+	// so loading is mapping the file and uploading. Every file the import read is listed with its size
+	// and write time, the file is cooked again when one of them changes.
+	// Offsets are in bytes from the start of the file, strings point into the string blob.
+	namespace YMesh
+	{
+		constexpr uint32_t Magic		   = 0x48534D59; // "YMSH"
+		// Also bumped when the importers change their output, so older files are cooked again
+		constexpr uint32_t Version		   = 5;
+		constexpr const char* Extension	   = ".ymesh";
+
+		constexpr uint32_t FlagFlipYTexCoord = BIT(0);
+
+		// Same order as the members of PBRTextures
+		constexpr uint32_t TextureSlotCount	 = 7;
+
+		struct String
+		{
+			uint32_t Offset = 0;
+			uint32_t Length = 0;
+		};
+
+		struct Header
+		{
+			uint32_t Magic			= YMesh::Magic;
+			uint32_t Version		= YMesh::Version;
+			uint32_t Flags			= 0;
+			uint32_t VertexStride	= sizeof(PackedMeshVertex);
+
+			uint32_t SubmeshCount	= 0;
+			uint32_t MaterialCount	= 0;
+			uint32_t TextureCount	= 0;
+			uint32_t StringSize		= 0;
+			uint32_t VertexCount	= 0;
+			uint32_t IndexSize		= 0; // In bytes, the index types are mixed
+			uint32_t DependencyCount = 0;
+			uint32_t Reserved		= 0;
+
+			uint64_t SubmeshOffset	= 0;
+			uint64_t MaterialOffset = 0;
+			uint64_t TextureOffset	= 0;
+			uint64_t StringOffset	= 0;
+			uint64_t VertexOffset	= 0;
+			uint64_t IndexOffset	= 0;
+			uint64_t DependencyOffset = 0;
+
+			glm::vec3 BoundsMin		= glm::vec3(0.0f);
+			glm::vec3 BoundsMax		= glm::vec3(0.0f);
+		};
+
+		struct Submesh
+		{
+			String	  Name;
+			int32_t	  Material		= -1;
+
+			// Indices are relative to FirstVertex
+			uint32_t  FirstVertex	= 0;
+			uint32_t  VertexCount	= 0;
+			uint32_t  IndexCount	= 0;
+			uint64_t  IndexOffset	= 0;
+			uint8_t	  IndexType		= 0; // YUME::IndexType, Mesh::GetIndexType(VertexCount)
+			uint8_t	  Padding[3]	= {};
+
+			glm::vec3 BoundsMin		= glm::vec3(0.0f);
+			glm::vec3 BoundsMax		= glm::vec3(0.0f);
+			glm::vec3 SphereCenter	= glm::vec3(0.0f);
+			float	  SphereRadius	= 0.0f;
+			uint32_t  Reserved		= 0;
+		};
+
+		struct Material
+		{
+			String	  Name;
+			glm::vec4 AlbedoColor	= glm::vec4(1.0f);
+			float	  AlphaCutOff	= 0.1f;
+			uint8_t	  Surface		= 0;
+			uint8_t	  NormalMap		= 0;
+			uint8_t	  SpecularMap	= 0;
+			uint8_t	  Padding		= 0;
+
+			int32_t	  Textures[TextureSlotCount] = { -1, -1, -1, -1, -1, -1, -1 };
+		};
+
+		// Either a path relative to the model, loaded through the TextureImporter,
+		// or pixels stored in the file (images embedded in the source) in Format.
+		struct Texture
+		{
+			String	  Path;
+			String	  DebugName;
+
+			uint64_t  DataOffset	= 0;
+			uint64_t  DataSize		= 0;
+			uint32_t  Width			= 0;
+			uint32_t  Height		= 0;
+
+			uint8_t	  Format		= 0;
+			uint8_t	  MinFilter		= 0;
+			uint8_t	  MagFilter		= 0;
+			uint8_t	  WrapU			= 0;
+			uint8_t	  WrapV			= 0;
+			uint8_t	  Anisotropy	= 0;
+			uint8_t	  GenerateMips	= 0;
+			uint8_t	  Padding		= 0;
+		};
+
+		// A file the import read, the path is relative to the model
+		struct Dependency
+		{
+			String	  Path;
+			uint64_t  Size			= 0;
+			int64_t	  WriteTime		= 0; // file_time_type ticks
+		};
+
+		static_assert(sizeof(PackedMeshVertex) == 24, "PackedMeshVertex changed, bump YMesh::Version");
+		static_assert(sizeof(Header) == 128 && sizeof(Submesh) == 80 && sizeof(Material) == 60 && sizeof(Texture) == 48 && sizeof(Dependency) == 24);
+	}
+
+	// Collects what the importers parsed so it can be written as a .ymesh once the model is built
+	class YM_API CookedMeshWriter
+	{
+		public:
+			CookedMeshWriter() = default;
+
+			// The arrays are copied and packed when written, p_Mesh is only used as a key
+			void AddGeometry(const Mesh* p_Mesh, const MeshVertex* p_Vertices, uint32_t p_VertexCount, const uint32_t* p_Indices, uint32_t p_IndexCount);
+
+			// A file the cooked data is built from, its size and write time are taken now
+			void AddDependency(const std::filesystem::path& p_Path);
+
+			// p_Path is the file the texture was loaded from, it is also a dependency
+			void AddTexture(const Texture2D* p_Texture, const std::string& p_Path);
+			// Pixels that only exist inside the source file, in the texture format
+			void AddTexture(const Texture2D* p_Texture, const uint8_t* p_Data, size_t p_Size);
+
+			// Texture paths are written relative to p_Directory
+			bool Write(const std::filesystem::path& p_Path, const std::filesystem::path& p_Directory, const std::vector<Ref<Mesh>>& p_Meshes, bool p_FlipYTexCoord) const;
+
+		private:
+			struct Geometry
+			{
+				std::vector<MeshVertex> Vertices;
+				std::vector<uint32_t> Indices;
+			};
+
+			struct TextureSource
+			{
+				std::string Path;
+				std::vector<uint8_t> Data;
+			};
+
+			std::unordered_map<const Mesh*, Geometry> m_Geometry;
+			std::unordered_map<const Texture2D*, TextureSource> m_Textures;
+			// Sorted, so the same sources write the same file
+			std::map<std::filesystem::path, YMesh::Dependency> m_Dependencies;
+	};
+
+	// A mapped .ymesh, the pointers stay valid while the file is open
+	class YM_API CookedMeshFile
+	{
+		public:
+			CookedMeshFile() = default;
+
+			// Fails on files written by another version or with a different vertex layout
+			bool Open(const std::filesystem::path& p_Path);
+
+			const YMesh::Header& GetHeader() const { return *(const YMesh::Header*)m_File.GetData(); }
+
+			const YMesh::Submesh* GetSubmeshes() const { return (const YMesh::Submesh*)(m_File.GetData() + GetHeader().SubmeshOffset); }
+			const YMesh::Material* GetMaterials() const { return (const YMesh::Material*)(m_File.GetData() + GetHeader().MaterialOffset); }
+			const YMesh::Texture* GetTextures() const { return (const YMesh::Texture*)(m_File.GetData() + GetHeader().TextureOffset); }
+			const YMesh::Dependency* GetDependencies() const { return (const YMesh::Dependency*)(m_File.GetData() + GetHeader().DependencyOffset); }
+
+			const PackedMeshVertex* GetVertices() const { return (const PackedMeshVertex*)(m_File.GetData() + GetHeader().VertexOffset); }
+			// Of the submesh's IndexType
+			const void* GetIndices(const YMesh::Submesh& p_Submesh) const { return m_File.GetData() + p_Submesh.IndexOffset; }
+
+			const uint8_t* GetData(uint64_t p_Offset) const { return m_File.GetData() + p_Offset; }
+			std::string_view GetString(const YMesh::String& p_String) const;
+
+			// False once a file the import read was changed, moved or deleted. p_Directory is the model's
+			bool IsUpToDate(const std::filesystem::path& p_Directory) const;
+
+		private:
+			bool Validate() const;
+			bool ValidIndices(const YMesh::Submesh& p_Submesh) const;
+
+		private:
+			Utils::MappedFile m_File;
+	};
+}
@@ -16,6 +16,18 @@ namespace YUME
 	{
 		uint32_t Set = 0;
 		Ref<Shader> Shader;
+
+		// For sets rewritten every frame. They come from the current frame's pool, which is reset once the frame
+		// is done, so they have to be uploaded every frame before they are bound. Ignored for bindless sets.
+		bool Transient = false;
+	};
+
+	// A named binding resolved once, valid for every set created from the same shader and set index
+	struct YM_API DescriptorHandle
+	{
+		int32_t Index = -1;
+
+		bool IsValid() const { return Index >= 0; }
 	};
 
 	class YM_API DescriptorSet
@@ -25,6 +37,16 @@ namespace YUME
 		public:
 			virtual ~DescriptorSet() = default;
 
+			// Invalid handle if the set has no binding with that name
+			virtual DescriptorHandle GetDescriptorHandle(const std::string& p_Name) const = 0;
+
+			// Same as the name based setters without the lookup, prefer them for anything set every frame
+			virtual void SetUniformData(DescriptorHandle p_Handle, const Ref<UniformBuffer>& p_UniformBuffer) = 0;
+			virtual void SetStorageData(DescriptorHandle p_Handle, const Ref<StorageBuffer>& p_StorageBuffer) = 0;
+			virtual void SetTexture(DescriptorHandle p_Handle, const Ref<Texture>& p_Texture) = 0;
+			virtual void SetTexture(DescriptorHandle p_Handle, const Ref<Texture>* p_TextureData, uint32_t p_Count) = 0;
+			virtual void SetTextureAt(DescriptorHandle p_Handle, uint32_t p_ArrayIndex, const Ref<Texture>& p_Texture) = 0;
+
 			virtual void SetUniformData(const std::string& p_Name, const Ref<UniformBuffer>& p_UniformBuffer) = 0;
 			virtual void SetUniform(const std::string& p_BufferName, const std::string& p_MemberName, void* p_Data) = 0;
 			virtual void SetUniform(const std::string& p_BufferName, const std::string& p_MemberName, void* p_Data, uint32_t p_Size) = 0;
@@ -33,7 +55,10 @@ namespace YUME
 
 			virtual void SetTexture(const std::string& p_Name, const Ref<Texture>& p_Texture) = 0;
 			virtual void SetTexture(const std::string& p_Name, const Ref<Texture>* p_TextureData, uint32_t p_Count) = 0;
+			// Writes a single array element, the rest of the array is left untouched
+			virtual void SetTextureAt(const std::string& p_Name, uint32_t p_ArrayIndex, const Ref<Texture>& p_Texture) = 0;
 
+			// Only the bindings that changed since the last upload are written
 			virtual void Upload(CommandBuffer* p_CommandBuffer = nullptr) = 0;
 
 			static Ref<DescriptorSet> Create(const DescriptorSpec& p_Spec);
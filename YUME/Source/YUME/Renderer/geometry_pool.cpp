@@ -0,0 +1,90 @@
+#include "YUME/yumepch.h"
+#include "geometry_pool.h"
+
+// std
+#include <map>
+#include <mutex>
+
+
+
+
+namespace YUME
+{
+	static constexpr uint32_t s_PageVertexCount = 256 * 1024;
+	static constexpr uint32_t s_PageIndexCount	= 1024 * 1024;
+
+	struct GeometryPoolData
+	{
+		std::mutex Mutex;
+
+		// Pages are keyed by vertex size and index type, every vertex in a page uses the same stride
+		std::map<std::pair<uint32_t, IndexType>, Ref<GeometryPage>> Pages;
+		uint32_t NextPageID = 1;
+	};
+
+	static GeometryPoolData s_Data;
+
+
+	static Ref<GeometryPage> CreatePage(uint32_t p_VertexCount, uint32_t p_VertexSize, uint32_t p_IndexCount, IndexType p_IndexType)
+	{
+		YM_PROFILE_FUNCTION()
+
+		auto page			 = CreateRef<GeometryPage>();
+		page->ID			 = s_Data.NextPageID++;
+		page->VertexCapacity = p_VertexCount;
+		page->IndexCapacity	 = p_IndexCount;
+		page->VertexBuffer	 = VertexBuffer::Create((uint64_t)p_VertexCount * p_VertexSize);
+		page->IndexBuffer	 = IndexBuffer::Create(p_IndexCount, p_IndexType);
+
+		return page;
+	}
+
+
+	void GeometryPool::Shutdown()
+	{
+		std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+
+		// Pages still used by meshes are freed with them
+		s_Data.Pages.clear();
+	}
+
+	GeometryAllocation GeometryPool::Allocate(const void* p_Vertices, uint32_t p_VertexCount, uint32_t p_VertexSize, const void* p_Indices, uint32_t p_IndexCount, IndexType p_IndexType)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_VERIFY(p_Vertices != nullptr && p_VertexCount > 0 && p_VertexSize > 0)
+		YM_CORE_VERIFY(p_Indices != nullptr && p_IndexCount > 0)
+
+		GeometryAllocation allocation{};
+		{
+			std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+
+			if (p_VertexCount > s_PageVertexCount || p_IndexCount > s_PageIndexCount)
+			{
+				// Too big to share, gets a page of its own
+				allocation.Page = CreatePage(p_VertexCount, p_VertexSize, p_IndexCount, p_IndexType);
+			}
+			else
+			{
+				auto& page = s_Data.Pages[{ p_VertexSize, p_IndexType }];
+				if (!page || page->VertexCount + p_VertexCount > page->VertexCapacity || page->IndexCount + p_IndexCount > page->IndexCapacity)
+					page = CreatePage(s_PageVertexCount, p_VertexSize, s_PageIndexCount, p_IndexType);
+
+				allocation.Page = page;
+			}
+
+			allocation.FirstIndex			 = allocation.Page->IndexCount;
+			allocation.IndexCount			 = p_IndexCount;
+			allocation.VertexOffset			 = (int32_t)allocation.Page->VertexCount;
+
+			allocation.Page->VertexCount	+= p_VertexCount;
+			allocation.Page->IndexCount		+= p_IndexCount;
+		}
+
+		// The ranges are reserved, the uploads don't need the lock
+		allocation.Page->VertexBuffer->Upload(p_Vertices, (uint64_t)p_VertexCount * p_VertexSize, (uint64_t)allocation.VertexOffset * p_VertexSize);
+		allocation.Page->IndexBuffer->Upload(p_Indices, p_IndexCount, allocation.FirstIndex);
+
+		return allocation;
+	}
+}
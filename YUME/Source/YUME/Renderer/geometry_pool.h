@@ -0,0 +1,43 @@
+#pragma once
+#include "YUME/Core/base.h"
+#include "YUME/Core/reference.h"
+#include "buffer.h"
+
+
+
+namespace YUME
+{
+	// One shared vertex and index buffer, every mesh allocated from it can be drawn without rebinding
+	struct GeometryPage
+	{
+		uint32_t		  ID			 = 0;
+
+		Ref<VertexBuffer> VertexBuffer	 = nullptr;
+		Ref<IndexBuffer>  IndexBuffer	 = nullptr;
+
+		uint32_t		  VertexCapacity = 0;
+		uint32_t		  IndexCapacity	 = 0;
+		uint32_t		  VertexCount	 = 0;
+		uint32_t		  IndexCount	 = 0;
+	};
+
+	struct GeometryAllocation
+	{
+		Ref<GeometryPage> Page		   = nullptr; // Meshes keep their page alive, it is freed with the last one
+		uint32_t		  FirstIndex   = 0;
+		uint32_t		  IndexCount   = 0;
+		int32_t			  VertexOffset = 0;
+	};
+
+	// Static geometry is packed into large pages instead of a buffer pair per mesh.
+	// Allocations only move forward, a full page is replaced by a new one.
+	class YM_API GeometryPool
+	{
+		public:
+			static void Shutdown();
+
+			// Thread safe, the data is uploaded before returning. p_Indices are of p_IndexType,
+			// 16 bit and 32 bit indices go to different pages.
+			static GeometryAllocation Allocate(const void* p_Vertices, uint32_t p_VertexCount, uint32_t p_VertexSize, const void* p_Indices, uint32_t p_IndexCount, IndexType p_IndexType = IndexType::UINT32);
+	};
+}
@@ -18,6 +18,13 @@ namespace YUME
 			virtual void OnResize(uint32_t p_Width, uint32_t p_Height) {};
 
 			virtual CommandBuffer* GetCurrentCommandBuffer() = 0;
+			// A secondary command buffer owned by the calling thread, valid for the frame that is being recorded
+			virtual CommandBuffer* GetSecondaryCommandBuffer() = 0;
+
+			virtual uint32_t GetFramesInFlight() const { return 1; }
+			virtual uint32_t GetCurrentFrameIndex() const { return 0; }
+			// Time the CPU spent blocked on the current frame's fence
+			virtual double GetFrameWaitTimeMs() const { return 0.0; }
 
 			virtual void Begin() {}
 			virtual void End() = 0;
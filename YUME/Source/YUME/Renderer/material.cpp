@@ -42,13 +42,34 @@ namespace YUME
 			s_DefaultTexture.reset();
 	}
 
-	void Material::Bind(CommandBuffer* p_CommandBuffer, const Ref<Shader>& p_Shader, bool p_PBR)
+	PBRTextures Material::GetTexturesOrDefault() const
+	{
+		const auto& textures = m_Properties.Textures;
+
+		PBRTextures result{};
+		result.AlbedoMap	= textures.AlbedoMap	? textures.AlbedoMap	: s_DefaultAlbedoTexture;
+		result.OpacityMap	= textures.OpacityMap	? textures.OpacityMap	: s_DefaultTexture;
+		result.NormalMap	= textures.NormalMap	? textures.NormalMap	: s_DefaultNormalTexture;
+		result.SpecularMap	= textures.SpecularMap	? textures.SpecularMap	: s_DefaultSpecularTexture;
+		result.MetallicMap	= textures.MetallicMap	? textures.MetallicMap	: s_DefaultTexture;
+		result.RoughnessMap = textures.RoughnessMap ? textures.RoughnessMap : s_DefaultTexture;
+		result.AoMap		= textures.AoMap		? textures.AoMap		: s_DefaultTexture;
+
+		return result;
+	}
+
+	void Material::Prepare(const Ref<Shader>& p_Shader, bool p_PBR)
 	{
 		if (!m_TexturesUpdated)
 		{
 			CreateDescriptorSet(1, p_Shader, p_PBR);
 			m_TexturesUpdated = true;
 		}
+	}
+
+	void Material::Bind(CommandBuffer* p_CommandBuffer, const Ref<Shader>& p_Shader, bool p_PBR)
+	{
+		Prepare(p_Shader, p_PBR);
 
 		RendererCommand::BindDescriptorSets(p_CommandBuffer, &m_DescriptorSet);
 	}
@@ -64,7 +85,12 @@ namespace YUME
 
 		} buffer{ m_Properties.AlbedoColor, (m_Properties.SpecularMap) ? 1 : 0, (m_Properties.NormalMap) ? 1 : 0, m_Properties.AlphaCutOff};
 
-		m_DescriptorSet->SetUniformData("u_MaterialProperties", UniformBuffer::Create(&buffer, sizeof(buffer)));
+		if (m_PropertiesBuffer)
+			m_PropertiesBuffer->SetData(&buffer, sizeof(buffer));
+		else
+			m_PropertiesBuffer = UniformBuffer::Create(&buffer, sizeof(buffer));
+
+		m_DescriptorSet->SetUniformData("u_MaterialProperties", m_PropertiesBuffer);
 
 		m_DescriptorSet->Upload();
 	}
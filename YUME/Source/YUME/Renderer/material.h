@@ -40,7 +40,13 @@ namespace YUME
 			Material() = default;
 			
 			void SetProperties(const MaterialProperties& p_Properties) { m_Properties = p_Properties; }
+			const MaterialProperties& GetProperties() const { return m_Properties; }
+
+			// Missing maps are replaced by the default textures, the same ones Bind uses
+			PBRTextures GetTexturesOrDefault() const;
 			
+			// Creates the descriptor set on first use, after that Bind only records the bind and is safe to call from several threads
+			void Prepare(const Ref<Shader>& p_Shader, bool p_PBR = false);
 			void Bind(CommandBuffer* p_CommandBuffer, const Ref<Shader>& p_Shader, bool p_PBR = false);
 
 			static void CreateDefaultTextures();
@@ -58,6 +64,8 @@ namespace YUME
 		private:
 			MaterialProperties m_Properties;
 			Ref<DescriptorSet> m_DescriptorSet;
+			// A block of the shared uniform arena, kept when the set is recreated
+			Ref<UniformBuffer> m_PropertiesBuffer;
 			bool m_TexturesUpdated = false;
 
 	};
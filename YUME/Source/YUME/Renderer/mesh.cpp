@@ -2,17 +2,58 @@
 #include "mesh.h"
 #include "renderer_command.h"
 
+// Lib
+#include <glm/gtc/packing.hpp>
+
 
 
 namespace YUME
 {
 
 	Mesh::Mesh(const std::vector<uint32_t>& p_Indices, const std::vector<MeshVertex>& p_Vertices)
+		: Mesh(p_Indices.data(), (uint32_t)p_Indices.size(), p_Vertices.data(), (uint32_t)p_Vertices.size())
+	{
+	}
+
+	Mesh::Mesh(const uint32_t* p_Indices, uint32_t p_IndexCount, const MeshVertex* p_Vertices, uint32_t p_VertexCount)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::vector<PackedMeshVertex> vertices(p_VertexCount);
+		for (uint32_t i = 0; i < p_VertexCount; i++)
+			vertices[i] = PackVertex(p_Vertices[i]);
+
+		IndexType indexType = GetIndexType(p_VertexCount);
+		if (indexType == IndexType::UINT16)
+		{
+			std::vector<uint16_t> indices(p_Indices, p_Indices + p_IndexCount);
+			m_Geometry = GeometryPool::Allocate(vertices.data(), p_VertexCount, sizeof(PackedMeshVertex), indices.data(), p_IndexCount, indexType);
+		}
+		else
+			m_Geometry = GeometryPool::Allocate(vertices.data(), p_VertexCount, sizeof(PackedMeshVertex), p_Indices, p_IndexCount, indexType);
+
+		for (uint32_t i = 0; i < p_VertexCount; i++)
+			m_BoundingBox.Merge(p_Vertices[i].Position);
+
+		if (!m_BoundingBox.IsValid())
+			m_BoundingBox = { glm::vec3(0.0f), glm::vec3(0.0f) };
+
+		// Tighter than the box's sphere for most meshes, and never looser
+		glm::vec3 center = m_BoundingBox.GetCenter();
+		float radius2	 = 0.0f;
+		for (uint32_t i = 0; i < p_VertexCount; i++)
+			radius2 = std::max(radius2, glm::dot(p_Vertices[i].Position - center, p_Vertices[i].Position - center));
+
+		m_BoundingSphere = { center, std::sqrt(radius2) };
+	}
+
+	Mesh::Mesh(const void* p_Indices, uint32_t p_IndexCount, IndexType p_IndexType, const PackedMeshVertex* p_Vertices, uint32_t p_VertexCount,
+		const Math::BoundingBox& p_BoundingBox, const Math::BoundingSphere& p_BoundingSphere)
+		: m_BoundingBox(p_BoundingBox), m_BoundingSphere(p_BoundingSphere)
 	{
 		YM_PROFILE_FUNCTION()
 
-		m_VertexBuffer = VertexBuffer::Create(p_Vertices.data(), p_Vertices.size() * sizeof(MeshVertex));
-		m_IndexBuffer = IndexBuffer::Create(p_Indices.data(), (uint32_t)p_Indices.size());
+		m_Geometry = GeometryPool::Allocate(p_Vertices, p_VertexCount, sizeof(PackedMeshVertex), p_Indices, p_IndexCount, p_IndexType);
 	}
 
 	void Mesh::BindMaterial(CommandBuffer* p_CommandBuffer, const Ref<Shader>& p_Shader, bool p_PBR)
@@ -70,5 +111,44 @@ namespace YUME
 		delete[] normals;
 	}
 
+	InputLayout Mesh::GetInputLayout()
+	{
+		return {
+			{ DataType::Float3, "a_Position"		},
+			{ DataType::Short2, "a_Normal", true	},
+			{ DataType::Half2,	"a_TexCoord"		},
+			{ DataType::UByte4, "a_Color",	true	}
+		};
+	}
+
+	PackedMeshVertex Mesh::PackVertex(const MeshVertex& p_Vertex)
+	{
+		PackedMeshVertex vertex;
+		vertex.Position = p_Vertex.Position;
+		vertex.Normal	= glm::packSnorm2x16(EncodeOctahedral(p_Vertex.Normal));
+		vertex.TexCoord = glm::packHalf2x16(p_Vertex.TexCoord);
+		vertex.Color	= glm::packUnorm4x8(glm::clamp(p_Vertex.Color, 0.0f, 1.0f));
+
+		return vertex;
+	}
+
+	glm::vec2 Mesh::EncodeOctahedral(const glm::vec3& p_Normal)
+	{
+		float length = std::abs(p_Normal.x) + std::abs(p_Normal.y) + std::abs(p_Normal.z);
+		if (!(length > 0.0f)) // Also catches the NaNs of degenerate normals
+			return glm::vec2(0.0f);
+
+		glm::vec3 n = p_Normal / length;
+		glm::vec2 e = glm::vec2(n.x, n.y);
+
+		// The lower hemisphere is folded over the diagonals
+		if (n.z < 0.0f)
+		{
+			e = (1.0f - glm::abs(glm::vec2(e.y, e.x))) * glm::vec2(e.x >= 0.0f ? 1.0f : -1.0f, e.y >= 0.0f ? 1.0f : -1.0f);
+		}
+
+		return e;
+	}
+
 
 } // YUME
\ No newline at end of file
@@ -4,7 +4,10 @@
 #include "YUME/Core/definitions.h"
 #include "YUME/Core/reference.h"
 #include "buffer.h"
+#include "geometry_pool.h"
+#include "shader.h"
 #include "material.h"
+#include "YUME/Math/bounding_volume.h"
 
 #include <glm/glm.hpp>
 #include "descriptor_set.h"
@@ -24,6 +27,16 @@ namespace YUME
 		glm::vec4 Color;
 	};
 
+	// What the GPU reads, MeshVertex is only used while importing.
+	// Normal is octahedral encoded in snorm16x2, TexCoord is half2 since UVs may leave [0, 1], Color is unorm8x4.
+	struct PackedMeshVertex
+	{
+		glm::vec3 Position;
+		uint32_t  Normal;
+		uint32_t  TexCoord;
+		uint32_t  Color;
+	};
+
 	class YM_API Mesh
 	{
 		friend class Model;
@@ -31,23 +44,50 @@ namespace YUME
 		public:
 			Mesh() = default;
 			Mesh(const std::vector<uint32_t>& p_Indices, const std::vector<MeshVertex>& p_Vertices);
-
-			const Ref<VertexBuffer>& GetVertexBuffer() const { return m_VertexBuffer; }
-			const Ref<IndexBuffer>& GetIndexBuffer() const { return m_IndexBuffer; }
+			Mesh(const uint32_t* p_Indices, uint32_t p_IndexCount, const MeshVertex* p_Vertices, uint32_t p_VertexCount);
+			// Already packed, with the bounds computed ahead of time, e.g. stored in a cooked file
+			Mesh(const void* p_Indices, uint32_t p_IndexCount, IndexType p_IndexType, const PackedMeshVertex* p_Vertices, uint32_t p_VertexCount,
+				const Math::BoundingBox& p_BoundingBox, const Math::BoundingSphere& p_BoundingSphere);
+
+			// Shared with the other meshes of the page, draw with the range below
+			const Ref<VertexBuffer>& GetVertexBuffer() const { return m_Geometry.Page->VertexBuffer; }
+			const Ref<IndexBuffer>& GetIndexBuffer() const { return m_Geometry.Page->IndexBuffer; }
+
+			const Ref<GeometryPage>& GetGeometryPage() const { return m_Geometry.Page; }
+			uint32_t GetFirstIndex() const { return m_Geometry.FirstIndex; }
+			uint32_t GetIndexCount() const { return m_Geometry.IndexCount; }
+			int32_t GetVertexOffset() const { return m_Geometry.VertexOffset; }
+
+			// Model space, computed from the vertices at load time
+			const Math::BoundingBox& GetBoundingBox() const { return m_BoundingBox; }
+			const Math::BoundingSphere& GetBoundingSphere() const { return m_BoundingSphere; }
 		
 			void BindMaterial(CommandBuffer* p_CommandBuffer, const Ref<Shader>& p_Shader, bool p_PBR = true);
 
 			void SetName(const std::string& p_Name) { m_Name = p_Name; }
+			const std::string& GetName() const { return m_Name; }
 
 			void SetMaterial(const Ref<Material>& p_Material) { m_Material = p_Material; }
 			const Ref<Material>& GetMaterial() { return m_Material; }
 
 			static void GenerateNormals(MeshVertex* p_Vertices, uint32_t p_VertexCount, uint32_t* p_Indices, uint32_t p_IndexCount);
 
+			// Vertex input of every pipeline that draws meshes, matches PackedMeshVertex
+			static InputLayout GetInputLayout();
+
+			static PackedMeshVertex PackVertex(const MeshVertex& p_Vertex);
+			// Unit vector to the [-1, 1] square, decoded in the shaders
+			static glm::vec2 EncodeOctahedral(const glm::vec3& p_Normal);
+
+			// 16 bit indices whenever the mesh allows them, the indices are relative to the mesh's first vertex
+			static IndexType GetIndexType(uint32_t p_VertexCount) { return p_VertexCount < 65536 ? IndexType::UINT16 : IndexType::UINT32; }
+
 		private:
 			Ref<Material> m_Material;
-			Ref<VertexBuffer> m_VertexBuffer;
-			Ref<IndexBuffer> m_IndexBuffer;
+			GeometryAllocation m_Geometry;
+
+			Math::BoundingBox m_BoundingBox;
+			Math::BoundingSphere m_BoundingSphere;
 
 			std::string m_Name = "Mesh";
 	};
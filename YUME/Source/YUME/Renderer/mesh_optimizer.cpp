@@ -0,0 +1,397 @@
+#include "YUME/yumepch.h"
+#include "mesh_optimizer.h"
+
+// std
+#include <cmath>
+#include <numeric>
+
+
+
+namespace YUME
+{
+	static constexpr uint32_t s_InvalidIndex = ~0u;
+
+	#pragma region VERTEX_CACHE
+
+	// Scoring from Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+	static constexpr float s_CacheDecayPower	 = 1.5f;
+	static constexpr float s_LastTriangleScore	 = 0.75f;
+	static constexpr float s_ValenceBoostScale	 = 2.0f;
+	static constexpr float s_ValenceBoostPower	 = 0.5f;
+	static constexpr uint32_t s_MaxValenceScored = 32;
+
+	struct VertexScoreTable
+	{
+		float Cache[MeshOptimizer::CacheSize];
+		float Valence[s_MaxValenceScored + 1];
+
+		VertexScoreTable()
+		{
+			for (uint32_t i = 0; i < MeshOptimizer::CacheSize; i++)
+			{
+				// The last triangle's vertices get a fixed score, so the next one doesn't just reuse them
+				if (i < 3)
+					Cache[i] = s_LastTriangleScore;
+				else
+					Cache[i] = std::pow(1.0f - float(i - 3) / float(MeshOptimizer::CacheSize - 3), s_CacheDecayPower);
+			}
+
+			Valence[0] = 0.0f;
+			for (uint32_t i = 1; i <= s_MaxValenceScored; i++)
+				Valence[i] = s_ValenceBoostScale * std::pow(float(i), -s_ValenceBoostPower);
+		}
+
+		float Get(int32_t p_CachePosition, uint32_t p_RemainingValence) const
+		{
+			// Nothing left to draw with it
+			if (p_RemainingValence == 0)
+				return -1.0f;
+
+			float score = p_CachePosition >= 0 ? Cache[p_CachePosition] : 0.0f;
+			return score + Valence[std::min(p_RemainingValence, s_MaxValenceScored)];
+		}
+	};
+
+	void MeshOptimizer::OptimizeVertexCache(uint32_t* p_Indices, size_t p_IndexCount, uint32_t p_VertexCount)
+	{
+		YM_PROFILE_FUNCTION()
+
+		static const VertexScoreTable s_Scores;
+
+		size_t triangleCount = p_IndexCount / 3;
+		if (triangleCount == 0 || p_VertexCount == 0)
+			return;
+
+		// Triangles using each vertex, the first Remaining[v] entries are the ones not drawn yet
+		std::vector<uint32_t> remaining(p_VertexCount, 0);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+			remaining[p_Indices[i]]++;
+
+		std::vector<uint32_t> offsets(p_VertexCount + 1, 0);
+		for (uint32_t v = 0; v < p_VertexCount; v++)
+			offsets[v + 1] = offsets[v] + remaining[v];
+
+		std::vector<uint32_t> adjacency(triangleCount * 3);
+		{
+			std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+			for (size_t t = 0; t < triangleCount; t++)
+			{
+				for (int k = 0; k < 3; k++)
+					adjacency[fill[p_Indices[t * 3 + k]]++] = (uint32_t)t;
+			}
+		}
+
+		std::vector<float> vertexScore(p_VertexCount);
+		for (uint32_t v = 0; v < p_VertexCount; v++)
+			vertexScore[v] = s_Scores.Get(-1, remaining[v]);
+
+		std::vector<float> triangleScore(triangleCount);
+		std::vector<bool> emitted(triangleCount, false);
+		for (size_t t = 0; t < triangleCount; t++)
+			triangleScore[t] = vertexScore[p_Indices[t * 3 + 0]] + vertexScore[p_Indices[t * 3 + 1]] + vertexScore[p_Indices[t * 3 + 2]];
+
+		std::vector<uint32_t> output(triangleCount * 3);
+
+		// Room for the previous cache plus the three vertices of the new triangle
+		std::vector<uint32_t> cache, nextCache;
+		cache.reserve(CacheSize + 3);
+		nextCache.reserve(CacheSize + 3);
+
+		uint32_t bestTriangle = (uint32_t)std::distance(triangleScore.begin(), std::max_element(triangleScore.begin(), triangleScore.end()));
+		size_t cursor		  = 0;
+
+		for (size_t drawn = 0; drawn < triangleCount; drawn++)
+		{
+			// Nothing in the cache is connected to an undrawn triangle, continue with the next one in input order
+			if (bestTriangle == s_InvalidIndex)
+			{
+				while (emitted[cursor])
+					cursor++;
+
+				bestTriangle = (uint32_t)cursor;
+			}
+
+			const uint32_t* triangle = &p_Indices[bestTriangle * 3];
+			output[drawn * 3 + 0]	 = triangle[0];
+			output[drawn * 3 + 1]	 = triangle[1];
+			output[drawn * 3 + 2]	 = triangle[2];
+			emitted[bestTriangle]	 = true;
+
+			nextCache.clear();
+			for (int k = 0; k < 3; k++)
+			{
+				uint32_t v = triangle[k];
+				nextCache.push_back(v);
+
+				// Swap it out of the undrawn part of the vertex's list
+				uint32_t* begin = &adjacency[offsets[v]];
+				uint32_t* end	= begin + remaining[v];
+				uint32_t* found = std::find(begin, end, bestTriangle);
+				YM_CORE_ASSERT(found != end)
+				std::swap(*found, *(end - 1));
+				remaining[v]--;
+			}
+
+			for (uint32_t v : cache)
+			{
+				if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+					nextCache.push_back(v);
+			}
+
+			std::swap(cache, nextCache);
+
+			// Rescore everything that moved, including what just fell out of the cache
+			bestTriangle	= s_InvalidIndex;
+			float bestScore = -1.0f;
+
+			for (uint32_t i = 0; i < (uint32_t)cache.size(); i++)
+			{
+				uint32_t v		   = cache[i];
+				int32_t position   = i < CacheSize ? (int32_t)i : -1;
+
+				float score		   = s_Scores.Get(position, remaining[v]);
+				float delta		   = score - vertexScore[v];
+				vertexScore[v]	   = score;
+
+				for (uint32_t a = offsets[v]; a < offsets[v] + remaining[v]; a++)
+				{
+					uint32_t t		   = adjacency[a];
+					triangleScore[t]  += delta;
+				}
+			}
+
+			if (cache.size() > CacheSize)
+				cache.resize(CacheSize);
+
+			for (uint32_t v : cache)
+			{
+				for (uint32_t a = offsets[v]; a < offsets[v] + remaining[v]; a++)
+				{
+					uint32_t t = adjacency[a];
+					if (triangleScore[t] > bestScore)
+					{
+						bestScore	 = triangleScore[t];
+						bestTriangle = t;
+					}
+				}
+			}
+		}
+
+		std::copy(output.begin(), output.end(), p_Indices);
+	}
+
+	VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(const uint32_t* p_Indices, size_t p_IndexCount, uint32_t p_VertexCount, uint32_t p_CacheSize)
+	{
+		YM_PROFILE_FUNCTION()
+
+		VertexCacheStatistics stats{};
+		stats.Triangles = p_IndexCount / 3;
+
+		// FIFO through timestamps: a vertex is cached while fewer than p_CacheSize misses happened since its own
+		std::vector<uint32_t> timestamps(p_VertexCount, 0);
+		std::vector<bool> used(p_VertexCount, false);
+		uint32_t time = p_CacheSize + 1;
+
+		for (size_t i = 0; i < stats.Triangles * 3; i++)
+		{
+			uint32_t v = p_Indices[i];
+			if (time - timestamps[v] > p_CacheSize)
+			{
+				timestamps[v] = time++;
+				stats.Transformed++;
+			}
+
+			if (!used[v])
+			{
+				used[v] = true;
+				stats.Vertices++;
+			}
+		}
+
+		return stats;
+	}
+
+	#pragma endregion
+
+	#pragma region OVERDRAW
+
+	void MeshOptimizer::OptimizeOverdraw(uint32_t* p_Indices, size_t p_IndexCount, const MeshVertex* p_Vertices, uint32_t p_VertexCount, float p_Threshold)
+	{
+		YM_PROFILE_FUNCTION()
+
+		size_t triangleCount = p_IndexCount / 3;
+		if (triangleCount == 0 || p_VertexCount == 0)
+			return;
+
+		std::vector<uint32_t> timestamps(p_VertexCount, 0);
+		uint32_t time = CacheSize + 1;
+
+		auto Misses = [&](size_t p_Triangle)
+		{
+			uint32_t misses = 0;
+			for (int k = 0; k < 3; k++)
+			{
+				uint32_t v = p_Indices[p_Triangle * 3 + k];
+				if (time - timestamps[v] > CacheSize)
+				{
+					timestamps[v] = time++;
+					misses++;
+				}
+			}
+			return misses;
+		};
+
+		auto ResetCache = [&]() { time += CacheSize + 1; };
+
+		// Hard boundaries: the cache starts over there anyway, so moving the cluster costs nothing
+		std::vector<uint32_t> hardBoundaries;
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			if (Misses(t) == 3)
+				hardBoundaries.push_back((uint32_t)t);
+		}
+
+		if (hardBoundaries.empty() || hardBoundaries[0] != 0)
+			hardBoundaries.insert(hardBoundaries.begin(), 0);
+		hardBoundaries.push_back((uint32_t)triangleCount);
+
+		// Soft boundaries: split again as soon as the cluster so far is no worse than the whole one allows
+		std::vector<uint32_t> clusters;
+		for (size_t c = 0; c + 1 < hardBoundaries.size(); c++)
+		{
+			uint32_t begin = hardBoundaries[c];
+			uint32_t end   = hardBoundaries[c + 1];
+
+			ResetCache();
+			uint32_t clusterMisses = 0;
+			for (uint32_t t = begin; t < end; t++)
+				clusterMisses += Misses(t);
+
+			float threshold = p_Threshold * float(clusterMisses) / float(end - begin);
+
+			ResetCache();
+			clusters.push_back(begin);
+
+			uint32_t misses	   = 0;
+			uint32_t triangles = 0;
+			for (uint32_t t = begin; t < end; t++)
+			{
+				misses += Misses(t);
+				triangles++;
+
+				if (t + 1 < end && float(misses) / float(triangles) <= threshold)
+				{
+					clusters.push_back(t + 1);
+
+					ResetCache();
+					misses	  = 0;
+					triangles = 0;
+				}
+			}
+		}
+
+		clusters.push_back((uint32_t)triangleCount);
+
+		size_t clusterCount = clusters.size() - 1;
+
+		// Area weighted centroid and normal per cluster, sorted on how much the cluster faces away from the mesh center
+		std::vector<glm::vec3> centroids(clusterCount, glm::vec3(0.0f));
+		std::vector<glm::vec3> normals(clusterCount, glm::vec3(0.0f));
+		std::vector<float> areas(clusterCount, 0.0f);
+
+		glm::vec3 meshCentroid = glm::vec3(0.0f);
+		float meshArea		   = 0.0f;
+
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			for (uint32_t t = clusters[c]; t < clusters[c + 1]; t++)
+			{
+				const glm::vec3& p0 = p_Vertices[p_Indices[t * 3 + 0]].Position;
+				const glm::vec3& p1 = p_Vertices[p_Indices[t * 3 + 1]].Position;
+				const glm::vec3& p2 = p_Vertices[p_Indices[t * 3 + 2]].Position;
+
+				glm::vec3 cross = glm::cross(p1 - p0, p2 - p0);
+				float area		= glm::length(cross);
+
+				centroids[c]   += (p0 + p1 + p2) * (area / 3.0f);
+				normals[c]	   += cross;
+				areas[c]	   += area;
+			}
+
+			meshCentroid += centroids[c];
+			meshArea	 += areas[c];
+		}
+
+		if (meshArea > 0.0f)
+			meshCentroid /= meshArea;
+
+		std::vector<float> sortKeys(clusterCount, 0.0f);
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			float normalLength = glm::length(normals[c]);
+			if (areas[c] <= 0.0f || normalLength <= 0.0f)
+				continue;
+
+			sortKeys[c] = glm::dot(centroids[c] / areas[c] - meshCentroid, normals[c] / normalLength);
+		}
+
+		std::vector<uint32_t> order(clusterCount);
+		std::iota(order.begin(), order.end(), 0u);
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t p_Lhs, uint32_t p_Rhs) { return sortKeys[p_Lhs] > sortKeys[p_Rhs]; });
+
+		std::vector<uint32_t> output;
+		output.reserve(triangleCount * 3);
+		for (uint32_t c : order)
+			output.insert(output.end(), p_Indices + clusters[c] * 3, p_Indices + clusters[c + 1] * 3);
+
+		std::copy(output.begin(), output.end(), p_Indices);
+	}
+
+	#pragma endregion
+
+	#pragma region VERTEX_FETCH
+
+	void MeshOptimizer::OptimizeVertexFetch(std::vector<MeshVertex>& p_Vertices, std::vector<uint32_t>& p_Indices)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::vector<uint32_t> remap(p_Vertices.size(), s_InvalidIndex);
+		std::vector<MeshVertex> vertices;
+		vertices.reserve(p_Vertices.size());
+
+		for (auto& index : p_Indices)
+		{
+			if (remap[index] == s_InvalidIndex)
+			{
+				remap[index] = (uint32_t)vertices.size();
+				vertices.push_back(p_Vertices[index]);
+			}
+
+			index = remap[index];
+		}
+
+		vertices.shrink_to_fit();
+		p_Vertices = std::move(vertices);
+	}
+
+	#pragma endregion
+
+	void MeshOptimizer::Optimize(std::vector<MeshVertex>& p_Vertices, std::vector<uint32_t>& p_Indices, VertexCacheStatistics* p_Before, VertexCacheStatistics* p_After)
+	{
+		YM_PROFILE_FUNCTION()
+
+		// Strips or broken index lists are left alone
+		if (p_Indices.empty() || p_Indices.size() % 3 != 0)
+			return;
+
+		if (p_Before)
+			p_Before->Merge(AnalyzeVertexCache(p_Indices.data(), p_Indices.size(), (uint32_t)p_Vertices.size()));
+
+		OptimizeVertexCache(p_Indices.data(), p_Indices.size(), (uint32_t)p_Vertices.size());
+		OptimizeOverdraw(p_Indices.data(), p_Indices.size(), p_Vertices.data(), (uint32_t)p_Vertices.size());
+		OptimizeVertexFetch(p_Vertices, p_Indices);
+
+		if (p_After)
+			p_After->Merge(AnalyzeVertexCache(p_Indices.data(), p_Indices.size(), (uint32_t)p_Vertices.size()));
+	}
+}
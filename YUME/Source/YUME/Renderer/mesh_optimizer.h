@@ -0,0 +1,54 @@
+#pragma once
+#include "YUME/Core/base.h"
+#include "mesh.h"
+
+// std
+#include <vector>
+
+
+
+namespace YUME
+{
+	struct VertexCacheStatistics
+	{
+		uint64_t Triangles	 = 0;
+		uint64_t Vertices	 = 0; // Referenced by the indices
+		uint64_t Transformed = 0; // Cache misses of a FIFO the size of MeshOptimizer::CacheSize
+
+		// Average cache miss ratio, transformed vertices per triangle (0.5 is the best a grid can do, 3 the worst)
+		float GetACMR() const { return Triangles > 0 ? float(Transformed) / float(Triangles) : 0.0f; }
+		// Average transform to vertex ratio, 1 means every vertex was shaded once
+		float GetATVR() const { return Vertices > 0 ? float(Transformed) / float(Vertices) : 0.0f; }
+
+		void Merge(const VertexCacheStatistics& p_Other)
+		{
+			Triangles	+= p_Other.Triangles;
+			Vertices	+= p_Other.Vertices;
+			Transformed += p_Other.Transformed;
+		}
+	};
+
+	// Import time reordering of triangle lists, nothing here touches the GPU
+	class YM_API MeshOptimizer
+	{
+		public:
+			static constexpr uint32_t CacheSize = 32;
+
+			// Runs the three passes below in order. p_Before and p_After are optional.
+			static void Optimize(std::vector<MeshVertex>& p_Vertices, std::vector<uint32_t>& p_Indices,
+				VertexCacheStatistics* p_Before = nullptr, VertexCacheStatistics* p_After = nullptr);
+
+			// Forsyth's linear-speed vertex cache optimization
+			static void OptimizeVertexCache(uint32_t* p_Indices, size_t p_IndexCount, uint32_t p_VertexCount);
+
+			// Cuts the cache optimized order into clusters where the cache restarts anyway (or where the
+			// cluster's own ACMR allows it) and draws the clusters facing away from the center first.
+			// p_Threshold is how much worse than the input ACMR the result may get.
+			static void OptimizeOverdraw(uint32_t* p_Indices, size_t p_IndexCount, const MeshVertex* p_Vertices, uint32_t p_VertexCount, float p_Threshold = 1.05f);
+
+			// Vertices are stored in the order the indices first reference them, unused ones are dropped
+			static void OptimizeVertexFetch(std::vector<MeshVertex>& p_Vertices, std::vector<uint32_t>& p_Indices);
+
+			static VertexCacheStatistics AnalyzeVertexCache(const uint32_t* p_Indices, size_t p_IndexCount, uint32_t p_VertexCount, uint32_t p_CacheSize = CacheSize);
+	};
+}
@@ -1,8 +1,11 @@
 #include "YUME/yumepch.h"
 #include "model.h"
 #include "texture_importer.h"
+#include "cooked_mesh.h"
+#include "mesh_optimizer.h"
 #include "YUME/Math/transform.h"
 #include "YUME/Utils/utils.h"
+#include "YUME/Core/jobs.h"
 
 #include <glm/ext/matrix_transform.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
@@ -22,6 +25,9 @@
 #include <tinygltf/tiny_gltf.h>
 #include <glm/gtc/type_ptr.hpp>
 
+// std
+#include <fstream>
+
 
 
 #define OBJ_PREFIX  "[OBJ]    - "
@@ -44,6 +50,62 @@ namespace YUME
 		m_Meshes.clear();
 		std::filesystem::path path = p_Path;
 
+		if (path.extension() == YMesh::Extension)
+		{
+			// The flip was applied when it was cooked
+			if (!LoadModelCooked(p_Path, p_FlipYTexCoord, false))
+			{
+				YM_CORE_ERROR("Failed to load cooked model '{}'", p_Path)
+				return;
+			}
+		}
+		else
+		{
+			// The cooked file checks the source and every file the import read (.bin, .mtl, images)
+			std::error_code error;
+			std::string cookedPath = GetCookedPath(p_Path);
+
+			if (!std::filesystem::exists(cookedPath, error) || !LoadModelCooked(cookedPath, p_FlipYTexCoord))
+			{
+				if (!LoadModelSource(p_Path, p_FlipYTexCoord))
+					return;
+			}
+		}
+
+		m_Path = p_Path;
+		YM_CORE_INFO("Loaded Model: {}", p_Path)
+	}
+
+	bool Model::Cook(const std::string& p_Path, bool p_FlipYTexCoord)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::error_code error;
+		std::string cookedPath = GetCookedPath(p_Path);
+		std::filesystem::remove(cookedPath, error);
+
+		Model model;
+		if (!model.LoadModelSource(p_Path, p_FlipYTexCoord))
+			return false;
+
+		return std::filesystem::exists(cookedPath, error);
+	}
+
+	std::string Model::GetCookedPath(const std::string& p_Path)
+	{
+		return p_Path + YMesh::Extension;
+	}
+
+	bool Model::LoadModelSource(const std::string& p_Path, bool p_FlipYTexCoord)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::filesystem::path path = p_Path;
+
+		CookedMeshWriter cooker;
+		cooker.AddDependency(path);
+		m_Cooker = &cooker;
+
 		if (path.extension() == ".obj")
 		{
 			LoadModelOBJ(p_Path, p_FlipYTexCoord);
@@ -54,12 +116,120 @@ namespace YUME
 		}
 		else
 		{
+			m_Cooker = nullptr;
 			YM_CORE_ERROR("Unsupported model extension!")
-			return;
+			return false;
 		}
 
-		m_Path = p_Path;
-		YM_CORE_INFO("Loaded Model: {}", p_Path)
+		m_Cooker = nullptr;
+
+		if (!m_Meshes.empty())
+		{
+			std::string cookedPath = GetCookedPath(p_Path);
+			if (cooker.Write(cookedPath, path.parent_path(), m_Meshes, p_FlipYTexCoord))
+				YM_CORE_INFO("Cooked Model: {}", cookedPath)
+		}
+
+		return true;
+	}
+
+	bool Model::LoadModelCooked(const std::string& p_Path, bool p_FlipYTexCoord, bool p_CheckSource)
+	{
+		YM_PROFILE_FUNCTION()
+
+		CookedMeshFile file;
+		if (!file.Open(p_Path))
+			return false;
+
+		const auto& header = file.GetHeader();
+		if (p_CheckSource && ((header.Flags & YMesh::FlagFlipYTexCoord) != 0) != p_FlipYTexCoord)
+			return false;
+
+		if (p_CheckSource && !file.IsUpToDate(std::filesystem::path(p_Path).parent_path()))
+		{
+			YM_CORE_INFO("Cooked model '{}' is out of date", p_Path)
+			return false;
+		}
+
+		std::string directory = std::filesystem::path(p_Path).parent_path().string() + "/";
+
+		std::vector<Ref<Texture2D>> textures(header.TextureCount);
+		for (uint32_t i = 0; i < header.TextureCount; i++)
+		{
+			const auto& texture		= file.GetTextures()[i];
+
+			TextureSpecification spec{};
+			spec.Width				= texture.Width;
+			spec.Height				= texture.Height;
+			spec.Format				= (TextureFormat)texture.Format;
+			spec.MinFilter			= (TextureFilter)texture.MinFilter;
+			spec.MagFilter			= (TextureFilter)texture.MagFilter;
+			spec.WrapU				= (TextureWrap)texture.WrapU;
+			spec.WrapV				= (TextureWrap)texture.WrapV;
+			spec.AnisotropyEnable	= texture.Anisotropy != 0;
+			spec.GenerateMips		= texture.GenerateMips != 0;
+			spec.DebugName			= std::string(file.GetString(texture.DebugName));
+
+			if (texture.DataSize > 0)
+				textures[i] = Texture2D::Create(spec, file.GetData(texture.DataOffset), (size_t)texture.DataSize);
+			else
+				textures[i] = LoadMaterialTexture(directory + std::string(file.GetString(texture.Path)), spec);
+		}
+
+		std::vector<Ref<Material>> materials(header.MaterialCount);
+		for (uint32_t i = 0; i < header.MaterialCount; i++)
+		{
+			const auto& material	= file.GetMaterials()[i];
+
+			MaterialProperties properties;
+			properties.Name			= std::string(file.GetString(material.Name));
+			properties.AlbedoColor	= material.AlbedoColor;
+			properties.AlphaCutOff	= material.AlphaCutOff;
+			properties.Surface		= (SurfaceType)material.Surface;
+			properties.NormalMap	= material.NormalMap != 0;
+			properties.SpecularMap	= material.SpecularMap != 0;
+
+			Ref<Texture2D>* slots[YMesh::TextureSlotCount] = {
+				&properties.Textures.AlbedoMap,
+				&properties.Textures.OpacityMap,
+				&properties.Textures.NormalMap,
+				&properties.Textures.SpecularMap,
+				&properties.Textures.MetallicMap,
+				&properties.Textures.RoughnessMap,
+				&properties.Textures.AoMap
+			};
+
+			for (uint32_t slot = 0; slot < YMesh::TextureSlotCount; slot++)
+			{
+				if (material.Textures[slot] >= 0)
+					*slots[slot] = textures[material.Textures[slot]];
+			}
+
+			materials[i] = CreateRef<Material>();
+			materials[i]->SetProperties(properties);
+		}
+
+		// Geometry goes from the mapping straight to the upload
+		const PackedMeshVertex* vertices = file.GetVertices();
+
+		for (uint32_t i = 0; i < header.SubmeshCount; i++)
+		{
+			const auto& submesh = file.GetSubmeshes()[i];
+
+			Math::BoundingBox box{ submesh.BoundsMin, submesh.BoundsMax };
+			Math::BoundingSphere sphere{ submesh.SphereCenter, submesh.SphereRadius };
+
+			auto mesh = CreateRef<Mesh>(file.GetIndices(submesh), submesh.IndexCount, (IndexType)submesh.IndexType, vertices + submesh.FirstVertex, submesh.VertexCount, box, sphere);
+			mesh->SetName(std::string(file.GetString(submesh.Name)));
+			if (submesh.Material >= 0)
+				mesh->SetMaterial(materials[submesh.Material]);
+
+			m_Meshes.push_back(mesh);
+		}
+
+		m_TexturesLoaded.clear();
+
+		return true;
 	}
 
 	Ref<Texture2D> Model::LoadMaterialTexture(const std::string& p_Path, const TextureSpecification& p_Spec)
@@ -76,6 +246,9 @@ namespace YUME
 		if (texture)
 		{
 			m_TexturesLoaded[p_Path] = texture;
+
+			if (m_Cooker)
+				m_Cooker->AddTexture(texture.get(), p_Path);
 		}
 
 		return texture;
@@ -96,8 +269,89 @@ namespace YUME
 		return result;
 	}
 	
+	// Totals over every mesh of a model, logged once it is loaded
+	struct VertexCacheReport
+	{
+		VertexCacheStatistics Before;
+		VertexCacheStatistics After;
+	};
+
+	static void LogVertexCacheReport(const std::string& p_Prefix, const std::string& p_Path, const VertexCacheReport& p_Report)
+	{
+		if (p_Report.Before.Triangles == 0)
+			return;
+
+		YM_CORE_INFO("{}{}: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f} ({} triangles)", p_Prefix, p_Path,
+			p_Report.Before.GetACMR(), p_Report.After.GetACMR(), p_Report.Before.GetATVR(), p_Report.After.GetATVR(), p_Report.After.Triangles)
+	}
+
 	#pragma region OBJ_LOADER
 
+	// MeshVertex is only floats, so two vertices are the same when their bytes are
+	struct MeshVertexHash
+	{
+		size_t operator()(const MeshVertex& p_Vertex) const
+		{
+			return std::hash<std::string_view>()(std::string_view((const char*)&p_Vertex, sizeof(MeshVertex)));
+		}
+	};
+
+	struct MeshVertexEqual
+	{
+		bool operator()(const MeshVertex& p_Lhs, const MeshVertex& p_Rhs) const
+		{
+			return memcmp(&p_Lhs, &p_Rhs, sizeof(MeshVertex)) == 0;
+		}
+	};
+
+	// OBJ faces index positions, normals and uvs separately, so the loop below emits one vertex per corner.
+	// Corners with the same attributes are merged back into one vertex and p_Indices is remapped.
+	static void DeduplicateVertices(std::vector<MeshVertex>& p_Vertices, std::vector<uint32_t>& p_Indices)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::unordered_map<MeshVertex, uint32_t, MeshVertexHash, MeshVertexEqual> uniqueVertices;
+		uniqueVertices.reserve(p_Vertices.size());
+
+		std::vector<MeshVertex> vertices;
+		vertices.reserve(p_Vertices.size());
+
+		for (auto& index : p_Indices)
+		{
+			const MeshVertex& vertex = p_Vertices[index];
+
+			auto [it, inserted] = uniqueVertices.try_emplace(vertex, (uint32_t)vertices.size());
+			if (inserted)
+				vertices.push_back(vertex);
+
+			index = it->second;
+		}
+
+		vertices.shrink_to_fit();
+		p_Vertices = std::move(vertices);
+	}
+
+	// The default reader, but the .mtl files it opens are dependencies of the cooked file
+	class OBJMaterialReader : public tinyobj::MaterialFileReader
+	{
+		public:
+			OBJMaterialReader(const std::string& p_Directory, CookedMeshWriter* p_Cooker)
+				: tinyobj::MaterialFileReader(p_Directory), m_Directory(p_Directory), m_Cooker(p_Cooker) {}
+
+			bool operator()(const std::string& p_MaterialID, std::vector<tinyobj::material_t>* p_Materials, std::map<std::string, int>* p_MaterialMap,
+				std::string* p_Warn, std::string* p_Error) override
+			{
+				if (m_Cooker)
+					m_Cooker->AddDependency(m_Directory + p_MaterialID);
+
+				return tinyobj::MaterialFileReader::operator()(p_MaterialID, p_Materials, p_MaterialMap, p_Warn, p_Error);
+			}
+
+		private:
+			std::string m_Directory;
+			CookedMeshWriter* m_Cooker = nullptr;
+	};
+
 	void Model::LoadModelOBJ(const std::string& p_Path, bool p_FlipYTexCoord)
 	{
 		YM_PROFILE_FUNCTION()
@@ -110,7 +364,15 @@ namespace YUME
 		std::vector<tinyobj::shape_t> shapes;
 		std::vector<tinyobj::material_t> materials;
 
-		if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &error, p_Path.c_str(), directory.c_str()))
+		std::ifstream stream(p_Path);
+		if (!stream.is_open())
+		{
+			YM_CORE_ERROR(OBJ_PREFIX "Cannot open file '{}'", p_Path)
+			return;
+		}
+
+		OBJMaterialReader materialReader(directory, m_Cooker);
+		if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &error, &stream, &materialReader))
 		{
 			auto strs = SplitString(error, '\n');
 			for (const auto& str : strs)
@@ -131,6 +393,10 @@ namespace YUME
 			}
 		}
 
+		size_t totalCorners	 = 0;
+		size_t totalVertices = 0;
+		VertexCacheReport cacheReport;
+
 		for (const auto& shape : shapes)
 		{
 			uint32_t vertexCount = 0;
@@ -191,9 +457,16 @@ namespace YUME
 				vertexCount++;
 			}
 
+			// Before merging, so meshes without normals keep their faceted look
 			if (attrib.normals.empty())
 				Mesh::GenerateNormals(vertices.data(), vertexCount, indices.data(), numIndices);
 
+			DeduplicateVertices(vertices, indices);
+			totalCorners  += numVertices;
+			totalVertices += vertices.size();
+
+			MeshOptimizer::Optimize(vertices, indices, &cacheReport.Before, &cacheReport.After);
+
 			MaterialProperties properties;
 
 			if (shape.mesh.material_ids[0] >= 0)
@@ -300,12 +573,20 @@ namespace YUME
 			}
 
 			auto mesh = CreateRef<Mesh>(indices, vertices);
+			if (m_Cooker)
+				m_Cooker->AddGeometry(mesh.get(), vertices.data(), (uint32_t)vertices.size(), indices.data(), numIndices);
+
 			auto material = CreateRef<Material>();
 			material->SetProperties(properties);
 			mesh->SetMaterial(material);
 			m_Meshes.push_back(mesh);
 		}
 
+		if (totalCorners > 0)
+			YM_CORE_INFO(OBJ_PREFIX "{}: {} vertices after merging {} face corners ({:.1f}%)", p_Path, totalVertices, totalCorners, 100.0 * double(totalVertices) / double(totalCorners))
+
+		LogVertexCacheReport(OBJ_PREFIX, p_Path, cacheReport);
+
 		m_TexturesLoaded.clear();
 	}
 
@@ -314,15 +595,34 @@ namespace YUME
 
 	#pragma region GLTF_LOADER
 
-	struct GLTFTexture
+	struct GLTFDecodedImage
 	{
-		tinygltf::Image* Image;
-		tinygltf::Sampler* Sampler;
+		// RGBA8, null if the image couldn't be decoded. Owned as stb returned it, never copied
+		std::unique_ptr<uint8_t, decltype(&Utils::FreeImage)> Pixels{ nullptr, &Utils::FreeImage };
+		size_t Size		= 0;
+		uint32_t Width	= 0;
+		uint32_t Height = 0;
+	};
+
+	// Initialized up front so models can be loaded from several jobs at once
+	static const std::unordered_map<int, int> s_GLTF_COMPONENT_LENGTH_LOOKUP = {
+		{ (int)TINYGLTF_TYPE_SCALAR,					 1 },
+		{ (int)TINYGLTF_TYPE_VEC2,						 2 },
+		{ (int)TINYGLTF_TYPE_VEC3,						 3 },
+		{ (int)TINYGLTF_TYPE_VEC4,						 4 },
+		{ (int)TINYGLTF_TYPE_MAT2,						 4 },
+		{ (int)TINYGLTF_TYPE_MAT3,						 9 },
+		{ (int)TINYGLTF_TYPE_MAT4,						16 }
 	};
 
-	static std::unordered_map<int, int> s_GLTF_COMPONENT_LENGTH_LOOKUP;
-	static std::unordered_map<int, int> s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP;
-	static bool s_MapsInitialised = false;
+	static const std::unordered_map<int, int> s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP = {
+		{ (int)TINYGLTF_COMPONENT_TYPE_BYTE,			 1 },
+		{ (int)TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE,	 1 },
+		{ (int)TINYGLTF_COMPONENT_TYPE_SHORT,			 2 },
+		{ (int)TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT,	 2 },
+		{ (int)TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT,	 4 },
+		{ (int)TINYGLTF_COMPONENT_TYPE_FLOAT,			 4 }
+	};
 
 	static TextureWrap GetWrapMode(int p_Mode)
 	{
@@ -356,112 +656,169 @@ namespace YUME
 		}
 	}
 
-	static std::vector<Ref<Material>> LoadMaterials(tinygltf::Model& p_GLTFModel)
+	// The loader keeps the images as they are in the file, they are decoded here on the job threads
+	static void DecodeImage(const tinygltf::Image& p_Image, uint32_t p_MaxWidth, uint32_t p_MaxHeight, GLTFDecodedImage& p_Result)
 	{
 		YM_PROFILE_FUNCTION()
 
-		std::vector<Ref<Texture2D>> loadedTextures;
-		std::vector<Ref<Material>> loadedMaterials;
-		loadedTextures.reserve(p_GLTFModel.textures.size());
-		loadedMaterials.reserve(p_GLTFModel.materials.size());
+		if (p_Image.image.empty())
+			return;
 
-		for (tinygltf::Texture& gltfTexture : p_GLTFModel.textures)
-		{
-			GLTFTexture imageAndSampler{};
+		// Set per thread by the other image loaders
+		stbi_set_flip_vertically_on_load_thread(false);
 
-			if (gltfTexture.source != -1)
+		int width = 0, height = 0, channels = 0;
+		stbi_uc* pixels = stbi_load_from_memory(p_Image.image.data(), (int)p_Image.image.size(), &width, &height, &channels, STBI_rgb_alpha);
+		if (!pixels)
+			return;
+
+		uint32_t texWidth				= (uint32_t)width;
+		uint32_t texHeight				= (uint32_t)height;
+
+		if (p_MaxWidth > 0 && p_MaxHeight > 0 && (texWidth > p_MaxWidth || texHeight > p_MaxHeight))
+		{
+			float aspectRatio			= static_cast<float>(texWidth) / static_cast<float>(texHeight);
+			if (texWidth > p_MaxWidth)
 			{
-				imageAndSampler.Image		= &p_GLTFModel.images.at(gltfTexture.source);
+				texWidth				= p_MaxWidth;
+				texHeight				= static_cast<uint32_t>(float(p_MaxWidth) / aspectRatio);
 			}
-
-			if (gltfTexture.sampler != -1)
+			if (texHeight > p_MaxHeight)
 			{
-				imageAndSampler.Sampler		= &p_GLTFModel.samplers.at(gltfTexture.sampler);
+				texHeight				= p_MaxHeight;
+				texWidth				= static_cast<uint32_t>(float(p_MaxHeight) * aspectRatio);
 			}
 
-			if (imageAndSampler.Image)
+			uint8_t* resized			= Utils::AllocateImage(size_t(texWidth) * size_t(texHeight) * STBIR_RGBA);
+			if (resized && Utils::ResizeImage(pixels, (uint32_t)width, (uint32_t)height, resized, texWidth, texHeight))
+			{
+				stbi_image_free(pixels);
+				pixels					= resized;
+			}
+			else
 			{
-				int texWidth				= imageAndSampler.Image->width;
-				int texHeight				= imageAndSampler.Image->height;
+				// Kept at full size rather than losing the texture
+				Utils::FreeImage(resized);
+				texWidth				= (uint32_t)width;
+				texHeight				= (uint32_t)height;
+			}
+		}
 
-				TextureSpecification spec	= {};
-				spec.Usage					= TextureUsage::TEXTURE_SAMPLED;
-				spec.Format					= TextureFormat::RGBA8_SRGB;
-				spec.AnisotropyEnable		= true;
-				spec.GenerateMips			= true;
-				spec.MinFilter				= TextureFilter::NEAREST;
-				spec.MagFilter				= TextureFilter::NEAREST;
-				spec.DebugName				= "GLTF - Material Texture";
+		p_Result.Pixels.reset(pixels);
+		p_Result.Size					= size_t(texWidth) * size_t(texHeight) * STBIR_RGBA;
+		p_Result.Width					= texWidth;
+		p_Result.Height					= texHeight;
+	}
 
+	static std::vector<Ref<Material>> LoadMaterials(tinygltf::Model& p_GLTFModel, const std::filesystem::path& p_Directory, CookedMeshWriter* p_Cooker)
+	{
+		YM_PROFILE_FUNCTION()
 
-				if (gltfTexture.sampler != -1)
-				{
-					if (!imageAndSampler.Sampler->name.empty())
-					{
-						spec.DebugName		= "GLTF - " + imageAndSampler.Sampler->name;
-					}
+		std::vector<Ref<Texture2D>> loadedTextures(p_GLTFModel.textures.size());
+		std::vector<Ref<Material>> loadedMaterials;
+		loadedMaterials.reserve(p_GLTFModel.materials.size());
 
-					spec.MinFilter			= GetFilter(imageAndSampler.Sampler->minFilter);
-					spec.MagFilter			= GetFilter(imageAndSampler.Sampler->minFilter);
-					spec.WrapU				= GetWrapMode(imageAndSampler.Sampler->wrapS);
-					spec.WrapV				= GetWrapMode(imageAndSampler.Sampler->wrapT);
-				}
-				else
-				{
-					YM_CORE_WARN(GLTF_PREFIX "MISSING SAMPLER");
-				}
+		// Every image used by a texture is decoded once, however many textures and materials share it
+		std::vector<int> usedImages;
+		std::vector<GLTFDecodedImage> decodedImages(p_GLTFModel.images.size());
+		for (const tinygltf::Texture& gltfTexture : p_GLTFModel.textures)
+		{
+			if (gltfTexture.source >= 0 && gltfTexture.source < (int)p_GLTFModel.images.size())
+				usedImages.push_back(gltfTexture.source);
+		}
 
-				uint8_t* pixels				= imageAndSampler.Image->image.data();
+		std::sort(usedImages.begin(), usedImages.end());
+		usedImages.erase(std::unique(usedImages.begin(), usedImages.end()), usedImages.end());
 
-				uint32_t maxWidth			= 2048;
-				uint32_t maxHeight			= 2048;
-				Utils::GetMaxImagesSize(&maxWidth, &maxHeight);
+		uint32_t maxWidth			= 2048;
+		uint32_t maxHeight			= 2048;
+		Utils::GetMaxImagesSize(&maxWidth, &maxHeight);
 
-				bool freeData				= false;
+		{
+			YM_PROFILE_SCOPE("Decode GLTF Images")
 
-				if (maxWidth > 0 && maxHeight > 0 && (uint32_t(texWidth) > maxWidth || uint32_t(texHeight) > maxHeight))
-				{
-					int texWidthOld			= imageAndSampler.Image->width;
-					int texHeightOld		= imageAndSampler.Image->height;
+			JobSystem::ParallelFor((uint32_t)usedImages.size(), 1, [&](uint32_t p_Index)
+			{
+				tinygltf::Image& image = p_GLTFModel.images[usedImages[p_Index]];
+				DecodeImage(image, maxWidth, maxHeight, decodedImages[usedImages[p_Index]]);
 
-					float aspectRatio		= static_cast<float>(texWidth) / static_cast<float>(texHeight);
-					if (uint32_t(texWidth) > maxWidth)
-					{
-						texWidth			= maxWidth;
-						texHeight			= static_cast<uint32_t>(float(maxWidth) / aspectRatio);
-					}
-					if (uint32_t(texHeight) > maxHeight)
-					{
-						texHeight			= maxHeight;
-						texWidth			= static_cast<uint32_t>(float(maxHeight) * aspectRatio);
-					}
+				image.image.clear();
+				image.image.shrink_to_fit();
+			});
+		}
 
-					// Resize the image using stbir (a simple image resizing library)
-					int resizedChannels		= STBIR_RGBA; // RGBA format
-					stbi_uc* resizedPixels  = (stbi_uc*)malloc(texWidth * texHeight * resizedChannels);
-					stbir_resize_uint8_linear(pixels, texWidthOld, texHeightOld, 0, resizedPixels, texWidth, texHeight, 0, STBIR_RGBA);
+		// Textures with the same image and sampler are the same GPU texture
+		std::map<std::pair<int, int>, Ref<Texture2D>> createdTextures;
 
-					pixels					= resizedPixels;
-					freeData				= true;
-				}
+		for (size_t i = 0; i < p_GLTFModel.textures.size(); i++)
+		{
+			const tinygltf::Texture& gltfTexture = p_GLTFModel.textures[i];
+			if (gltfTexture.source < 0 || gltfTexture.source >= (int)p_GLTFModel.images.size())
+				continue;
 
-				spec.Width					= (uint32_t)texWidth;
-				spec.Height					= (uint32_t)texHeight;
-				Ref<Texture2D> texture2D	= Texture2D::Create(spec, pixels, texWidth * texHeight * STBIR_RGBA);
-				if (texture2D)
-				{
-					loadedTextures.push_back(texture2D);
-				}
-				else
+			auto created = createdTextures.find({ gltfTexture.source, gltfTexture.sampler });
+			if (created != createdTextures.end())
+			{
+				loadedTextures[i] = created->second;
+				continue;
+			}
+
+			const tinygltf::Image& image	 = p_GLTFModel.images[gltfTexture.source];
+			const GLTFDecodedImage& decoded	 = decodedImages[gltfTexture.source];
+			if (!decoded.Pixels)
+			{
+				YM_CORE_ERROR(GLTF_PREFIX "Failed to decode image '{}'", image.uri.empty() ? image.name : image.uri)
+				continue;
+			}
+
+			TextureSpecification spec	= {};
+			spec.Usage					= TextureUsage::TEXTURE_SAMPLED;
+			spec.Format					= TextureFormat::RGBA8_SRGB;
+			spec.AnisotropyEnable		= true;
+			spec.GenerateMips			= true;
+			spec.MinFilter				= TextureFilter::NEAREST;
+			spec.MagFilter				= TextureFilter::NEAREST;
+			spec.DebugName				= "GLTF - Material Texture";
+
+			if (gltfTexture.sampler != -1)
+			{
+				const tinygltf::Sampler& sampler = p_GLTFModel.samplers.at(gltfTexture.sampler);
+				if (!sampler.name.empty())
 				{
-					YM_CORE_ERROR(GLTF_PREFIX "Failed to create texture!");
+					spec.DebugName		= "GLTF - " + sampler.name;
 				}
 
-				if (freeData)
-					free(pixels);
+				spec.MinFilter			= GetFilter(sampler.minFilter);
+				spec.MagFilter			= GetFilter(sampler.minFilter);
+				spec.WrapU				= GetWrapMode(sampler.wrapS);
+				spec.WrapV				= GetWrapMode(sampler.wrapT);
+			}
+			else
+			{
+				YM_CORE_WARN(GLTF_PREFIX "MISSING SAMPLER");
+			}
 
-				imageAndSampler.Image->image.clear();
-				imageAndSampler.Image->image.shrink_to_fit();
+			spec.Width					= decoded.Width;
+			spec.Height					= decoded.Height;
+			Ref<Texture2D> texture2D	= Texture2D::Create(spec, decoded.Pixels.get(), decoded.Size);
+			if (texture2D)
+			{
+				loadedTextures[i] = texture2D;
+				createdTextures[{ gltfTexture.source, gltfTexture.sampler }] = texture2D;
+
+				if (p_Cooker)
+				{
+					// Files next to the model are referenced, embedded images are stored with the cooked model
+					const std::string& uri = image.uri;
+					if (!uri.empty() && uri.rfind("data:", 0) != 0 && std::filesystem::exists(p_Directory / uri))
+						p_Cooker->AddTexture(texture2D.get(), (p_Directory / uri).string());
+					else
+						p_Cooker->AddTexture(texture2D.get(), decoded.Pixels.get(), decoded.Size);
+				}
+			}
+			else
+			{
+				YM_CORE_ERROR(GLTF_PREFIX "Failed to create texture!");
 			}
 		}
 
@@ -470,9 +827,9 @@ namespace YUME
 			if (p_Index >= 0)
 			{
 				const tinygltf::Texture& tex = p_GLTFModel.textures[p_Index];
-				if (tex.source >= 0 && tex.source < loadedTextures.size())
+				if (p_Index < (int)loadedTextures.size())
 				{
-					return loadedTextures[tex.source];
+					return loadedTextures[p_Index];
 				}
 			}
 			return Ref<Texture2D>();
@@ -517,13 +874,13 @@ namespace YUME
 				if (metallicGlossinessWorkflow->second.Has("diffuseTexture"))
 				{
 					int index = metallicGlossinessWorkflow->second.Get("diffuseTexture").Get("index").Get<int>();
-					properties.Textures.AlbedoMap = loadedTextures[p_GLTFModel.textures[index].source];
+					properties.Textures.AlbedoMap = TextureName(index);
 				}
 
 				if (metallicGlossinessWorkflow->second.Has("metallicGlossinessTexture"))
 				{
 					int index = metallicGlossinessWorkflow->second.Get("metallicGlossinessTexture").Get("index").Get<int>();
-					properties.Textures.RoughnessMap = loadedTextures[p_GLTFModel.textures[index].source];
+					properties.Textures.RoughnessMap = TextureName(index);
 				}
 
 				if (metallicGlossinessWorkflow->second.Has("diffuseFactor"))
@@ -561,7 +918,7 @@ namespace YUME
 		return loadedMaterials;
 	}
 
-	static std::vector<Mesh*> LoadMesh(tinygltf::Model& p_Model, tinygltf::Mesh& p_Mesh, std::vector<Ref<Material>>& p_Materials, Math::Transform& p_ParentTransform, bool p_FlipYTexCoord)
+	static std::vector<Mesh*> LoadMesh(tinygltf::Model& p_Model, tinygltf::Mesh& p_Mesh, std::vector<Ref<Material>>& p_Materials, Math::Transform& p_ParentTransform, bool p_FlipYTexCoord, CookedMeshWriter* p_Cooker, VertexCacheReport& p_CacheReport)
 	{
 		std::vector<Mesh*> meshes;
 
@@ -584,8 +941,8 @@ namespace YUME
 				auto& bufferView = p_Model.bufferViews.at(accessor.bufferView);
 				auto& buffer	 = p_Model.buffers.at(bufferView.buffer);
 
-				int componentLength		  = s_GLTF_COMPONENT_LENGTH_LOOKUP[accessor.type];
-				int componentTypeByteSize = s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP[accessor.componentType];
+				int componentLength		  = s_GLTF_COMPONENT_LENGTH_LOOKUP.at(accessor.type);
+				int componentTypeByteSize = s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP.at(accessor.componentType);
 
 				int stride				  = accessor.ByteStride(bufferView);
 
@@ -669,8 +1026,8 @@ namespace YUME
 					auto indexBufferView = p_Model.bufferViews.at(indexAccessor.bufferView);
 					auto indexBuffer	 = p_Model.buffers.at(indexBufferView.buffer);
 
-					int componentLength = s_GLTF_COMPONENT_LENGTH_LOOKUP[indexAccessor.type];
-					int componentTypeByteSize = s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP[indexAccessor.componentType];
+					int componentLength = s_GLTF_COMPONENT_LENGTH_LOOKUP.at(indexAccessor.type);
+					int componentTypeByteSize = s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP.at(indexAccessor.componentType);
 
 					// Extra index data
 					size_t bufferOffset = indexBufferView.byteOffset + indexAccessor.byteOffset;
@@ -729,8 +1086,12 @@ namespace YUME
 			if (!hasNormals)
 				Mesh::GenerateNormals(vertices.data(), uint32_t(vertices.size()), indices.data(), uint32_t(indices.size()));
 
+			MeshOptimizer::Optimize(vertices, indices, &p_CacheReport.Before, &p_CacheReport.After);
+
 			// Add mesh
 			Mesh* lMesh = new Mesh(indices, vertices);
+			if (p_Cooker)
+				p_Cooker->AddGeometry(lMesh, vertices.data(), uint32_t(vertices.size()), indices.data(), uint32_t(indices.size()));
 
 			meshes.emplace_back(lMesh);
 		}
@@ -738,7 +1099,7 @@ namespace YUME
 		return meshes;
 	}
 
-	static void LoadNode(Model* p_MainModel, int p_NodeIndex, const glm::mat4& p_ParentTransform, tinygltf::Model& p_Model, std::vector<Ref<Material>>& p_Materials, bool p_FlipYTexCoord)
+	static void LoadNode(Model* p_MainModel, int p_NodeIndex, const glm::mat4& p_ParentTransform, tinygltf::Model& p_Model, std::vector<Ref<Material>>& p_Materials, bool p_FlipYTexCoord, CookedMeshWriter* p_Cooker, VertexCacheReport& p_CacheReport)
 	{
 		YM_PROFILE_FUNCTION()
 
@@ -803,7 +1164,7 @@ namespace YUME
 		{
 			int subIndex = 0;
 
-			auto meshes = LoadMesh(p_Model, p_Model.meshes[node.mesh], p_Materials, transform, p_FlipYTexCoord);
+			auto meshes = LoadMesh(p_Model, p_Model.meshes[node.mesh], p_Materials, transform, p_FlipYTexCoord, p_Cooker, p_CacheReport);
 
 			for (auto& mesh : meshes)
 			{
@@ -826,7 +1187,7 @@ namespace YUME
 		{
 			for (int child : node.children)
 			{
-				LoadNode(p_MainModel, child, transform.GetLocalMatrix(), p_Model, p_Materials, p_FlipYTexCoord);
+				LoadNode(p_MainModel, child, transform.GetLocalMatrix(), p_Model, p_Materials, p_FlipYTexCoord, p_Cooker, p_CacheReport);
 			}
 		}
 	}
@@ -834,30 +1195,13 @@ namespace YUME
 
 	void Model::LoadModelGLTF(const std::string& p_Path, bool p_FlipYTexCoord)
 	{
-		if (!s_MapsInitialised)
-		{
-			s_GLTF_COMPONENT_LENGTH_LOOKUP.insert({		(int)TINYGLTF_TYPE_SCALAR,					 1 });
-			s_GLTF_COMPONENT_LENGTH_LOOKUP.insert({		(int)TINYGLTF_TYPE_VEC2,					 2 });
-			s_GLTF_COMPONENT_LENGTH_LOOKUP.insert({		(int)TINYGLTF_TYPE_VEC3,					 3 });
-			s_GLTF_COMPONENT_LENGTH_LOOKUP.insert({		(int)TINYGLTF_TYPE_VEC4,					 4 });
-			s_GLTF_COMPONENT_LENGTH_LOOKUP.insert({		(int)TINYGLTF_TYPE_MAT2,					 4 });
-			s_GLTF_COMPONENT_LENGTH_LOOKUP.insert({		(int)TINYGLTF_TYPE_MAT3,					 9 });
-			s_GLTF_COMPONENT_LENGTH_LOOKUP.insert({		(int)TINYGLTF_TYPE_MAT4,					16 });
-
-
-			s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP.insert({	(int)TINYGLTF_COMPONENT_TYPE_BYTE,			 1 });
-			s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP.insert({	(int)TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE,	 1 });
-			s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP.insert({	(int)TINYGLTF_COMPONENT_TYPE_SHORT,			 2 });
-			s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP.insert({	(int)TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, 2 });
-			s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP.insert({	(int)TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT,	 4 });
-			s_GLTF_COMPONENT_BYTE_SIZE_LOOKUP.insert({	(int)TINYGLTF_COMPONENT_TYPE_FLOAT,			 4 });
-
-			s_MapsInitialised = true;
-		}
+		YM_PROFILE_FUNCTION()
 
 		std::filesystem::path path = std::filesystem::path(p_Path);
 		tinygltf::Model model;
 		tinygltf::TinyGLTF loader;
+		// Decoded by LoadMaterials in parallel, and only the images a texture uses
+		loader.SetImagesAsIs(true);
 		std::string error;
 		std::string warn;
 
@@ -868,12 +1212,12 @@ namespace YUME
 		if (ext == "glb") // assume binary glTF.
 		{
 			YM_PROFILE_SCOPE(".glb binary loading");
-			ret = tinygltf::TinyGLTF().LoadBinaryFromFile(&model, &error, &warn, p_Path);
+			ret = loader.LoadBinaryFromFile(&model, &error, &warn, p_Path);
 		}
 		else // assume ascii glTF.
 		{
 			YM_PROFILE_SCOPE(".gltf loading");
-			ret = tinygltf::TinyGLTF().LoadASCIIFromFile(&model, &error, &warn, p_Path);
+			ret = loader.LoadASCIIFromFile(&model, &error, &warn, p_Path);
 		}
 
 		if (!error.empty())
@@ -903,18 +1247,31 @@ namespace YUME
 			return;
 		}
 
+		if (m_Cooker)
+		{
+			// Images referenced by a texture are added with it
+			for (const auto& buffer : model.buffers)
+			{
+				if (!buffer.uri.empty() && buffer.uri.rfind("data:", 0) != 0)
+					m_Cooker->AddDependency(path.parent_path() / buffer.uri);
+			}
+		}
+
 		{
 			YM_PROFILE_SCOPE("Parse GLTF Model")
 
-			auto loadedMaterials = LoadMaterials(model);
+			auto loadedMaterials = LoadMaterials(model, path.parent_path(), m_Cooker);
+			VertexCacheReport cacheReport;
 
 			std::string name = path.stem().string();
 
 			const tinygltf::Scene& gltfScene = model.scenes[std::max(0, model.defaultScene)];
 			for (size_t i = 0; i < gltfScene.nodes.size(); i++)
 			{
-				LoadNode(this, gltfScene.nodes[i], glm::mat4(1.0f), model, loadedMaterials, p_FlipYTexCoord);
+				LoadNode(this, gltfScene.nodes[i], glm::mat4(1.0f), model, loadedMaterials, p_FlipYTexCoord, m_Cooker, cacheReport);
 			}
+
+			LogVertexCacheReport(GLTF_PREFIX, p_Path, cacheReport);
 		}
 	}
 
@@ -8,6 +8,8 @@
 
 namespace YUME
 {
+	class YM_API CookedMeshWriter;
+
 	class YM_API Model : public Asset
 	{
 		ASSET_CLASS_TYPE(Model)
@@ -16,8 +18,14 @@ namespace YUME
 			Model() = default;
 			Model(const std::string& p_Path, bool p_FlipYTexCoord = false);
 
+			// Prefers <p_Path>.ymesh while none of the files it was imported from changed, otherwise
+			// imports the source and writes it. A .ymesh path is loaded as is.
 			void LoadModel(const std::string& p_Path, bool p_FlipYTexCoord = false);
 
+			// Imports an OBJ or glTF file and writes <p_Path>.ymesh, even if one is up to date
+			static bool Cook(const std::string& p_Path, bool p_FlipYTexCoord = false);
+			static std::string GetCookedPath(const std::string& p_Path);
+
 			void AddMesh(const Ref<Mesh>& p_Mesh) { m_Meshes.push_back(p_Mesh); }
 
 			std::vector<Ref<Mesh>>& GetMeshes() { return m_Meshes; }
@@ -30,11 +38,17 @@ namespace YUME
 		private:
 			Ref<Texture2D> LoadMaterialTexture(const std::string& p_Path, const TextureSpecification& p_Spec);
 
+			bool LoadModelSource(const std::string& p_Path, bool p_FlipYTexCoord);
+			// p_CheckSource when it stands in for its source: the flags and the files it was imported from must match
+			bool LoadModelCooked(const std::string& p_Path, bool p_FlipYTexCoord, bool p_CheckSource = true);
+
 			void LoadModelOBJ(const std::string& p_Path, bool p_FlipYTexCoord);
 			void LoadModelGLTF(const std::string& p_Path, bool p_FlipYTexCoord);
 
 		private:
 			std::unordered_map<std::string, Ref<Texture2D>> m_TexturesLoaded;
+			// Only set while the source is being imported
+			CookedMeshWriter* m_Cooker = nullptr;
 
 			std::string m_Path = std::string();
 			bool m_GPUInstance = false;
@@ -107,6 +107,16 @@ namespace YUME
 		}
 	}
 
+	void Pipeline::Invalidate(const Shader* p_Shader)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::erase_if(s_PipelineCache, [p_Shader](const auto& p_Entry)
+		{
+			return p_Entry.second.Pipeline && p_Entry.second.Pipeline->GetShader() == p_Shader;
+		});
+	}
+
 	uint32_t Pipeline::GetWidth()
 	{
 		YM_PROFILE_FUNCTION()
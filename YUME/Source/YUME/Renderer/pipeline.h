@@ -69,6 +69,8 @@ namespace YUME
 			static Ref<Pipeline> Get(const PipelineCreateInfo& p_CreateInfo);
 			static void ClearCache();
 			static void DeleteUnusedCache();
+			// Drops the cached pipelines built with p_Shader, Get creates them again from its current code
+			static void Invalidate(const Shader* p_Shader);
 
 		protected:
 			PipelineCreateInfo m_CreateInfo;
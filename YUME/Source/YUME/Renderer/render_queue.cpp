@@ -0,0 +1,104 @@
+#include "YUME/yumepch.h"
+#include "render_queue.h"
+
+// std
+#include <cstring>
+
+
+
+
+namespace YUME
+{
+	static constexpr uint32_t s_RadixBits	 = 8;
+	static constexpr uint32_t s_RadixBuckets = 1u << s_RadixBits;
+	static constexpr uint32_t s_RadixPasses	 = 64 / s_RadixBits;
+
+	// Below this a comparison sort is faster than clearing the histograms
+	static constexpr uint32_t s_MinRadixSortSize = 64;
+
+
+	// Positive floats compare like their bits, negative ones are clamped to zero
+	static uint32_t DepthToBits(float p_Depth)
+	{
+		if (!(p_Depth > 0.0f))
+			return 0;
+
+		uint32_t bits = 0;
+		std::memcpy(&bits, &p_Depth, sizeof(float));
+		return bits;
+	}
+
+
+	uint64_t RenderQueue::MakeKey(RenderQueuePass p_Pass, uint32_t p_Pipeline, uint32_t p_Material, float p_Depth)
+	{
+		YM_CORE_ASSERT(p_Pipeline < MAX_PIPELINES && p_Material < MAX_MATERIALS)
+
+		uint64_t pass	  = (uint64_t)p_Pass & 0x3;
+		uint64_t pipeline = (uint64_t)(p_Pipeline & (MAX_PIPELINES - 1));
+		uint64_t material = (uint64_t)(p_Material & (MAX_MATERIALS - 1));
+		uint64_t depth	  = DepthToBits(p_Depth);
+
+		if (p_Pass == RenderQueuePass::Transparent)
+		{
+			// Blending needs back to front across materials, so the depth takes the material's place
+			uint64_t backToFront = (uint64_t)(~(uint32_t)depth);
+			return (pass << 62) | (pipeline << 50) | (backToFront << 18) | material;
+		}
+
+		return (pass << 62) | (pipeline << 50) | (material << 32) | depth;
+	}
+
+	void RenderQueue::Sort()
+	{
+		YM_PROFILE_FUNCTION()
+
+		uint32_t count = (uint32_t)m_Packets.size();
+		if (count < 2)
+			return;
+
+		if (count < s_MinRadixSortSize)
+		{
+			std::stable_sort(m_Packets.begin(), m_Packets.end(), [](const RenderPacket& p_A, const RenderPacket& p_B) { return p_A.Key < p_B.Key; });
+			return;
+		}
+
+		// LSD radix sort, every histogram is built in a single read of the keys
+		uint32_t histograms[s_RadixPasses][s_RadixBuckets] = {};
+		for (const auto& packet : m_Packets)
+		{
+			for (uint32_t pass = 0; pass < s_RadixPasses; pass++)
+				histograms[pass][(packet.Key >> (pass * s_RadixBits)) & (s_RadixBuckets - 1)]++;
+		}
+
+		m_Scratch.resize(count);
+
+		auto* src = &m_Packets;
+		auto* dst = &m_Scratch;
+		for (uint32_t pass = 0; pass < s_RadixPasses; pass++)
+		{
+			auto& histogram = histograms[pass];
+			uint32_t shift	= pass * s_RadixBits;
+
+			// Every key has the same digit, the pass wouldn't move anything.
+			// Mostly the pass and pipeline bytes, which rarely differ.
+			if (histogram[((*src)[0].Key >> shift) & (s_RadixBuckets - 1)] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t bucket = 0; bucket < s_RadixBuckets; bucket++)
+			{
+				uint32_t size	  = histogram[bucket];
+				histogram[bucket] = offset;
+				offset			 += size;
+			}
+
+			for (const auto& packet : *src)
+				(*dst)[histogram[(packet.Key >> shift) & (s_RadixBuckets - 1)]++] = packet;
+
+			std::swap(src, dst);
+		}
+
+		if (src != &m_Packets)
+			m_Packets.swap(m_Scratch);
+	}
+}
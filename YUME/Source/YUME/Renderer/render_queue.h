@@ -0,0 +1,51 @@
+#pragma once
+#include "YUME/Core/base.h"
+
+// std
+#include <vector>
+
+
+
+namespace YUME
+{
+	enum class RenderQueuePass : uint8_t
+	{
+		Opaque = 0,
+		Transparent
+	};
+
+	struct RenderPacket
+	{
+		uint64_t Key   = 0;
+		uint32_t Index = 0; // Into the caller's draw list
+	};
+
+	// Draws are pushed with a 64 bit key and radix sorted, consecutive packets only differ in the state that changes.
+	// Key layout, high to low: pass (2 bits), pipeline (12 bits), material (18 bits), depth (32 bits).
+	// Opaque packets go front to back, transparent ones back to front with the depth above the material.
+	class YM_API RenderQueue
+	{
+		public:
+			static constexpr uint32_t MAX_PIPELINES = 1u << 12;
+			static constexpr uint32_t MAX_MATERIALS = 1u << 18;
+
+			// p_Depth is any non negative distance that grows away from the viewer
+			static uint64_t MakeKey(RenderQueuePass p_Pass, uint32_t p_Pipeline, uint32_t p_Material, float p_Depth);
+
+			static RenderQueuePass GetPass(uint64_t p_Key) { return (RenderQueuePass)(p_Key >> 62); }
+
+			void Clear() { m_Packets.clear(); }
+			void Push(uint64_t p_Key, uint32_t p_Index) { m_Packets.push_back({ p_Key, p_Index }); }
+
+			// Stable, packets with the same key keep the order they were pushed in
+			void Sort();
+
+			const std::vector<RenderPacket>& GetPackets() const { return m_Packets; }
+			uint32_t GetSize() const { return (uint32_t)m_Packets.size(); }
+			bool IsEmpty() const { return m_Packets.empty(); }
+
+		private:
+			std::vector<RenderPacket> m_Packets;
+			std::vector<RenderPacket> m_Scratch;
+	};
+}
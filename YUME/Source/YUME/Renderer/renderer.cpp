@@ -10,9 +10,13 @@
 #include "YUME/Core/application.h"
 #include "YUME/Utils/timer.h"
 #include "buffer.h"
+#include "geometry_pool.h"
+#include "render_queue.h"
 #include "YUME/Core/command_buffer.h"
+#include "YUME/Core/jobs.h"
 #include "YUME/Scene/Component/components_3D.h"
 #include "YUME/Utils/clock.h"
+#include "YUME/Math/frustum.h"
 //#include "Platform/Vulkan/Renderer/vulkan_swapchain.h"
 
 
@@ -56,6 +60,7 @@ namespace YUME
 		PolygonMode DrawPolygonMode = PolygonMode::FILL;
 
 		Renderer::Statistics Stats;
+		double LastBeginTime = 0.0;
 	};
 
 	struct QuadData
@@ -139,12 +144,74 @@ namespace YUME
 		Ref<Shader>		   Shader		  = nullptr;
 		Ref<DescriptorSet> DescriptorSet  = nullptr;
 		Ref<Pipeline>	   Pipeline	      = nullptr;
+		DescriptorHandle   CameraBinding;
 
+		// Not instanced, every visible mesh is a packet
+		RenderQueue		   Queue;
+		std::vector<std::pair<Ref<Mesh>, glm::mat4>> Draws;
+		std::unordered_map<Material*, uint32_t>		 MaterialIDs;
 
 		void Init(const std::string& p_ShaderPath = "assets/shaders/solid_shader.glsl");
 		void Begin(bool p_CustomPCI = false, const PipelineCreateInfo& p_PCI = {});
 	};
 
+	// Visible meshes grouped by mesh, a mesh owns its material so every batch is a single instanced draw
+	struct InstanceBatcher
+	{
+		static const uint32_t INITIAL_CAPACITY = 1024;
+		static const uint32_t INITIAL_DRAW_CAPACITY = 256;
+
+		struct Batch
+		{
+			Ref<Mesh>		   MeshRef		  = nullptr;
+			uint32_t		   First		  = 0;
+			uint32_t		   Count		  = 0;
+			uint32_t		   MaterialIndex  = 0; // Bindless only
+			float			   Depth		  = FLT_MAX; // Closest instance
+			uint64_t		   Key			  = 0;
+		};
+
+		std::vector<Batch>	   Batches;
+		std::vector<glm::mat4> Transforms; // Batches[i] reads [First, First + Count)
+		Ref<StorageBuffer>	   Buffer		  = nullptr;
+
+		std::unordered_map<Mesh*, uint32_t>			BatchIndices;
+		std::vector<std::pair<uint32_t, glm::mat4>> Instances;
+
+		RenderQueue			   Queue;
+		std::vector<Batch>	   SortedBatches;
+		std::vector<uint32_t>  Remap;
+		std::unordered_map<const void*, uint32_t> StateIDs; // Dense per frame IDs for the sort keys
+
+		// Multi draw indirect, one command per batch and one indirect call per range of batches sharing a geometry page
+		struct DrawData
+		{
+			uint32_t	   InstanceOffset = 0;
+			uint32_t	   MaterialIndex  = 0;
+		};
+		struct DrawRange
+		{
+			Ref<GeometryPage> Page		  = nullptr;
+			uint32_t		   First		  = 0;
+			uint32_t		   Count		  = 0;
+		};
+		std::vector<DrawIndexedIndirectCommand> Commands;
+		std::vector<DrawData>  Draws; // Read with gl_DrawID, same order as Commands
+		std::vector<DrawRange> Ranges;
+		Ref<StorageBuffer>	   IndirectBuffer = nullptr;
+		Ref<StorageBuffer>	   DrawBuffer	  = nullptr;
+
+		void Init(bool p_Indirect = false);
+		void Clear();
+		void Add(const Ref<Mesh>& p_Mesh, const glm::mat4& p_Transform, bool p_Merge = true, float p_Depth = 0.0f);
+		uint32_t GetStateID(const void* p_State);
+		// Reorders the batches by their key, before Upload so the transforms follow the draw order
+		void Sort(const std::function<uint64_t(const Batch& p_Batch)>& p_MakeKey);
+		void Upload();
+		// After Upload, reorders the batches by pass and geometry page
+		void UploadIndirect(uint32_t p_MaxDrawCount);
+	};
+
 	struct ForwardPBRData
 	{
 		static const uint8_t MAX_LIGHTS = 16;
@@ -168,8 +235,55 @@ namespace YUME
 		} LightBuffer;
 		Ref<UniformBuffer> LightUBO = nullptr;
 
-		void Init(const std::string& p_ShaderPath = "assets/shaders/pbr_shader.glsl");
+		InstanceBatcher	   Instances;
+
+		// Set 0 bindings written every frame, resolved once in Init
+		struct
+		{
+			DescriptorHandle Camera;
+			DescriptorHandle Lights;
+			DescriptorHandle ShadowBuffer;
+			DescriptorHandle ShadowMap;
+			DescriptorHandle Instances;
+			DescriptorHandle Draws;
+			DescriptorHandle Materials;
+		} Bindings;
+
+		// Bindless path, one texture array and material table for every draw instead of a set per material
+		struct GPUMaterial
+		{
+			glm::vec4	   AlbedoColor{ 1.0f };
+			uint32_t	   AlbedoTexture	  = 0;
+			uint32_t	   NormalTexture	  = 0;
+			uint32_t	   SpecularTexture	  = 0;
+			uint32_t	   RoughnessTexture	  = 0;
+			uint32_t	   MetallicTexture	  = 0;
+			uint32_t	   AoTexture		  = 0;
+			int			   SpecularMap		  = 0;
+			int			   NormalMap		  = 0;
+			float		   AlphaCutOff		  = 0.1f;
+			float		   Padding[3]{}; // std430 array stride
+		};
+		static_assert(sizeof(GPUMaterial) == 64);
+		bool							 Bindless		= false;
+		bool							 Indirect		= false; // Bindless only, the material index comes from the draw data
+		Ref<DescriptorSet>				 TextureSet		= nullptr;
+		bool							 TexturesDirty	= false;
+		uint32_t						 MaxTextures	= 0;
+		std::vector<Ref<Texture2D>>		 Textures; // Registered textures stay alive while the pass exists
+		std::unordered_map<Texture*, uint32_t>	TextureIndices;
+		std::vector<Ref<Material>>		 Materials;
+		std::vector<GPUMaterial>		 MaterialTable;
+		std::unordered_map<Material*, uint32_t> MaterialIndices;
+		Ref<StorageBuffer>				 MaterialBuffer = nullptr;
+
+		void Init(const std::string& p_ShaderPath = "assets/shaders/pbr_shader.glsl", const std::string& p_BindlessShaderPath = "assets/shaders/pbr_bindless_shader.glsl",
+			const std::string& p_IndirectShaderPath = "assets/shaders/pbr_indirect_shader.glsl");
 		void Begin(bool p_CustomPCI = false, const PipelineCreateInfo& p_PCI = {});
+
+		uint32_t GetTextureIndex(const Ref<Texture2D>& p_Texture);
+		uint32_t GetMaterialIndex(const Ref<Material>& p_Material);
+		void UploadMaterials(CommandBuffer* p_CommandBuffer);
 	};
 	
 	struct ShadowData
@@ -187,6 +301,14 @@ namespace YUME
 		Ref<Shader>		   Shader			  = nullptr;
 		Ref<Pipeline>	   Pipeline			  = nullptr;
 		Ref<DescriptorSet> DescriptorSet	  = nullptr;
+		bool			   Indirect			  = false;
+
+		struct
+		{
+			DescriptorHandle LightBuffer;
+			DescriptorHandle Instances;
+			DescriptorHandle Draws;
+		} Bindings;
 
 		glm::vec3		   LightPosition	  = { -41.0f,  16.0f, -47.0f };
 		glm::vec3		   LightDirection	  = {  45.0f, -45.0f, -90.0f };
@@ -206,6 +328,8 @@ namespace YUME
 		} LightSpaceBuffer;
 		Ref<UniformBuffer> LightSpaceUBO = nullptr;
 
+		InstanceBatcher	   Instances;
+
 		void Init();
 		void Begin();
 	};
@@ -298,32 +422,95 @@ namespace YUME
 			delete s_OITData;
 
 		Material::DestroyDefaultTextures();
+		GeometryPool::Shutdown();
 
 		delete s_RenderData;
 	}
 
 
-	void Renderer::Init()
+	// The sphere test is cheap and rejects most meshes before the box is transformed
+	static bool IsMeshVisible(const Math::Frustum& p_Frustum, const Ref<Mesh>& p_Mesh, const glm::mat4& p_Transform)
+	{
+		if (!p_Mesh->GetBoundingBox().IsValid())
+			return true;
+
+		if (!p_Frustum.IsInside(Math::TransformSphere(p_Mesh->GetBoundingSphere(), p_Transform)))
+			return false;
+
+		return p_Frustum.IsInside(p_Mesh->GetBoundingBox().Transformed(p_Transform));
+	}
+
+	// Squared distance from p_Eye to the mesh's bounds, only used to order the draws
+	static float GetMeshDepth(const glm::vec3& p_Eye, const Ref<Mesh>& p_Mesh, const glm::mat4& p_Transform)
+	{
+		glm::vec3 delta = glm::vec3(p_Transform * glm::vec4(p_Mesh->GetBoundingSphere().Center, 1.0f)) - p_Eye;
+		return glm::dot(delta, delta);
+	}
+
+	static RenderQueuePass GetMeshPass(const Ref<Mesh>& p_Mesh)
+	{
+		const auto& material = p_Mesh->GetMaterial();
+		if (material && material->GetProperties().Surface == SurfaceType::Transparent)
+			return RenderQueuePass::Transparent;
+
+		return RenderQueuePass::Opaque;
+	}
+
+	// Below this many draws per thread a secondary costs more than it saves
+	static constexpr uint32_t s_MinDrawsPerRecordingJob = 64;
+
+	using RecordFunction = std::function<void(CommandBuffer* p_CommandBuffer, uint32_t p_First, uint32_t p_Last)>;
+
+	// Records the draws [0, p_DrawCount) of p_Pipeline's pass, split across the job system threads when there are enough of them.
+	// Secondaries inherit nothing but the pass, so p_Record sets its own viewport, descriptor sets and push constants.
+	static void RecordPass(CommandBuffer* p_CommandBuffer, const Ref<Pipeline>& p_Pipeline, uint32_t p_DrawCount, const RecordFunction& p_Record)
 	{
 		YM_PROFILE_FUNCTION()
 
-		YM_CORE_TRACE("Renderer Initialized!")
+		uint32_t threadCount = JobSystem::GetWorkerCount() + 1;
+		uint32_t jobCount	 = std::min(threadCount, p_DrawCount / s_MinDrawsPerRecordingJob);
 
-		s_RenderData = new RenderData();
+		if (!s_RenderData->Settings.ParallelRecording || jobCount < 2)
+		{
+			p_Pipeline->Begin(p_CommandBuffer);
+			p_Record(p_CommandBuffer, 0, p_DrawCount);
+			p_Pipeline->End(p_CommandBuffer);
+			return;
+		}
 
-		s_RenderData->FinalPassShader = Shader::Create("assets/shaders/FinalPassShader.glsl");
-		auto shader = Shader::Create("assets/shaders/pbr_shader.glsl");
+		auto context		 = Application::Get().GetWindow().GetContext();
+		uint32_t drawsPerJob = (p_DrawCount + jobCount - 1) / jobCount;
 
-		s_RenderData->FinalPassDescriptorSet = DescriptorSet::Create({/* Set */ 0, s_RenderData->FinalPassShader});
+		// Executed in job order, the draws end up in the same order as inline
+		std::vector<CommandBuffer*> secondaries(jobCount, nullptr);
 
-		uint8_t whiteData[] = { 255, 255, 255, 255 };
-		s_RenderData->WhiteTexture = Texture2D::Create({}, whiteData, sizeof(whiteData));
+		p_Pipeline->Begin(p_CommandBuffer, SubpassContents::SECONDARY);
 
-		Material::CreateDefaultTextures();
-		
-		s_RenderData->CameraUniformBuffer = UniformBuffer::Create(sizeof(RenderData::CameraData));
+		JobSystem::ParallelFor(jobCount, 1, [&](uint32_t p_Job)
+		{
+			uint32_t first = p_Job * drawsPerJob;
+			uint32_t last  = std::min(first + drawsPerJob, p_DrawCount);
 
-		if (s_RenderData->Settings.OIT)
+			auto secondary = context->GetSecondaryCommandBuffer();
+			secondary->BeginSecondary(p_Pipeline);
+			p_Record(secondary, first, last);
+			secondary->End();
+
+			secondaries[p_Job] = secondary;
+		});
+
+		for (auto secondary : secondaries)
+			secondary->ExecuteSecondary(p_CommandBuffer);
+
+		p_Pipeline->End(p_CommandBuffer);
+	}
+
+	// Settings can be changed after Init, the passes they enable are created on first use
+	static void InitPasses()
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (s_RenderData->Settings.OIT && !s_OITData)
 		{
 			s_OITData = new OITData();
 
@@ -332,14 +519,14 @@ namespace YUME
 
 		if (s_RenderData->Settings.Renderer2D)
 		{
-			if (!s_RenderData->Settings.OIT && s_RenderData->Settings.Renderer2D_Quad)
+			if (!s_RenderData->Settings.OIT && s_RenderData->Settings.Renderer2D_Quad && !s_QuadData)
 			{
 				s_QuadData = new QuadData();
 
 				s_QuadData->Init();
 			}
 
-			if (!s_RenderData->Settings.OIT && s_RenderData->Settings.Renderer2D_Circle)
+			if (!s_RenderData->Settings.OIT && s_RenderData->Settings.Renderer2D_Circle && !s_CircleData)
 			{
 				s_CircleData = new CircleData();
 
@@ -349,28 +536,28 @@ namespace YUME
 
 		if (s_RenderData->Settings.Renderer3D)
 		{
-			if (s_RenderData->Settings.Skybox)
+			if (s_RenderData->Settings.Skybox && !s_SkyboxData)
 			{
 				s_SkyboxData = new SkyboxData();
 
 				s_SkyboxData->Init();
 			}
 
-			if (!s_RenderData->Settings.OIT && !s_RenderData->Settings.PBR)
+			if (!s_RenderData->Settings.OIT && !s_RenderData->Settings.PBR && !s_ModelData)
 			{
 				s_ModelData = new ModelData();
 
 				s_ModelData->Init();
 			}
 
-			if (!s_RenderData->Settings.OIT && s_RenderData->Settings.PBR)
+			if (!s_RenderData->Settings.OIT && s_RenderData->Settings.PBR && !s_ForwardPBR)
 			{
 				s_ForwardPBR = new ForwardPBRData();
 
 				s_ForwardPBR->Init();
 			}
 
-			if (s_RenderData->Settings.PBR)
+			if (s_RenderData->Settings.PBR && !s_ShadowData)
 			{
 				s_ShadowData = new ShadowData();
 
@@ -379,6 +566,29 @@ namespace YUME
 		}
 	}
 
+	void Renderer::Init()
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_TRACE("Renderer Initialized!")
+
+		s_RenderData = new RenderData();
+
+		s_RenderData->FinalPassShader = Shader::Create("assets/shaders/FinalPassShader.glsl");
+		auto shader = Shader::Create("assets/shaders/pbr_shader.glsl");
+
+		s_RenderData->FinalPassDescriptorSet = DescriptorSet::Create({/* Set */ 0, s_RenderData->FinalPassShader});
+
+		uint8_t whiteData[] = { 255, 255, 255, 255 };
+		s_RenderData->WhiteTexture = Texture2D::Create({}, whiteData, sizeof(whiteData));
+
+		Material::CreateDefaultTextures();
+		
+		s_RenderData->CameraUniformBuffer = UniformBuffer::Create(sizeof(RenderData::CameraData));
+
+		InitPasses();
+	}
+
 	void Renderer::Begin(const RendererBeginInfo& p_BeginInfo)
 	{
 		YM_PROFILE_FUNCTION()
@@ -386,6 +596,8 @@ namespace YUME
 		YM_CORE_VERIFY(!s_RenderData->CalledBegin, "Did you call End()?")
 		YM_CORE_VERIFY(p_BeginInfo.Width != 0 && p_BeginInfo.Height != 0)
 
+		InitPasses();
+
 		s_RenderData->CalledBegin = true;
 		s_RenderData->ClearColor = p_BeginInfo.ClearColor;
 		s_RenderData->SwapchainTarget = p_BeginInfo.SwapchainTarget;
@@ -458,6 +670,15 @@ namespace YUME
 		}
 
 		ResetStats();
+
+		auto context			   = Application::Get().GetWindow().GetContext();
+		double time				   = Clock::GetTime();
+		auto& stats				   = s_RenderData->Stats;
+		stats.FrameTimeMs		   = s_RenderData->LastBeginTime > 0.0 ? (time - s_RenderData->LastBeginTime) * 1000.0 : 0.0;
+		stats.FrameWaitTimeMs	   = context->GetFrameWaitTimeMs();
+		stats.FramesInFlight	   = context->GetFramesInFlight();
+		stats.FrameIndex		   = context->GetCurrentFrameIndex();
+		s_RenderData->LastBeginTime = time;
 	}
 
 	void Renderer::End()
@@ -559,20 +780,23 @@ namespace YUME
 			Ref<Pipeline> pipeline = nullptr;
 			Ref<DescriptorSet> descriptorSet = nullptr;
 			Ref<Shader> shader = nullptr;
+			DescriptorHandle cameraBinding{};
 			if (!s_RenderData->Settings.OIT && pbr)
 			{
 				pipeline	  = s_ForwardPBR->Pipeline;
 				descriptorSet = s_ForwardPBR->DescriptorSet;
 				shader		  = s_ForwardPBR->Shader;
+				cameraBinding = s_ForwardPBR->Bindings.Camera;
 			}
 			else if (!s_RenderData->Settings.OIT)
 			{
 				pipeline	  = s_ModelData->Pipeline;
 				descriptorSet = s_ModelData->DescriptorSet;
 				shader		  = s_ModelData->Shader;
+				cameraBinding = s_ModelData->CameraBinding;
 			}
 
-			descriptorSet->SetUniformData("u_Camera", s_RenderData->CameraUniformBuffer);
+			descriptorSet->SetUniformData(cameraBinding, s_RenderData->CameraUniformBuffer);
 			descriptorSet->Upload(commandBuffer);
 
 			if (pbr)
@@ -598,15 +822,11 @@ namespace YUME
 				s_ForwardPBR->LightBuffer.NumLights = index;
 				s_ForwardPBR->LightUBO->SetData(&s_ForwardPBR->LightBuffer, sizeof(ForwardPBRData::LightBufferData));
 
-				descriptorSet->SetUniformData("LightBuffer", s_ForwardPBR->LightUBO);
+				descriptorSet->SetUniformData(s_ForwardPBR->Bindings.Lights, s_ForwardPBR->LightUBO);
 				descriptorSet->Upload(commandBuffer);
 
 				// Shadow
 				{
-					s_ShadowData->Pipeline->Begin(commandBuffer);
-
-					RendererCommand::SetViewport(0, 0, s_ShadowData->Resolution, s_ShadowData->Resolution);
-
 					glm::mat4 projection{ 1.0f };
 					if (s_ShadowData->DebugUBOBuffer.Mode == 0)
 					{
@@ -632,32 +852,87 @@ namespace YUME
 					s_ShadowData->LightSpaceBuffer.LightSpaceMatrix = projection * view;
 					s_ShadowData->LightSpaceUBO->SetData(&s_ShadowData->LightSpaceBuffer, sizeof(ShadowData::UBOData));
 
-					s_ShadowData->DescriptorSet->SetUniformData("u_LightBuffer", s_ShadowData->LightSpaceUBO);
-					s_ShadowData->DescriptorSet->Upload(commandBuffer);
+					Math::Frustum lightFrustum(s_ShadowData->LightSpaceBuffer.LightSpaceMatrix);
+					bool culling	= s_RenderData->Settings.FrustumCulling;
+					bool instancing = s_RenderData->Settings.Instancing;
 
-					RendererCommand::BindDescriptorSets(commandBuffer, &s_ShadowData->DescriptorSet);
+					auto& instances = s_ShadowData->Instances;
+					instances.Clear();
 
 					registry.view<TransformComponent, ModelComponent>().each(
 					[&](auto p_Entt, const TransformComponent& p_Transform, const ModelComponent& p_Model)
 					{
+						auto transform = p_Transform.Transform.GetLocalMatrix();
 						for (const auto& mesh : p_Model.ModelRef->GetMeshes())
 						{
-							auto transform = p_Transform.Transform.GetLocalMatrix();
-							s_ShadowData->Shader->SetPushValue("Transform", &transform);
+							if (culling && !IsMeshVisible(lightFrustum, mesh, transform))
+							{
+								s_RenderData->Stats.ShadowCulledMeshes++;
+								continue;
+							}
+							s_RenderData->Stats.ShadowVisibleMeshes++;
 
-							s_ShadowData->Shader->BindPushConstants(commandBuffer);
-							RendererCommand::DrawMesh(commandBuffer, mesh);
-							s_RenderData->Stats.DrawCalls++;
+							// Same rule as the forward pass, so both passes batch the same meshes
+							bool merge = instancing && GetMeshPass(mesh) != RenderQueuePass::Transparent;
+							instances.Add(mesh, transform, merge, GetMeshDepth(s_ShadowData->LightPosition, mesh, transform));
 						}
 					});
 
-					s_ShadowData->Pipeline->End(commandBuffer);
+					// Depth only, front to back from the light is all that matters
+					instances.Sort([](const InstanceBatcher::Batch& p_Batch)
+					{
+						return RenderQueue::MakeKey(RenderQueuePass::Opaque, 0, 0, p_Batch.Depth);
+					});
+
+					instances.Upload();
+
+					bool indirect = s_ShadowData->Indirect;
+					if (indirect)
+						instances.UploadIndirect(RendererCommand::GetCapabilities().MaxDrawIndirectCount);
+
+					s_ShadowData->DescriptorSet->SetUniformData(s_ShadowData->Bindings.LightBuffer, s_ShadowData->LightSpaceUBO);
+					s_ShadowData->DescriptorSet->Upload(commandBuffer);
+
+					s_ShadowData->DescriptorSet->SetStorageData(s_ShadowData->Bindings.Instances, instances.Buffer);
+					s_ShadowData->DescriptorSet->Upload(commandBuffer);
+
+					if (indirect)
+					{
+						s_ShadowData->DescriptorSet->SetStorageData(s_ShadowData->Bindings.Draws, instances.DrawBuffer);
+						s_ShadowData->DescriptorSet->Upload(commandBuffer);
+					}
+
+					uint32_t drawCount = (uint32_t)(indirect ? instances.Ranges.size() : instances.Batches.size());
+					RecordPass(commandBuffer, s_ShadowData->Pipeline, drawCount,
+					[&](CommandBuffer* p_CommandBuffer, uint32_t p_First, uint32_t p_Last)
+					{
+						RendererCommand::SetViewport(0, 0, s_ShadowData->Resolution, s_ShadowData->Resolution, p_CommandBuffer);
+						RendererCommand::BindDescriptorSets(p_CommandBuffer, &s_ShadowData->DescriptorSet);
+
+						for (uint32_t i = p_First; i < p_Last; i++)
+						{
+							if (indirect)
+							{
+								const auto& range = instances.Ranges[i];
+
+								s_ShadowData->Shader->BindPushConstants(p_CommandBuffer, &range.First, sizeof(uint32_t));
+								RendererCommand::DrawIndexedIndirect(p_CommandBuffer, range.Page->VertexBuffer, range.Page->IndexBuffer, instances.IndirectBuffer, range.First, range.Count);
+								continue;
+							}
+
+							const auto& batch = instances.Batches[i];
+
+							s_ShadowData->Shader->BindPushConstants(p_CommandBuffer, &batch.First, sizeof(uint32_t));
+							RendererCommand::DrawMesh(p_CommandBuffer, batch.MeshRef, batch.Count);
+						}
+					});
+					s_RenderData->Stats.DrawCalls += drawCount;
 				}
 
-				descriptorSet->SetUniformData("u_ShadowBuffer", s_ShadowData->LightSpaceUBO);
+				descriptorSet->SetUniformData(s_ForwardPBR->Bindings.ShadowBuffer, s_ShadowData->LightSpaceUBO);
 				descriptorSet->Upload(commandBuffer);
 
-				descriptorSet->SetTexture("u_ShadowMap", s_ShadowData->ShadowMap);
+				descriptorSet->SetTexture(s_ForwardPBR->Bindings.ShadowMap, s_ShadowData->ShadowMap);
 				descriptorSet->Upload(commandBuffer);
 
 				// shadow debug
@@ -684,29 +959,178 @@ namespace YUME
 			} // pbr
 
 
-			pipeline->Begin(commandBuffer);
+			Math::Frustum cameraFrustum(s_RenderData->CameraBuffer.ViewProjection);
+			bool culling = s_RenderData->Settings.FrustumCulling;
 
-			RendererCommand::SetViewport(0, 0, s_RenderData->Width, s_RenderData->Height);
+			if (pbr)
+			{
+				// The instance buffer has to be written before the pass starts using the set
+				auto& instances = s_ForwardPBR->Instances;
+				instances.Clear();
+
+				bool instancing = s_RenderData->Settings.Instancing;
+				registry.view<TransformComponent, ModelComponent>().each(
+				[&](auto p_Entt, const TransformComponent& p_Transform, const ModelComponent& p_Model)
+				{
+					auto transform = p_Transform.Transform.GetLocalMatrix();
+					for (const auto& mesh : p_Model.ModelRef->GetMeshes())
+					{
+						if (culling && !IsMeshVisible(cameraFrustum, mesh, transform))
+						{
+							s_RenderData->Stats.CulledMeshes++;
+							continue;
+						}
+						s_RenderData->Stats.VisibleMeshes++;
+
+						// Transparent instances are drawn one by one, a merged batch would blend them in insertion order
+						bool merge = instancing && GetMeshPass(mesh) != RenderQueuePass::Transparent;
+						instances.Add(mesh, transform, merge, GetMeshDepth(s_RenderData->CameraBuffer.Position, mesh, transform));
+					}
+				});
+
+				bool bindless = s_ForwardPBR->Bindless;
+				if (bindless)
+				{
+					for (auto& batch : instances.Batches)
+						batch.MaterialIndex = s_ForwardPBR->GetMaterialIndex(batch.MeshRef->GetMaterial());
+				}
+
+				// One pipeline for the pass, consecutive batches with the same material skip the rebind
+				instances.Sort([&](const InstanceBatcher::Batch& p_Batch)
+				{
+					uint32_t material = bindless ? p_Batch.MaterialIndex : instances.GetStateID(p_Batch.MeshRef->GetMaterial().get());
+					return RenderQueue::MakeKey(GetMeshPass(p_Batch.MeshRef), 0, material % RenderQueue::MAX_MATERIALS, p_Batch.Depth);
+				});
+
+				instances.Upload();
+
+				descriptorSet->SetStorageData(s_ForwardPBR->Bindings.Instances, instances.Buffer);
+				descriptorSet->Upload(commandBuffer);
+
+				if (bindless)
+					s_ForwardPBR->UploadMaterials(commandBuffer);
+
+				if (s_ForwardPBR->Indirect)
+				{
+					instances.UploadIndirect(RendererCommand::GetCapabilities().MaxDrawIndirectCount);
+
+					descriptorSet->SetStorageData(s_ForwardPBR->Bindings.Draws, instances.DrawBuffer);
+					descriptorSet->Upload(commandBuffer);
+				}
+			}
+
+			if (pbr)
+			{
+				auto& instances = s_ForwardPBR->Instances;
+				auto& batches	= instances.Batches;
+				bool bindless	= s_ForwardPBR->Bindless;
+				bool indirect	= s_ForwardPBR->Indirect;
+
+				// Material sets are created here, the recording jobs only bind them
+				if (!bindless)
+				{
+					for (auto& batch : batches)
+						batch.MeshRef->GetMaterial()->Prepare(shader, pbr);
+				}
+
+				uint32_t drawCount = (uint32_t)(indirect ? instances.Ranges.size() : batches.size());
+				RecordPass(commandBuffer, pipeline, drawCount,
+				[&](CommandBuffer* p_CommandBuffer, uint32_t p_First, uint32_t p_Last)
+				{
+					RendererCommand::SetViewport(0, 0, s_RenderData->Width, s_RenderData->Height, p_CommandBuffer);
+					RendererCommand::BindDescriptorSets(p_CommandBuffer, &descriptorSet);
+
+					if (bindless)
+						RendererCommand::BindDescriptorSets(p_CommandBuffer, &s_ForwardPBR->TextureSet);
+
+					Material* boundMaterial = nullptr;
+					for (uint32_t i = p_First; i < p_Last; i++)
+					{
+						if (indirect)
+						{
+							const auto& range = instances.Ranges[i];
+
+							// gl_DrawID restarts at zero on every call, DrawOffset is the range's first draw
+							shader->BindPushConstants(p_CommandBuffer, &range.First, sizeof(uint32_t));
+							RendererCommand::DrawIndexedIndirect(p_CommandBuffer, range.Page->VertexBuffer, range.Page->IndexBuffer, instances.IndirectBuffer, range.First, range.Count);
+							continue;
+						}
 
-			RendererCommand::BindDescriptorSets(commandBuffer, &descriptorSet);
+						auto& batch = batches[i];
 
-			registry.view<TransformComponent, ModelComponent>().each(
-			[&] (auto p_Entt, const TransformComponent& p_Transform, const ModelComponent& p_Model)
+						// Batches are sorted by material, the set only changes on key transitions
+						if (!bindless && batch.MeshRef->GetMaterial().get() != boundMaterial)
+						{
+							batch.MeshRef->BindMaterial(p_CommandBuffer, shader, pbr);
+							boundMaterial = batch.MeshRef->GetMaterial().get();
+						}
+
+						// Same layout as the push block, MaterialIndex only exists in the bindless shader
+						uint32_t push[2] = { batch.First, batch.MaterialIndex };
+						shader->BindPushConstants(p_CommandBuffer, push, bindless ? sizeof(push) : sizeof(uint32_t));
+						RendererCommand::DrawMesh(p_CommandBuffer, batch.MeshRef, batch.Count);
+					}
+				});
+				s_RenderData->Stats.DrawCalls += drawCount;
+			}
+			else
 			{
-				for (const auto& mesh : p_Model.ModelRef->GetMeshes())
+				pipeline->Begin(commandBuffer);
+
+				RendererCommand::SetViewport(0, 0, s_RenderData->Width, s_RenderData->Height);
+
+				RendererCommand::BindDescriptorSets(commandBuffer, &descriptorSet);
+
+				auto& queue = s_ModelData->Queue;
+				auto& draws = s_ModelData->Draws;
+				auto& materialIDs = s_ModelData->MaterialIDs;
+				queue.Clear();
+				draws.clear();
+				materialIDs.clear();
+
+				registry.view<TransformComponent, ModelComponent>().each(
+				[&] (auto p_Entt, const TransformComponent& p_Transform, const ModelComponent& p_Model)
 				{
 					auto transform = p_Transform.Transform.GetLocalMatrix();
+					for (const auto& mesh : p_Model.ModelRef->GetMeshes())
+					{
+						if (culling && !IsMeshVisible(cameraFrustum, mesh, transform))
+						{
+							s_RenderData->Stats.CulledMeshes++;
+							continue;
+						}
+						s_RenderData->Stats.VisibleMeshes++;
+
+						auto [it, inserted] = materialIDs.try_emplace(mesh->GetMaterial().get(), (uint32_t)materialIDs.size());
+						float depth			= GetMeshDepth(s_RenderData->CameraBuffer.Position, mesh, transform);
+
+						queue.Push(RenderQueue::MakeKey(GetMeshPass(mesh), 0, it->second % RenderQueue::MAX_MATERIALS, depth), (uint32_t)draws.size());
+						draws.emplace_back(mesh, transform);
+					}
+				});
+
+				queue.Sort();
+
+				Material* boundMaterial = nullptr;
+				for (const auto& packet : queue.GetPackets())
+				{
+					auto& [mesh, transform] = draws[packet.Index];
+
 					shader->SetPushValue("Transform", &transform);
 
-					mesh->BindMaterial(commandBuffer, shader, pbr);
+					if (mesh->GetMaterial().get() != boundMaterial)
+					{
+						mesh->BindMaterial(commandBuffer, shader, pbr);
+						boundMaterial = mesh->GetMaterial().get();
+					}
 
 					shader->BindPushConstants(commandBuffer);
 					RendererCommand::DrawMesh(commandBuffer, mesh);
 					s_RenderData->Stats.DrawCalls++;
 				}
-			});
 
-			pipeline->End(commandBuffer);
+				pipeline->End(commandBuffer);
+			}
 		}
 
 		if (s_RenderData->Settings.Renderer2D)
@@ -1031,6 +1455,10 @@ namespace YUME
 					ImGui::EndTable();
 				}
 			}
+
+			ImGui::Checkbox("Frustum Culling", &s_RenderData->Settings.FrustumCulling);
+			ImGui::Checkbox("Instancing", &s_RenderData->Settings.Instancing);
+			ImGui::Checkbox("Parallel Recording", &s_RenderData->Settings.ParallelRecording);
 		}
 		ImGui::End();
 
@@ -1153,6 +1581,7 @@ namespace YUME
 			DescriptorSpec spec;
 			spec.Set = (uint32_t)i;
 			spec.Shader = Shader;
+			spec.Transient = true;
 			DescriptorSets[i] = DescriptorSet::Create(spec);
 		}
 
@@ -1179,7 +1608,7 @@ namespace YUME
 			VertexBuffer->SetData(VertexBufferBase.data(), VertexBufferBase.size() * sizeof(QuadVertex));
 
 			RendererCommand::BindDescriptorSets(commandBuffer, DescriptorSets.data(), (uint32_t)DescriptorSets.size());
-			RendererCommand::DrawIndexed(commandBuffer, VertexBuffer, IndexBuffer);
+			RendererCommand::DrawIndexed(commandBuffer, VertexBuffer, IndexBuffer, 1, IndexCount);
 			s_RenderData->Stats.DrawCalls++;
 
 			Pipeline->End(commandBuffer);
@@ -1276,6 +1705,7 @@ namespace YUME
 			DescriptorSpec spec;
 			spec.Set = (uint32_t)i;
 			spec.Shader = Shader;
+			spec.Transient = true;
 			DescriptorSets[i] = DescriptorSet::Create(spec);
 		}
 
@@ -1302,7 +1732,7 @@ namespace YUME
 			VertexBuffer->SetData(VertexBufferBase.data(), VertexBufferBase.size() * sizeof(CircleVertex));
 
 			RendererCommand::BindDescriptorSets(commandBuffer, DescriptorSets.data(), (uint32_t)DescriptorSets.size());
-			RendererCommand::DrawIndexed(commandBuffer, VertexBuffer, IndexBuffer);
+			RendererCommand::DrawIndexed(commandBuffer, VertexBuffer, IndexBuffer, 1, IndexCount);
 			s_RenderData->Stats.DrawCalls++;
 
 			Pipeline->End(commandBuffer);
@@ -1506,14 +1936,10 @@ namespace YUME
 	void ModelData::Init(const std::string& p_ShaderPath)
 	{
 		Shader = Shader::Create(p_ShaderPath);
-		Shader->SetLayout({
-			{ DataType::Float3, "a_Position" },
-			{ DataType::Float3, "a_Normal"   },
-			{ DataType::Float2, "a_TexCoord" },
-			{ DataType::Float4, "a_Color"	 },
-		});
+		Shader->SetLayout(Mesh::GetInputLayout());
 
-		DescriptorSet = DescriptorSet::Create({ /* Set */ 0, Shader });
+		DescriptorSet = DescriptorSet::Create({ /* Set */ 0, Shader, /* Transient */ true });
+		CameraBinding = DescriptorSet->GetDescriptorHandle("u_Camera");
 	}
 
 	void ModelData::Begin(bool p_CustomPCI, const PipelineCreateInfo& p_PCI)
@@ -1543,19 +1969,259 @@ namespace YUME
 		Pipeline = Pipeline::Get(pci);
 	}
 
-	void ForwardPBRData::Init(const std::string& p_ShaderPath)
+	// Dynamic buffers only hold the current frame, growing them doesn't need to keep the old contents
+	static void SetGrowingData(const Ref<StorageBuffer>& p_Buffer, void* p_Data, size_t p_SizeBytes)
 	{
-		Shader = Shader::Create(p_ShaderPath);
-		Shader->SetLayout({
-			{ DataType::Float3, "a_Position" },
-			{ DataType::Float3, "a_Normal"   },
-			{ DataType::Float2, "a_TexCoord" },
-			{ DataType::Float4, "a_Color"	 },
+		if (p_SizeBytes > p_Buffer->GetSize())
+			p_Buffer->Resize(std::max(p_SizeBytes, p_Buffer->GetSize() * 2));
+
+		p_Buffer->SetData(p_Data, p_SizeBytes);
+	}
+
+	void InstanceBatcher::Init(bool p_Indirect)
+	{
+		Buffer = StorageBuffer::Create(INITIAL_CAPACITY * sizeof(glm::mat4), /* Dynamic */ true);
+
+		if (p_Indirect)
+		{
+			IndirectBuffer = StorageBuffer::Create(INITIAL_DRAW_CAPACITY * sizeof(DrawIndexedIndirectCommand), /* Dynamic */ true);
+			DrawBuffer	   = StorageBuffer::Create(INITIAL_DRAW_CAPACITY * sizeof(DrawData), /* Dynamic */ true);
+		}
+	}
+
+	void InstanceBatcher::Clear()
+	{
+		Batches.clear();
+		BatchIndices.clear();
+		Instances.clear();
+		StateIDs.clear();
+	}
+
+	void InstanceBatcher::Add(const Ref<Mesh>& p_Mesh, const glm::mat4& p_Transform, bool p_Merge, float p_Depth)
+	{
+		uint32_t index = (uint32_t)Batches.size();
+		if (p_Merge)
+		{
+			auto [it, inserted] = BatchIndices.try_emplace(p_Mesh.get(), index);
+			index = it->second;
+		}
+
+		if (index == (uint32_t)Batches.size())
+			Batches.push_back({ p_Mesh, 0, 0 });
+
+		Batches[index].Count++;
+		Batches[index].Depth = std::min(Batches[index].Depth, p_Depth);
+		Instances.emplace_back(index, p_Transform);
+	}
+
+	uint32_t InstanceBatcher::GetStateID(const void* p_State)
+	{
+		auto [it, inserted] = StateIDs.try_emplace(p_State, (uint32_t)StateIDs.size());
+		return it->second;
+	}
+
+	void InstanceBatcher::Sort(const std::function<uint64_t(const Batch& p_Batch)>& p_MakeKey)
+	{
+		YM_PROFILE_FUNCTION()
+
+		Queue.Clear();
+		for (uint32_t i = 0; i < (uint32_t)Batches.size(); i++)
+		{
+			Batches[i].Key = p_MakeKey(Batches[i]);
+			Queue.Push(Batches[i].Key, i);
+		}
+
+		Queue.Sort();
+
+		SortedBatches.clear();
+		Remap.resize(Batches.size());
+		for (const auto& packet : Queue.GetPackets())
+		{
+			Remap[packet.Index] = (uint32_t)SortedBatches.size();
+			SortedBatches.push_back(std::move(Batches[packet.Index]));
+		}
+		Batches.swap(SortedBatches);
+
+		for (auto& instance : Instances)
+			instance.first = Remap[instance.first];
+	}
+
+	void InstanceBatcher::Upload()
+	{
+		YM_PROFILE_FUNCTION()
+
+		// Counting sort, the instances of a batch end up next to each other
+		uint32_t first = 0;
+		for (auto& batch : Batches)
+		{
+			batch.First = first;
+			first		+= batch.Count;
+			batch.Count = 0;
+		}
+
+		Transforms.resize(Instances.size());
+		for (const auto& [index, transform] : Instances)
+		{
+			auto& batch = Batches[index];
+			Transforms[batch.First + batch.Count++] = transform;
+		}
+
+		if (Transforms.empty())
+			return;
+
+		SetGrowingData(Buffer, Transforms.data(), Transforms.size() * sizeof(glm::mat4));
+	}
+
+	void InstanceBatcher::UploadIndirect(uint32_t p_MaxDrawCount)
+	{
+		YM_PROFILE_FUNCTION()
+
+		YM_CORE_ASSERT(IndirectBuffer && DrawBuffer, "Batcher wasn't created for indirect draws")
+
+		Commands.clear();
+		Draws.clear();
+		Ranges.clear();
+
+		// Batches keep their transform ranges, only the draw order changes.
+		// Stable so the key order holds inside a page. Transparent batches keep the back to front
+		// order of their keys, a page change there only starts a new range.
+		std::stable_sort(Batches.begin(), Batches.end(), [](const Batch& p_A, const Batch& p_B)
+		{
+			auto passA = RenderQueue::GetPass(p_A.Key);
+			auto passB = RenderQueue::GetPass(p_B.Key);
+			if (passA != passB)
+				return passA < passB;
+
+			if (passA == RenderQueuePass::Transparent)
+				return false;
+
+			return p_A.MeshRef->GetGeometryPage()->ID < p_B.MeshRef->GetGeometryPage()->ID;
 		});
 
-		DescriptorSet = DescriptorSet::Create({ /* Set */ 0, Shader });
+		p_MaxDrawCount = std::max(p_MaxDrawCount, 1u);
+		for (const auto& batch : Batches)
+		{
+			const auto& mesh = batch.MeshRef;
+			const auto& page = mesh->GetGeometryPage();
+
+			if (Ranges.empty() || Ranges.back().Page != page || Ranges.back().Count >= p_MaxDrawCount)
+				Ranges.push_back({ page, (uint32_t)Commands.size(), 0 });
+			Ranges.back().Count++;
+
+			Commands.push_back({ mesh->GetIndexCount(), batch.Count, mesh->GetFirstIndex(), mesh->GetVertexOffset(), 0 });
+			Draws.push_back({ batch.First, batch.MaterialIndex });
+		}
+
+		if (Commands.empty())
+			return;
+
+		SetGrowingData(IndirectBuffer, Commands.data(), Commands.size() * sizeof(DrawIndexedIndirectCommand));
+		SetGrowingData(DrawBuffer, Draws.data(), Draws.size() * sizeof(DrawData));
+	}
+
+	void ForwardPBRData::Init(const std::string& p_ShaderPath, const std::string& p_BindlessShaderPath, const std::string& p_IndirectShaderPath)
+	{
+		const auto& caps = RendererCommand::GetCapabilities();
+
+		Bindless = s_RenderData->Settings.Bindless && caps.SupportBindless;
+		Indirect = Bindless && s_RenderData->Settings.MultiDrawIndirect && caps.SupportMultiDrawIndirect;
+
+		Shader = Shader::Create(Indirect ? p_IndirectShaderPath : Bindless ? p_BindlessShaderPath : p_ShaderPath);
+		Shader->SetLayout(Mesh::GetInputLayout());
+
+		DescriptorSet = DescriptorSet::Create({ /* Set */ 0, Shader, /* Transient */ true });
+
+		Bindings.Camera		  = DescriptorSet->GetDescriptorHandle("u_Camera");
+		Bindings.Lights		  = DescriptorSet->GetDescriptorHandle("LightBuffer");
+		Bindings.ShadowBuffer = DescriptorSet->GetDescriptorHandle("u_ShadowBuffer");
+		Bindings.ShadowMap	  = DescriptorSet->GetDescriptorHandle("u_ShadowMap");
+		Bindings.Instances	  = DescriptorSet->GetDescriptorHandle("u_Instances");
+		Bindings.Draws		  = DescriptorSet->GetDescriptorHandle("u_Draws");		// Indirect only
+		Bindings.Materials	  = DescriptorSet->GetDescriptorHandle("u_Materials");	// Bindless only
 
 		LightUBO = UniformBuffer::Create(sizeof(LightBufferData));
+
+		Instances.Init(Indirect);
+
+		if (Bindless)
+		{
+			TextureSet	   = DescriptorSet::Create({ /* Set */ 1, Shader });
+			MaxTextures	   = caps.MaxBindlessTextures;
+			MaterialBuffer = StorageBuffer::Create(64 * sizeof(GPUMaterial), /* Dynamic */ true);
+		}
+	}
+
+	uint32_t ForwardPBRData::GetTextureIndex(const Ref<Texture2D>& p_Texture)
+	{
+		auto [it, inserted] = TextureIndices.try_emplace(p_Texture.get(), (uint32_t)Textures.size());
+		if (!inserted)
+			return it->second;
+
+		if (Textures.size() >= MaxTextures)
+		{
+			// Out of slots, the first registered texture stands in
+			YM_CORE_WARN("Bindless texture array is full ({} textures)!", MaxTextures)
+			it->second = 0;
+			return 0;
+		}
+
+		Textures.push_back(p_Texture);
+		TextureSet->SetTextureAt("u_Textures", it->second, p_Texture);
+		TexturesDirty = true;
+
+		return it->second;
+	}
+
+	uint32_t ForwardPBRData::GetMaterialIndex(const Ref<Material>& p_Material)
+	{
+		auto [it, inserted] = MaterialIndices.try_emplace(p_Material.get(), (uint32_t)MaterialTable.size());
+		if (!inserted)
+			return it->second;
+
+		// Same as the set path, the properties are captured the first time the material is drawn
+		const auto& properties = p_Material->GetProperties();
+		auto textures		   = p_Material->GetTexturesOrDefault();
+
+		GPUMaterial material{};
+		material.AlbedoColor	  = properties.AlbedoColor;
+		material.AlbedoTexture	  = GetTextureIndex(textures.AlbedoMap);
+		material.NormalTexture	  = GetTextureIndex(textures.NormalMap);
+		material.SpecularTexture  = GetTextureIndex(textures.SpecularMap);
+		material.RoughnessTexture = GetTextureIndex(textures.RoughnessMap);
+		material.MetallicTexture  = GetTextureIndex(textures.MetallicMap);
+		material.AoTexture		  = GetTextureIndex(textures.AoMap);
+		material.SpecularMap	  = properties.SpecularMap ? 1 : 0;
+		material.NormalMap		  = properties.NormalMap ? 1 : 0;
+		material.AlphaCutOff	  = properties.AlphaCutOff;
+
+		Materials.push_back(p_Material);
+		MaterialTable.push_back(material);
+
+		return it->second;
+	}
+
+	void ForwardPBRData::UploadMaterials(CommandBuffer* p_CommandBuffer)
+	{
+		YM_PROFILE_FUNCTION()
+
+		// New slots only, the rest of the array may be in use by frames still in flight
+		if (TexturesDirty)
+		{
+			TextureSet->Upload(p_CommandBuffer);
+			TexturesDirty = false;
+		}
+
+		if (!MaterialTable.empty())
+		{
+			size_t size = MaterialTable.size() * sizeof(GPUMaterial);
+			if (size > MaterialBuffer->GetSize())
+				MaterialBuffer->Resize(std::max(size, MaterialBuffer->GetSize() * 2));
+
+			MaterialBuffer->SetData(MaterialTable.data(), size);
+		}
+
+		DescriptorSet->SetStorageData(Bindings.Materials, MaterialBuffer);
+		DescriptorSet->Upload(p_CommandBuffer);
 	}
 
 	void ForwardPBRData::Begin(bool p_CustomPCI, const PipelineCreateInfo& p_PCI)
@@ -1597,19 +2263,22 @@ namespace YUME
 	void ShadowData::Init()
 	{
 		DebugShader			= Shader::Create("assets/shaders/shadow_debug_shader.glsl");
-		DebugDescriptorSet  = DescriptorSet::Create({ /* Set */ 0, DebugShader });
+		DebugDescriptorSet  = DescriptorSet::Create({ /* Set */ 0, DebugShader, /* Transient */ true });
 		DebugUBO			= UniformBuffer::Create(sizeof(DebugUBOData));
 
-		Shader				= Shader::Create("assets/shaders/shadow_shader.glsl");
-		Shader->SetLayout({
-			{ DataType::Float3, "a_Position" },
-			{ DataType::Float3, "a_Normal"   },
-			{ DataType::Float2, "a_TexCoord" },
-			{ DataType::Float4, "a_Color"	 },
-		});
+		Indirect			= s_RenderData->Settings.MultiDrawIndirect && RendererCommand::GetCapabilities().SupportMultiDrawIndirect;
+
+		Shader				= Shader::Create(Indirect ? "assets/shaders/shadow_indirect_shader.glsl" : "assets/shaders/shadow_shader.glsl");
+		Shader->SetLayout(Mesh::GetInputLayout());
 
-		DescriptorSet		= DescriptorSet::Create({ /* Set */ 0, Shader });
+		DescriptorSet		= DescriptorSet::Create({ /* Set */ 0, Shader, /* Transient */ true });
 		LightSpaceUBO		= UniformBuffer::Create(sizeof(UBOData));
+
+		Bindings.LightBuffer = DescriptorSet->GetDescriptorHandle("u_LightBuffer");
+		Bindings.Instances	 = DescriptorSet->GetDescriptorHandle("u_Instances");
+		Bindings.Draws		 = DescriptorSet->GetDescriptorHandle("u_Draws");
+
+		Instances.Init(Indirect);
 	}
 
 	void ShadowData::Begin()
@@ -1688,7 +2357,7 @@ namespace YUME
 	{
 		Shader		  = Shader::Create("assets/shaders/skybox_shader.glsl");
 
-		DescriptorSet = DescriptorSet::Create({ /* Set */ 0, Shader });
+		DescriptorSet = DescriptorSet::Create({ /* Set */ 0, Shader, /* Transient */ true });
 
 		SkyboxUBO	  = UniformBuffer::Create(sizeof(BufferData));
 
@@ -30,6 +30,11 @@ namespace YUME
 		bool Renderer2D			= false;
 		bool Renderer2D_Quad	= true;
 		bool Renderer2D_Circle  = true;
+		bool FrustumCulling		= true;
+		bool Instancing			= true;
+		bool Bindless			= true; // Read when the PBR pass is created, needs device support
+		bool ParallelRecording	= true; // Shadow and PBR draws recorded into secondaries on the job system
+		bool MultiDrawIndirect	= true; // Read when the passes are created, the PBR pass also needs Bindless
 	};
 
 	struct YM_API RendererBeginInfo
@@ -71,7 +76,17 @@ namespace YUME
 				double RenderSceneTimeMs = 0.0;
 				double EndTimeMs = 0.0;
 
+				double FrameTimeMs = 0.0;
+				double FrameWaitTimeMs = 0.0;
+				uint32_t FramesInFlight = 1;
+				uint32_t FrameIndex = 0;
+
 				uint32_t DrawCalls = 0;
+
+				uint32_t VisibleMeshes = 0;
+				uint32_t CulledMeshes = 0;
+				uint32_t ShadowVisibleMeshes = 0;
+				uint32_t ShadowCulledMeshes = 0;
 			};
 			static Statistics GetStats();
 
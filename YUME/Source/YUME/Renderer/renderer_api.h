@@ -3,6 +3,7 @@
 #include "YUME/Core/base.h"
 #include "YUME/Core/reference.h"
 #include "YUME/Renderer/buffer.h"
+#include "YUME/Renderer/storage_buffer.h"
 
 #include "YUME/Renderer/graphics_context.h"
 #include "YUME/Renderer/texture.h"
@@ -20,6 +21,20 @@ namespace YUME
 		bool SamplerAnisotropy;
 		bool WideLines;
 		bool FillModeNonSolid;
+		bool SupportBindless;
+		uint32_t MaxBindlessTextures;
+		bool SupportMultiDrawIndirect;
+		uint32_t MaxDrawIndirectCount;
+	};
+
+	// Same layout as VkDrawIndexedIndirectCommand
+	struct DrawIndexedIndirectCommand
+	{
+		uint32_t IndexCount;
+		uint32_t InstanceCount;
+		uint32_t FirstIndex;
+		int32_t  VertexOffset;
+		uint32_t FirstInstance;
 	};
 
 	class YM_API RendererAPI
@@ -36,9 +51,13 @@ namespace YUME
 			virtual void ClearRenderTarget(const Ref<Texture2D>& p_Texture, const glm::vec4& p_Value) = 0;
 
 			virtual void Draw(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, uint32_t p_VertexCount, uint32_t p_InstanceCount = 1) = 0;
-			virtual void DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount = 1) = 0;
+			virtual void DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount = 1, uint32_t p_IndexCount = 0, uint32_t p_FirstIndex = 0, int32_t p_VertexOffset = 0) = 0;
+			// p_Commands holds DrawIndexedIndirectCommand entries, [p_FirstDraw, p_FirstDraw + p_DrawCount) are drawn in one call
+			virtual void DrawIndexedIndirect(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, const Ref<StorageBuffer>& p_Commands, uint32_t p_FirstDraw, uint32_t p_DrawCount) = 0;
 
 			virtual const Capabilities& GetCapabilities() const = 0;
+			// Whether a sampled texture of this format can be uploaded and filtered on this device
+			virtual bool SupportsTextureFormat(TextureFormat p_Format) const = 0;
 
 			virtual void SaveScreenshot(const std::string& p_OutPath, const Ref<Texture>& p_Texture, bool p_Async = true) {};
 
@@ -58,18 +58,25 @@ namespace YUME
 
 		s_RendererAPI->Draw(p_CommandBuffer, p_VertexBuffer, p_VertexCount, p_InstanceCount);
 	}
-	void RendererCommand::DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount)
+	void RendererCommand::DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount, uint32_t p_IndexCount, uint32_t p_FirstIndex, int32_t p_VertexOffset)
 	{
 		YM_PROFILE_FUNCTION()
 
-		s_RendererAPI->DrawIndexed(p_CommandBuffer, p_VertexBuffer, p_IndexBuffer, p_InstanceCount);
+		s_RendererAPI->DrawIndexed(p_CommandBuffer, p_VertexBuffer, p_IndexBuffer, p_InstanceCount, p_IndexCount, p_FirstIndex, p_VertexOffset);
 	}
 
-	void RendererCommand::DrawMesh(CommandBuffer* p_CommandBuffer, const Ref<Mesh>& p_Mesh)
+	void RendererCommand::DrawIndexedIndirect(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, const Ref<StorageBuffer>& p_Commands, uint32_t p_FirstDraw, uint32_t p_DrawCount)
 	{
 		YM_PROFILE_FUNCTION()
 
-		DrawIndexed(p_CommandBuffer, p_Mesh->GetVertexBuffer(), p_Mesh->GetIndexBuffer());
+		s_RendererAPI->DrawIndexedIndirect(p_CommandBuffer, p_VertexBuffer, p_IndexBuffer, p_Commands, p_FirstDraw, p_DrawCount);
+	}
+
+	void RendererCommand::DrawMesh(CommandBuffer* p_CommandBuffer, const Ref<Mesh>& p_Mesh, uint32_t p_InstanceCount)
+	{
+		YM_PROFILE_FUNCTION()
+
+		DrawIndexed(p_CommandBuffer, p_Mesh->GetVertexBuffer(), p_Mesh->GetIndexBuffer(), p_InstanceCount, p_Mesh->GetIndexCount(), p_Mesh->GetFirstIndex(), p_Mesh->GetVertexOffset());
 	}
 
 	void RendererCommand::SaveScreenshot(const std::string& p_OutPath, const Ref<Texture>& p_Texture, bool p_Async)
@@ -86,6 +93,13 @@ namespace YUME
 		return s_RendererAPI->GetCapabilities();
 	}
 
+	bool RendererCommand::SupportsTextureFormat(TextureFormat p_Format)
+	{
+		YM_PROFILE_FUNCTION()
+
+		return s_RendererAPI->SupportsTextureFormat(p_Format);
+	}
+
 	void RendererCommand::BindDescriptorSets(CommandBuffer* p_CommandBuffer, const Ref<DescriptorSet>* p_DescriptorSets, uint32_t p_Count)
 	{
 		YM_PROFILE_FUNCTION()
@@ -28,12 +28,14 @@ namespace YUME
 			static void ClearRenderTarget(const Ref<Texture2D> p_Texture, const glm::vec4& p_Value = { 0.0f, 0.0f, 0.0f, 1.0f });
 
 			static void Draw(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, uint32_t p_VertexCount, uint32_t p_InstanceCount = 1);
-			static void DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount = 1);
-			static void DrawMesh(CommandBuffer* p_CommandBuffer, const Ref<Mesh>& p_Mesh);
+			static void DrawIndexed(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, uint32_t p_InstanceCount = 1, uint32_t p_IndexCount = 0, uint32_t p_FirstIndex = 0, int32_t p_VertexOffset = 0);
+			static void DrawIndexedIndirect(CommandBuffer* p_CommandBuffer, const Ref<VertexBuffer>& p_VertexBuffer, const Ref<IndexBuffer>& p_IndexBuffer, const Ref<StorageBuffer>& p_Commands, uint32_t p_FirstDraw, uint32_t p_DrawCount);
+			static void DrawMesh(CommandBuffer* p_CommandBuffer, const Ref<Mesh>& p_Mesh, uint32_t p_InstanceCount = 1);
 
 			static void SaveScreenshot(const std::string& p_OutPath, const Ref<Texture>& p_Texture, bool p_Async = true);
 
 			static const Capabilities& GetCapabilities();
+			static bool SupportsTextureFormat(TextureFormat p_Format);
 
 			static void BindDescriptorSets(CommandBuffer* p_CommandBuffer, const Ref<DescriptorSet>* p_DescriptorSets, uint32_t p_Count = 1);
 
@@ -2,6 +2,7 @@
 #include "shader.h"
 
 #include "YUME/Core/engine.h"
+#include "shader_reloader.h"
 
 #include "Platform/Vulkan/Renderer/vulkan_shader.h"
 
@@ -13,9 +14,27 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION()
 
+		Ref<Shader> shader = nullptr;
 		switch (Engine::GetAPI())
 		{
-			case RenderAPI::Vulkan: return CreateRef<VulkanShader>(p_ShaderPath);
+			case RenderAPI::Vulkan: shader = CreateRef<VulkanShader>(p_ShaderPath); break;
+
+			default:
+				YM_CORE_ERROR("Unknown render API!")
+				return nullptr;
+		}
+
+		ShaderReloader::Register(shader);
+		return shader;
+	}
+
+	Ref<Shader> Shader::TryCreate(const std::string& p_ShaderPath)
+	{
+		YM_PROFILE_FUNCTION()
+
+		switch (Engine::GetAPI())
+		{
+			case RenderAPI::Vulkan: return VulkanShader::TryCreate(p_ShaderPath);
 		}
 
 		YM_CORE_ERROR("Unknown render API!")
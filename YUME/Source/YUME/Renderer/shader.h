@@ -41,6 +41,10 @@ namespace YUME
 			case YUME::DataType::Int4:		return 4 * 4;
 
 			case YUME::DataType::Bool:		return 1;
+
+			case YUME::DataType::Half2:		return 2 * 2;
+			case YUME::DataType::Short2:	return 2 * 2;
+			case YUME::DataType::UByte4:	return 1 * 4;
 		}
 
 		YM_CORE_ASSERT(false)
@@ -83,6 +87,10 @@ namespace YUME
 				case YUME::DataType::Int4:		return 4;
 
 				case YUME::DataType::Bool:		return 1;
+
+				case YUME::DataType::Half2:		return 2;
+				case YUME::DataType::Short2:	return 2;
+				case YUME::DataType::UByte4:	return 4;
 			}
 
 			YM_CORE_ASSERT(false, "Unknown DataType!")
@@ -134,12 +142,23 @@ namespace YUME
 			virtual void Unbind() = 0;
 		
 			virtual const std::string_view& GetName() const = 0;
+			virtual const std::string& GetFilePath() const = 0;
+			// Files pulled in with #include, editing them changes the shader too
+			virtual const std::vector<std::string>& GetIncludes() const = 0;
+
+			// Takes the compiled code of p_Shader, which is left with the old code. Fails when the
+			// descriptor sets or push constants differ. Only between frames.
+			virtual bool Replace(Shader& p_Shader) = 0;
 
 			virtual void SetLayout(const InputLayout& p_Layout) = 0;
 
 			virtual void SetPushValue(const std::string& p_Name, void* p_Value) = 0;
 			virtual void BindPushConstants(CommandBuffer* p_CommandBuffer) const = 0;
+			// Pushes p_Data from the start of the block instead of the SetPushValue values, safe to call from several threads
+			virtual void BindPushConstants(CommandBuffer* p_CommandBuffer, const void* p_Data, uint32_t p_Size) const = 0;
 
 			static Ref<Shader> Create(const std::string& p_ShaderPath);
+			// Returns nullptr instead of asserting when the source doesn't compile, safe to call from another thread
+			static Ref<Shader> TryCreate(const std::string& p_ShaderPath);
 	};
 }
\ No newline at end of file
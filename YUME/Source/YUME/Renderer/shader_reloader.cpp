@@ -0,0 +1,181 @@
+#include "YUME/yumepch.h"
+#include "shader_reloader.h"
+#include "pipeline.h"
+#include "YUME/Utils/file_watcher.h"
+
+// std
+#include <mutex>
+#include <unordered_set>
+
+
+
+
+namespace YUME
+{
+	struct WatchedShader
+	{
+		WeakRef<Shader> Shader;
+		std::string Path;				// As given to Shader::Create, the cache entries are keyed by it
+		std::vector<std::string> Files; // The shader and its includes, absolute
+	};
+
+	struct PendingShader
+	{
+		WeakRef<Shader> Shader;
+		Ref<YUME::Shader> Compiled;
+	};
+
+	struct ShaderReloaderData
+	{
+		std::mutex Mutex;
+		bool Enabled = false;
+
+		std::vector<WatchedShader> Shaders;
+		// Compiled on the watcher thread, swapped in by Update
+		std::vector<PendingShader> Pending;
+
+		Utils::FileWatcher Watcher;
+	};
+	static ShaderReloaderData s_Data;
+
+
+	static std::string NormalizePath(const std::filesystem::path& p_Path)
+	{
+		std::error_code error;
+		return std::filesystem::absolute(p_Path, error).lexically_normal().generic_string();
+	}
+
+	static std::vector<std::string> GetWatchedFiles(const Shader& p_Shader)
+	{
+		std::vector<std::string> files = { NormalizePath(p_Shader.GetFilePath()) };
+		for (const auto& include : p_Shader.GetIncludes())
+			files.push_back(NormalizePath(include));
+
+		return files;
+	}
+
+
+	void ShaderReloader::Init(const std::string& p_Directory)
+	{
+		YM_PROFILE_FUNCTION()
+
+		{
+			std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+			s_Data.Enabled = true;
+		}
+
+		if (!s_Data.Watcher.Start(p_Directory, &ShaderReloader::OnFilesChanged))
+		{
+			YM_CORE_WARN("Shader reload - Could not watch '{}', shaders won't be reloaded", p_Directory)
+			std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+			s_Data.Enabled = false;
+			return;
+		}
+
+		YM_CORE_INFO("Shader reload - Watching '{}'", p_Directory)
+	}
+
+	void ShaderReloader::Shutdown()
+	{
+		YM_PROFILE_FUNCTION()
+
+		s_Data.Watcher.Stop();
+
+		std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+		s_Data.Enabled = false;
+		s_Data.Shaders.clear();
+		s_Data.Pending.clear();
+	}
+
+	void ShaderReloader::Register(const Ref<Shader>& p_Shader)
+	{
+		if (!p_Shader)
+			return;
+
+		std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+		if (!s_Data.Enabled)
+			return;
+
+		std::erase_if(s_Data.Shaders, [](const WatchedShader& p_Watched) { return p_Watched.Shader.expired(); });
+		s_Data.Shaders.push_back({ p_Shader, p_Shader->GetFilePath(), GetWatchedFiles(*p_Shader) });
+	}
+
+	void ShaderReloader::Update()
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::vector<PendingShader> pending;
+		{
+			std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+			if (s_Data.Pending.empty())
+				return;
+
+			pending.swap(s_Data.Pending);
+		}
+
+		for (auto& reload : pending)
+		{
+			auto shader = reload.Shader.lock();
+			if (!shader)
+				continue;
+
+			// On failure the shader keeps its code, the reason is logged by Replace
+			if (!shader->Replace(*reload.Compiled))
+				continue;
+
+			Pipeline::Invalidate(shader.get());
+
+			// An edit may have added or removed includes
+			auto files = GetWatchedFiles(*shader);
+			{
+				std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+				for (auto& watched : s_Data.Shaders)
+				{
+					if (watched.Shader.lock() == shader)
+						watched.Files = files;
+				}
+			}
+
+			YM_CORE_INFO("Shader reload - '{}' reloaded", shader->GetFilePath())
+		}
+
+		// The replaced code is destroyed here with the compiled shaders, the frame deletion queue keeps it alive while in use
+	}
+
+	void ShaderReloader::OnFilesChanged(const std::vector<std::filesystem::path>& p_Files)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::unordered_set<std::string> changed;
+		for (const auto& file : p_Files)
+			changed.insert(NormalizePath(file));
+
+		std::vector<WatchedShader> dirty;
+		{
+			std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+			for (const auto& watched : s_Data.Shaders)
+			{
+				bool isDirty = std::any_of(watched.Files.begin(), watched.Files.end(), [&](const std::string& p_File) { return changed.contains(p_File); });
+				if (isDirty && !watched.Shader.expired())
+					dirty.push_back(watched);
+			}
+		}
+
+		for (const auto& watched : dirty)
+		{
+			YM_CORE_INFO("Shader reload - Compiling '{}'", watched.Path)
+
+			// Each shader object gets its own copy, Replace hands the old code back to it
+			Ref<Shader> compiled = Shader::TryCreate(watched.Path);
+			if (!compiled)
+			{
+				YM_CORE_ERROR("Shader reload - '{}' failed to compile, keeping the running version", watched.Path)
+				continue;
+			}
+
+			std::scoped_lock<std::mutex> lock(s_Data.Mutex);
+			if (s_Data.Enabled)
+				s_Data.Pending.push_back({ watched.Shader, compiled });
+		}
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "YUME/Core/base.h"
+#include "YUME/Core/reference.h"
+#include "shader.h"
+
+// std
+#include <string>
+
+
+
+namespace YUME
+{
+	// Recompiles the shaders whose file, or a file they include, changed on disk. Compiling happens on
+	// the file watcher's thread, the new code is swapped in by Update and the pipelines built from the
+	// old one are dropped from the cache. A shader that fails to compile keeps running the old code.
+	class YM_API ShaderReloader
+	{
+		public:
+			static void Init(const std::string& p_Directory);
+			static void Shutdown();
+
+			// Between frames, nothing may be recording with the shaders
+			static void Update();
+
+			// Called by Shader::Create, a no-op until Init
+			static void Register(const Ref<Shader>& p_Shader);
+
+		private:
+			static void OnFilesChanged(const std::vector<std::filesystem::path>& p_Files);
+	};
+}
@@ -18,4 +18,15 @@ namespace YUME
 		}
 	}
 
+	Ref<StorageBuffer> StorageBuffer::Create(size_t p_SizeBytes, bool p_Dynamic)
+	{
+		if (Engine::GetAPI() == RenderAPI::Vulkan)
+			return CreateRef<VulkanStorageBuffer>(p_SizeBytes, p_Dynamic);
+		else
+		{
+			YM_CORE_ERROR("Unknown render api!")
+				return nullptr;
+		}
+	}
+
 }
\ No newline at end of file
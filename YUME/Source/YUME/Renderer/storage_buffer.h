@@ -19,6 +19,10 @@ namespace YUME
 			virtual size_t GetOffset() const = 0;
 			virtual size_t GetSize() const = 0;
 
-			static Ref<StorageBuffer> Create(size_t p_SizeBytes);
+			// Both usages can also be the source of indirect draw commands
+			static Ref<StorageBuffer> Create(size_t p_SizeBytes); // STATIC usage
+			// DYNAMIC usage, rewritten every frame from the frame ring buffer.
+			// The contents only live for the frame they were written in.
+			static Ref<StorageBuffer> Create(size_t p_SizeBytes, bool p_Dynamic);
 	};
 }
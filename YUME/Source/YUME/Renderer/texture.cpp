@@ -27,7 +27,7 @@ namespace YUME
 
 		HashCombine(p_Hash, p_Spec.Format, p_Spec.WrapU, p_Spec.WrapV, p_Spec.WrapW, p_Spec.MinFilter, p_Spec.MagFilter);
 
-		HashCombine(p_Hash, p_Spec.Height, p_Spec.Width, p_Spec.AnisotropyEnable, p_Spec.GenerateMips);
+		HashCombine(p_Hash, p_Spec.Height, p_Spec.Width, p_Spec.AnisotropyEnable, p_Spec.GenerateMips, p_Spec.MipLevels);
 
 		HashCombine(p_Hash, p_Spec.DebugName);
 	}
@@ -29,6 +29,9 @@ namespace YUME
 
 		bool AnisotropyEnable				= true;
 		bool GenerateMips					= true;
+		// When > 0 the data given on creation already holds the whole mip chain, level 0 first,
+		// each level with every layer. GenerateMips is ignored then.
+		uint32_t MipLevels					= 0;
 
 		std::string DebugName				= "Texture";
 	};
@@ -70,6 +73,38 @@ namespace YUME
 					p_Format == TextureFormat::D32_FLOAT_S8_UINT;
 			}
 
+			static bool IsCompressedFormat(TextureFormat p_Format)
+			{
+				return GetCompressedBlockSize(p_Format) > 0;
+			}
+
+			// Bytes per 4x4 block, 0 for uncompressed formats
+			static uint32_t GetCompressedBlockSize(TextureFormat p_Format)
+			{
+				switch (p_Format)
+				{
+					case TextureFormat::BC1_SRGB:
+					case TextureFormat::BC1_UNORM:
+					case TextureFormat::BC4_UNORM:
+						return 8;
+
+					case TextureFormat::BC3_SRGB:
+					case TextureFormat::BC3_UNORM:
+					case TextureFormat::BC5_UNORM:
+					case TextureFormat::BC7_SRGB:
+					case TextureFormat::BC7_UNORM:
+						return 16;
+
+					default:
+						return 0;
+				}
+			}
+
+			static uint64_t GetCompressedSize(TextureFormat p_Format, uint32_t p_Width, uint32_t p_Height)
+			{
+				return uint64_t((p_Width + 3) / 4) * uint64_t((p_Height + 3) / 4) * GetCompressedBlockSize(p_Format);
+			}
+
 			bool IsSampled() const { return GetSpecification().Usage == TextureUsage::TEXTURE_SAMPLED; }
 			bool IsColorAttachment() const { return GetSpecification().Usage == TextureUsage::TEXTURE_COLOR_ATTACHMENT; }
 			bool IsDepthStencilAttachment() const { return GetSpecification().Usage == TextureUsage::TEXTURE_DEPTH_STENCIL_ATTACHMENT; }
@@ -1,11 +1,42 @@
 #include "YUME/yumepch.h"
 #include "texture_importer.h"
+#include "renderer_command.h"
 #include "YUME/Utils/utils.h"
+#include "YUME/Utils/image_container.h"
 
 
 
 namespace YUME
 {
+	// Falls back to a CPU decode when the device can't sample the stored format
+	static bool LoadImageContainer(const std::string& p_Path, Utils::ImageContainer& p_Image)
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (!Utils::LoadImageContainer(p_Path.c_str(), p_Image))
+			return false;
+
+		if (!RendererCommand::SupportsTextureFormat(p_Image.Format))
+		{
+			YM_CORE_WARN("The format of '{}' isn't supported by the device, decoding it on the CPU...", p_Path)
+
+			Utils::ImageContainer decoded;
+			Utils::DecompressImageContainer(p_Image, decoded);
+			p_Image = std::move(decoded);
+		}
+
+		return true;
+	}
+
+	static void ApplyImageContainer(const Utils::ImageContainer& p_Image, TextureSpecification& p_Spec)
+	{
+		p_Spec.Width	 = p_Image.Width;
+		p_Spec.Height	 = p_Image.Height;
+		p_Spec.Format	 = p_Image.Format;
+		p_Spec.Usage	 = TextureUsage::TEXTURE_SAMPLED;
+		// A single uncompressed level still gets its mips generated like any other image
+		p_Spec.MipLevels = p_Image.MipLevels > 1 || Texture::IsCompressedFormat(p_Image.Format) ? p_Image.MipLevels : 0;
+	}
 
 	Ref<Texture2D> TextureImporter::LoadTexture2D(const std::string& p_Path)
 	{
@@ -28,6 +59,24 @@ namespace YUME
 	{
 		YM_PROFILE_FUNCTION()
 
+		if (Utils::IsImageContainerFile(p_Path))
+		{
+			Utils::ImageContainer image;
+			if (!LoadImageContainer(p_Path, image))
+				return nullptr;
+
+			if (image.LayerCount > 1)
+			{
+				YM_CORE_ERROR("'{}' holds {} layers, cube maps are loaded with LoadTextureCube!", p_Path, image.LayerCount)
+				return nullptr;
+			}
+
+			TextureSpecification spec = p_Spec;
+			ApplyImageContainer(image, spec);
+
+			return Texture2D::Create(spec, image.Data.data(), image.Data.size());
+		}
+
 		uint32_t width, height, channels = 4, bytes = 1;
 		bool isHDR					= false;
 		std::string path			= p_Path;
@@ -44,11 +93,11 @@ namespace YUME
 		if (!texture)
 		{
 			YM_CORE_ERROR("Failed to create texture!")
-			free(data);
+			Utils::FreeImage(data);
 			return nullptr;
 		}
 
-		free(data);
+		Utils::FreeImage(data);
 		return texture;
 	}
 
@@ -73,6 +122,47 @@ namespace YUME
 
 	static const uint8_t s_CUBEMAP_SIZE = 6;
 
+	Ref<TextureArray> TextureImporter::LoadTextureCube(const std::string& p_Path)
+	{
+		YM_PROFILE_FUNCTION()
+
+		TextureSpecification spec	= {};
+		spec.BorderColorFlag		= TextureBorderColor::OPAQUE_BLACK_SRGB;
+		spec.WrapU					= TextureWrap::CLAMP_TO_EDGE;
+		spec.WrapV					= TextureWrap::CLAMP_TO_EDGE;
+		spec.WrapW					= TextureWrap::CLAMP_TO_EDGE;
+		spec.MinFilter				= TextureFilter::LINEAR;
+		spec.MagFilter				= TextureFilter::LINEAR;
+		spec.AnisotropyEnable		= true;
+		spec.GenerateMips			= true;
+		spec.DebugName				= std::filesystem::path(p_Path).stem().string();
+
+		return LoadTextureCube(p_Path, spec);
+	}
+
+	Ref<TextureArray> TextureImporter::LoadTextureCube(const std::string& p_Path, const TextureSpecification& p_Spec)
+	{
+		YM_PROFILE_FUNCTION()
+
+		Utils::ImageContainer image;
+		if (!LoadImageContainer(p_Path, image))
+			return nullptr;
+
+		if (!image.IsCubeMap)
+		{
+			YM_CORE_ERROR("'{}' is not a cube map!", p_Path)
+			return nullptr;
+		}
+
+		TextureArraySpecification spec = {};
+		spec.Spec					   = p_Spec;
+		spec.Count					   = s_CUBEMAP_SIZE;
+		spec.Type					   = TextureArrayType::CubeMap;
+		ApplyImageContainer(image, spec.Spec);
+
+		return TextureArray::Create(spec, image.Data.data(), image.Data.size());
+	}
+
 	Ref<TextureArray> TextureImporter::LoadTextureCube(const std::vector<std::string>& p_Paths, const TextureSpecification& p_Spec)
 	{
 		YM_PROFILE_FUNCTION()
@@ -87,17 +177,11 @@ namespace YUME
 
 
 		uint32_t srcWidth, srcHeight, srcChannels = 4, srcBytes = 1;
-		uint8_t** cubeTextureData = new uint8_t * [s_CUBEMAP_SIZE];
-		for (int face = 0; face < s_CUBEMAP_SIZE; face++)
-			cubeTextureData[face] = nullptr;
-
-		uint32_t faceWidths[s_CUBEMAP_SIZE]  = {};
-		uint32_t faceHeights[s_CUBEMAP_SIZE] = {};
-		uint32_t channels					 = 4;
-		uint32_t bytes						 = 1;
-		size_t size							 = 0;
 		bool isHDR							 = false;
 
+		// Faces are decoded one after another and appended, each one is copied once
+		std::vector<uint8_t> allData;
+
 		for (int face = 0; face < s_CUBEMAP_SIZE; face++)
 		{
 			if (face >= p_Paths.size())
@@ -114,48 +198,15 @@ namespace YUME
 				spec.Spec.Width   = faceWidth;
 				spec.Spec.Height  = faceHeight;
 				spec.Spec.Format  = (isHDR) ? TextureFormat::RGBA32_FLOAT : TextureFormat::RGBA8_SRGB;
-				channels		  = srcChannels;
-				bytes			  = srcBytes;
-			}
-
-			uint32_t stride		  = channels * bytes;
-
-			faceWidths[face]	  = faceWidth;
-			faceHeights[face]	  = faceHeight;
-
-			cubeTextureData[face] = new uint8_t[faceWidth * faceHeight * stride];
-			size				 += uint64_t(faceWidth) * uint64_t(faceHeight) * uint64_t(stride);
-
-			for (uint32_t y = 0; y < faceHeight; y++)
-			{
-				for (uint32_t x = 0; x < faceWidth; x++)
-				{
-					cubeTextureData[face][(x + y * faceWidth) * stride + 0] = data[(x + y * faceWidth) * stride + 0];
-					cubeTextureData[face][(x + y * faceWidth) * stride + 1] = data[(x + y * faceWidth) * stride + 1];
-					cubeTextureData[face][(x + y * faceWidth) * stride + 2] = data[(x + y * faceWidth) * stride + 2];
-					if (stride >= 4)
-						cubeTextureData[face][(x + y * faceWidth) * stride + 3] = data[(x + y * faceWidth) * stride + 3];
-				}
 			}
-			delete[] data;
-		}
-
-		std::vector<uint8_t> allData;
-		allData.resize(size);
-		uint32_t pointeroffset = 0;
 
-		for (uint32_t face = 0; face < s_CUBEMAP_SIZE; face++)
-		{
-			uint32_t currentSize = faceWidths[face] * faceHeights[face] * channels * bytes;
-			memcpy(allData.data() + pointeroffset, cubeTextureData[face], currentSize);
-			pointeroffset += currentSize;
-		}
+			uint64_t faceSize	  = uint64_t(faceWidth) * uint64_t(faceHeight) * uint64_t(srcChannels) * uint64_t(srcBytes);
+			if (face == 0)
+				allData.reserve(faceSize * s_CUBEMAP_SIZE);
 
-		for (uint32_t face = 0; face < s_CUBEMAP_SIZE; face++)
-		{
-			delete[] cubeTextureData[face];
+			allData.insert(allData.end(), data, data + faceSize);
+			Utils::FreeImage(data);
 		}
-		delete[] cubeTextureData;
 
 		return TextureArray::Create(spec, allData.data(), allData.size());
 	}
@@ -9,9 +9,14 @@ namespace YUME
 	class YM_API TextureImporter
 	{
 		public:
+			// .ktx2 and .dds files are uploaded in their stored format with their own mip chain
 			static Ref<Texture2D>	 LoadTexture2D(const std::string& p_Path);
 			static Ref<Texture2D>	 LoadTexture2D(const std::string& p_Path, const TextureSpecification& p_Spec);
 
+			// A single .ktx2 or .dds cube map
+			static Ref<TextureArray> LoadTextureCube(const std::string& p_Path);
+			static Ref<TextureArray> LoadTextureCube(const std::string& p_Path, const TextureSpecification& p_Spec);
+
 			static Ref<TextureArray> LoadTextureCube(const std::vector<std::string>& p_Paths);
 			static Ref<TextureArray> LoadTextureCube(const std::vector<std::string>& p_Paths, const TextureSpecification& p_Spec);
 	};
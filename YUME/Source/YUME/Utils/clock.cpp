@@ -0,0 +1,17 @@
+#include "YUME/yumepch.h"
+#include "clock.h"
+
+// std
+#include <chrono>
+
+
+namespace YUME
+{
+	double Clock::GetTime()
+	{
+		// Doesn't depend on the window library, headless runs never initialize it
+		static const auto s_StartTime = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - s_StartTime).count();
+	}
+}
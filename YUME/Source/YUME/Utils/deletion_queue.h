@@ -1,6 +1,7 @@
 #pragma once
 #include "YUME/Core/base.h"
 #include <deque>
+#include <mutex>
 
 
 
@@ -11,19 +12,26 @@ namespace YUME
 		public:
 			void PushFunction(const std::function<void()>& p_Function)
 			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
 				m_Deletors.push_back(p_Function);
 			}
 
 			void Flush()
 			{
-				for (auto it = m_Deletors.rbegin(); it != m_Deletors.rend(); it++) {
-					(*it)(); //call functors
+				// Deletors may push new ones (e.g. from jobs), run them outside the lock
+				std::deque<std::function<void()>> deletors;
+				{
+					std::scoped_lock<std::mutex> lock(m_Mutex);
+					deletors.swap(m_Deletors);
 				}
 
-				m_Deletors.clear();
+				for (auto it = deletors.rbegin(); it != deletors.rend(); it++) {
+					(*it)(); //call functors
+				}
 			}
 
 		private:
 			std::deque<std::function<void()>> m_Deletors;
+			std::mutex m_Mutex;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "YUME/yumepch.h"
+#include "file_watcher.h"
+
+// std
+#include <set>
+#ifdef YM_PLATFORM_LINUX
+	#include <poll.h>
+	#include <sys/inotify.h>
+	#include <unistd.h>
+#endif
+
+
+
+namespace YUME::Utils
+{
+	// Editors write a file in several steps (truncate, write, rename), they are reported as one change
+	static constexpr auto s_SettleTime = std::chrono::milliseconds(50);
+
+	bool FileWatcher::Start(const std::filesystem::path& p_Directory, const Callback& p_Callback, uint32_t p_PollIntervalMs)
+	{
+		YM_PROFILE_FUNCTION()
+
+		Stop();
+
+		std::error_code error;
+		if (!std::filesystem::is_directory(p_Directory, error))
+		{
+			YM_CORE_WARN("FileWatcher - '{}' is not a directory", p_Directory.string())
+			return false;
+		}
+
+		m_Directory	   = std::filesystem::absolute(p_Directory, error).lexically_normal();
+		m_Callback	   = p_Callback;
+		m_PollInterval = std::max(p_PollIntervalMs, 1u);
+		m_Running	   = true;
+
+	#ifdef YM_PLATFORM_LINUX
+		if (InitNotify())
+		{
+			m_Thread = std::thread(&FileWatcher::NotifyLoop, this);
+			return true;
+		}
+
+		YM_CORE_WARN("FileWatcher - inotify is not available, polling '{}' every {} ms", m_Directory.string(), m_PollInterval)
+	#endif
+
+		m_Thread = std::thread(&FileWatcher::PollLoop, this);
+		return true;
+	}
+
+	void FileWatcher::Stop()
+	{
+		m_Running = false;
+		if (m_Thread.joinable())
+			m_Thread.join();
+
+	#ifdef YM_PLATFORM_LINUX
+		if (m_NotifyFD >= 0)
+		{
+			close(m_NotifyFD);
+			m_NotifyFD = -1;
+		}
+		m_WatchDirectories.clear();
+	#endif
+	}
+
+	std::unordered_map<std::string, std::filesystem::file_time_type> FileWatcher::ScanDirectory() const
+	{
+		std::unordered_map<std::string, std::filesystem::file_time_type> result;
+
+		std::error_code error;
+		for (auto it = std::filesystem::recursive_directory_iterator(m_Directory, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+		{
+			if (it->is_regular_file(error))
+				result[it->path().string()] = it->last_write_time(error);
+		}
+
+		return result;
+	}
+
+	void FileWatcher::PollLoop()
+	{
+		YM_PROFILE_THREAD("File Watcher")
+
+		auto known = ScanDirectory();
+
+		while (m_Running)
+		{
+			// Short sleeps so Stop doesn't wait for a whole interval
+			auto wakeTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_PollInterval);
+			while (m_Running && std::chrono::steady_clock::now() < wakeTime)
+				std::this_thread::sleep_for(std::chrono::milliseconds(std::min(m_PollInterval, 50u)));
+
+			if (!m_Running)
+				break;
+
+			auto current = ScanDirectory();
+
+			std::vector<std::filesystem::path> changed;
+			for (const auto& [path, time] : current)
+			{
+				auto it = known.find(path);
+				if (it == known.end() || it->second != time)
+					changed.emplace_back(path);
+			}
+
+			known = std::move(current);
+
+			if (!changed.empty())
+				m_Callback(changed);
+		}
+	}
+
+	#ifdef YM_PLATFORM_LINUX
+
+	bool FileWatcher::InitNotify()
+	{
+		m_NotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_NotifyFD < 0)
+			return false;
+
+		AddNotifyWatches(m_Directory);
+
+		std::error_code error;
+		for (auto it = std::filesystem::recursive_directory_iterator(m_Directory, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+		{
+			if (it->is_directory(error))
+				AddNotifyWatches(it->path());
+		}
+
+		if (m_WatchDirectories.empty())
+		{
+			close(m_NotifyFD);
+			m_NotifyFD = -1;
+			return false;
+		}
+
+		return true;
+	}
+
+	void FileWatcher::AddNotifyWatches(const std::filesystem::path& p_Directory)
+	{
+		int wd = inotify_add_watch(m_NotifyFD, p_Directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+		if (wd < 0)
+		{
+			YM_CORE_WARN("FileWatcher - Could not watch '{}'", p_Directory.string())
+			return;
+		}
+
+		m_WatchDirectories[wd] = p_Directory;
+	}
+
+	void FileWatcher::NotifyLoop()
+	{
+		YM_PROFILE_THREAD("File Watcher")
+
+		alignas(inotify_event) char buffer[4096];
+		std::set<std::filesystem::path> changed;
+
+		auto ReadEvents = [&]()
+		{
+			ssize_t length;
+			while ((length = read(m_NotifyFD, buffer, sizeof(buffer))) > 0)
+			{
+				for (char* ptr = buffer; ptr < buffer + length; ptr += sizeof(inotify_event) + ((inotify_event*)ptr)->len)
+				{
+					const auto* event = (const inotify_event*)ptr;
+
+					auto directory = m_WatchDirectories.find(event->wd);
+					if (directory == m_WatchDirectories.end() || event->len == 0)
+						continue;
+
+					auto path = directory->second / event->name;
+					if (event->mask & IN_ISDIR)
+					{
+						// New folders are watched too, files created inside them are reported as they are closed
+						if (event->mask & (IN_CREATE | IN_MOVED_TO))
+							AddNotifyWatches(path);
+						continue;
+					}
+
+					// A created file is reported once it is closed after writing
+					if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+						changed.insert(path);
+				}
+			}
+		};
+
+		while (m_Running)
+		{
+			pollfd fd{ m_NotifyFD, POLLIN, 0 };
+			if (poll(&fd, 1, 100) <= 0 || !(fd.revents & POLLIN))
+				continue;
+
+			ReadEvents();
+
+			std::this_thread::sleep_for(s_SettleTime);
+			ReadEvents();
+
+			if (!changed.empty())
+			{
+				m_Callback(std::vector<std::filesystem::path>(changed.begin(), changed.end()));
+				changed.clear();
+			}
+		}
+	}
+
+	#endif
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "YUME/Core/base.h"
+
+// std
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace YUME::Utils
+{
+	// Reports the files written, created or moved into a directory tree. Uses inotify on Linux and
+	// falls back to comparing write times every poll interval anywhere else, or when inotify fails.
+	class YM_API FileWatcher
+	{
+		public:
+			// Runs on the watcher thread, with absolute paths and each file once per batch
+			using Callback = std::function<void(const std::vector<std::filesystem::path>& p_Files)>;
+
+			FileWatcher() = default;
+			~FileWatcher() { Stop(); }
+
+			bool Start(const std::filesystem::path& p_Directory, const Callback& p_Callback, uint32_t p_PollIntervalMs = 500);
+			void Stop();
+
+			bool IsRunning() const { return m_Thread.joinable(); }
+
+		private:
+			void PollLoop();
+			std::unordered_map<std::string, std::filesystem::file_time_type> ScanDirectory() const;
+
+		#ifdef YM_PLATFORM_LINUX
+			bool InitNotify();
+			void AddNotifyWatches(const std::filesystem::path& p_Directory);
+			void NotifyLoop();
+		#endif
+
+		private:
+			std::filesystem::path m_Directory;
+			Callback m_Callback;
+			uint32_t m_PollInterval = 500;
+
+			std::thread m_Thread;
+			std::atomic<bool> m_Running = false;
+
+		#ifdef YM_PLATFORM_LINUX
+			int m_NotifyFD = -1;
+			std::unordered_map<int, std::filesystem::path> m_WatchDirectories;
+		#endif
+
+			YM_NONCOPYABLEANDMOVE(FileWatcher)
+	};
+}
@@ -0,0 +1,843 @@
+#include "YUME/yumepch.h"
+#include "image_container.h"
+#include "YUME/Renderer/texture.h"
+
+// Lib
+#include <vulkan/vulkan.h>
+
+// std
+#include <bit>
+#include <fstream>
+
+
+
+namespace YUME::Utils
+{
+	#pragma region CONTAINERS
+
+	static uint64_t GetLevelSize(TextureFormat p_Format, uint32_t p_Width, uint32_t p_Height)
+	{
+		if (Texture::IsCompressedFormat(p_Format))
+			return Texture::GetCompressedSize(p_Format, p_Width, p_Height);
+
+		// Only RGBA8 is read uncompressed
+		return uint64_t(p_Width) * uint64_t(p_Height) * 4;
+	}
+
+	// Larger than any device supports, keeps every size computed from the header within 64 bits
+	static constexpr uint32_t s_MaxDimension  = 1u << 16;
+	static constexpr uint32_t s_MaxLayerCount = 1u << 12;
+
+	static bool ValidateExtent(const char* p_Path, uint32_t p_Width, uint32_t p_Height, uint32_t p_LayerCount, uint32_t& p_MipLevels)
+	{
+		if (p_Width == 0 || p_Height == 0 || p_Width > s_MaxDimension || p_Height > s_MaxDimension || p_LayerCount == 0 || p_LayerCount > s_MaxLayerCount)
+		{
+			YM_CORE_ERROR("'{}' has an invalid size ({}x{}, {} layers)!", p_Path, p_Width, p_Height, p_LayerCount)
+			return false;
+		}
+
+		// Levels past a 1x1 are ignored, the header value isn't trusted
+		p_MipLevels = std::min(p_MipLevels, (uint32_t)std::bit_width(std::max(p_Width, p_Height)));
+		return true;
+	}
+
+	// Written so the sum can't wrap
+	static bool IsInFile(uint64_t p_Offset, uint64_t p_Size, uint64_t p_FileSize)
+	{
+		return p_Offset <= p_FileSize && p_Size <= p_FileSize - p_Offset;
+	}
+
+	static bool ReadFile(const char* p_Path, std::vector<uint8_t>& p_Bytes)
+	{
+		std::ifstream file(p_Path, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+		{
+			YM_CORE_ERROR("Could not open image '{}'!", p_Path)
+			return false;
+		}
+
+		p_Bytes.resize((size_t)file.tellg());
+		file.seekg(0);
+		file.read((char*)p_Bytes.data(), p_Bytes.size());
+
+		return true;
+	}
+
+	// KTX2 stores the format as a VkFormat
+	static TextureFormat KTX2FormatToTexture(uint32_t p_Format)
+	{
+		switch (p_Format)
+		{
+			case VK_FORMAT_R8G8B8A8_UNORM:		  return TextureFormat::RGBA8_UNORM;
+			case VK_FORMAT_R8G8B8A8_SRGB:		  return TextureFormat::RGBA8_SRGB;
+			// The RGB variants only differ on punch-through texels
+			case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+			case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:  return TextureFormat::BC1_UNORM;
+			case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+			case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:	  return TextureFormat::BC1_SRGB;
+			case VK_FORMAT_BC3_UNORM_BLOCK:		  return TextureFormat::BC3_UNORM;
+			case VK_FORMAT_BC3_SRGB_BLOCK:		  return TextureFormat::BC3_SRGB;
+			case VK_FORMAT_BC4_UNORM_BLOCK:		  return TextureFormat::BC4_UNORM;
+			case VK_FORMAT_BC5_UNORM_BLOCK:		  return TextureFormat::BC5_UNORM;
+			case VK_FORMAT_BC7_UNORM_BLOCK:		  return TextureFormat::BC7_UNORM;
+			case VK_FORMAT_BC7_SRGB_BLOCK:		  return TextureFormat::BC7_SRGB;
+			default:							  return TextureFormat::None;
+		}
+	}
+
+	struct KTX2Header
+	{
+		uint8_t Identifier[12];
+		uint32_t VkFormat;
+		uint32_t TypeSize;
+		uint32_t PixelWidth;
+		uint32_t PixelHeight;
+		uint32_t PixelDepth;
+		uint32_t LayerCount;
+		uint32_t FaceCount;
+		uint32_t LevelCount;
+		uint32_t SupercompressionScheme;
+
+		uint32_t DfdByteOffset;
+		uint32_t DfdByteLength;
+		uint32_t KvdByteOffset;
+		uint32_t KvdByteLength;
+		uint64_t SgdByteOffset;
+		uint64_t SgdByteLength;
+	};
+	static_assert(sizeof(KTX2Header) == 80);
+
+	struct KTX2Level
+	{
+		uint64_t ByteOffset;
+		uint64_t ByteLength;
+		uint64_t UncompressedByteLength;
+	};
+
+	static const uint8_t s_KTX2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+	static bool LoadKTX2(const char* p_Path, const std::vector<uint8_t>& p_Bytes, ImageContainer& p_Image)
+	{
+		if (p_Bytes.size() < sizeof(KTX2Header) || memcmp(p_Bytes.data(), s_KTX2Identifier, sizeof(s_KTX2Identifier)) != 0)
+		{
+			YM_CORE_ERROR("'{}' is not a KTX2 file!", p_Path)
+			return false;
+		}
+
+		KTX2Header header;
+		memcpy(&header, p_Bytes.data(), sizeof(KTX2Header));
+
+		if (header.SupercompressionScheme != 0)
+		{
+			YM_CORE_ERROR("'{}' uses supercompression scheme {}, only plain KTX2 files are supported!", p_Path, header.SupercompressionScheme)
+			return false;
+		}
+
+		if (header.PixelDepth > 1 || (header.FaceCount != 1 && header.FaceCount != 6))
+		{
+			YM_CORE_ERROR("'{}' is not a 2D or cube map texture!", p_Path)
+			return false;
+		}
+
+		p_Image.Format	   = KTX2FormatToTexture(header.VkFormat);
+		if (p_Image.Format == TextureFormat::None)
+		{
+			YM_CORE_ERROR("'{}' has an unsupported format ({})!", p_Path, header.VkFormat)
+			return false;
+		}
+
+		if (header.LayerCount > s_MaxLayerCount)
+		{
+			YM_CORE_ERROR("'{}' has too many layers ({})!", p_Path, header.LayerCount)
+			return false;
+		}
+
+		p_Image.Width	   = header.PixelWidth;
+		p_Image.Height	   = std::max(header.PixelHeight, 1u);
+		// A level count of 0 means only the base level is stored. It is read as one level. The texture
+		// importer generates mips for single level uncompressed images, compressed ones keep one level
+		p_Image.MipLevels  = std::max(header.LevelCount, 1u);
+		p_Image.LayerCount = std::max(header.LayerCount, 1u) * header.FaceCount;
+		p_Image.IsCubeMap  = header.FaceCount == 6 && header.LayerCount <= 1;
+
+		// The level index is sized by the header's count, the extra levels are skipped
+		uint64_t levelIndexSize = sizeof(KTX2Level) * (uint64_t)std::max(header.LevelCount, 1u);
+		if (!IsInFile(sizeof(KTX2Header), levelIndexSize, p_Bytes.size()))
+		{
+			YM_CORE_ERROR("'{}' is truncated!", p_Path)
+			return false;
+		}
+
+		if (!ValidateExtent(p_Path, p_Image.Width, p_Image.Height, p_Image.LayerCount, p_Image.MipLevels))
+			return false;
+
+		std::vector<KTX2Level> levels(p_Image.MipLevels);
+		memcpy(levels.data(), p_Bytes.data() + sizeof(KTX2Header), sizeof(KTX2Level) * p_Image.MipLevels);
+
+		// Every level is checked against the file before anything is allocated
+		std::vector<uint64_t> levelSizes(p_Image.MipLevels);
+		uint64_t totalSize = 0;
+		for (uint32_t level = 0; level < p_Image.MipLevels; level++)
+		{
+			levelSizes[level] = GetLevelSize(p_Image.Format, std::max(p_Image.Width >> level, 1u), std::max(p_Image.Height >> level, 1u)) * p_Image.LayerCount;
+			if (levels[level].ByteLength < levelSizes[level] || !IsInFile(levels[level].ByteOffset, levelSizes[level], p_Bytes.size()))
+			{
+				YM_CORE_ERROR("'{}' level {} is truncated!", p_Path, level)
+				return false;
+			}
+
+			totalSize += levelSizes[level];
+		}
+
+		p_Image.Data.resize(totalSize);
+
+		// Levels are stored smallest first, but each one already holds every layer and face in order
+		uint64_t offset = 0;
+		for (uint32_t level = 0; level < p_Image.MipLevels; level++)
+		{
+			memcpy(p_Image.Data.data() + offset, p_Bytes.data() + levels[level].ByteOffset, levelSizes[level]);
+			offset += levelSizes[level];
+		}
+
+		return true;
+	}
+
+	struct DDSPixelFormat
+	{
+		uint32_t Size;
+		uint32_t Flags;
+		uint32_t FourCC;
+		uint32_t RGBBitCount;
+		uint32_t RBitMask;
+		uint32_t GBitMask;
+		uint32_t BBitMask;
+		uint32_t ABitMask;
+	};
+
+	struct DDSHeader
+	{
+		uint32_t Size;
+		uint32_t Flags;
+		uint32_t Height;
+		uint32_t Width;
+		uint32_t PitchOrLinearSize;
+		uint32_t Depth;
+		uint32_t MipMapCount;
+		uint32_t Reserved1[11];
+		DDSPixelFormat PixelFormat;
+		uint32_t Caps;
+		uint32_t Caps2;
+		uint32_t Caps3;
+		uint32_t Caps4;
+		uint32_t Reserved2;
+	};
+	static_assert(sizeof(DDSHeader) == 124);
+
+	struct DDSHeaderDXT10
+	{
+		uint32_t DXGIFormat;
+		uint32_t ResourceDimension;
+		uint32_t MiscFlag;
+		uint32_t ArraySize;
+		uint32_t MiscFlags2;
+	};
+
+	static constexpr uint32_t MakeFourCC(char p_A, char p_B, char p_C, char p_D)
+	{
+		return uint32_t(uint8_t(p_A)) | (uint32_t(uint8_t(p_B)) << 8) | (uint32_t(uint8_t(p_C)) << 16) | (uint32_t(uint8_t(p_D)) << 24);
+	}
+
+	static constexpr uint32_t s_DDSMagic			 = MakeFourCC('D', 'D', 'S', ' ');
+	static constexpr uint32_t s_DDSFlagMipMapCount	 = 0x20000;
+	static constexpr uint32_t s_DDSPixelFourCC		 = 0x4;
+	static constexpr uint32_t s_DDSPixelRGB			 = 0x40;
+	static constexpr uint32_t s_DDSCaps2CubeMap		 = 0x200;
+	static constexpr uint32_t s_DDSMiscTextureCube	 = 0x4;
+	static constexpr uint32_t s_DDSDimensionTexture2D = 3;
+
+	static TextureFormat DXGIFormatToTexture(uint32_t p_Format)
+	{
+		switch (p_Format)
+		{
+			case 28: return TextureFormat::RGBA8_UNORM;	// DXGI_FORMAT_R8G8B8A8_UNORM
+			case 29: return TextureFormat::RGBA8_SRGB;	// DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+			case 71: return TextureFormat::BC1_UNORM;	// DXGI_FORMAT_BC1_UNORM
+			case 72: return TextureFormat::BC1_SRGB;	// DXGI_FORMAT_BC1_UNORM_SRGB
+			case 77: return TextureFormat::BC3_UNORM;	// DXGI_FORMAT_BC3_UNORM
+			case 78: return TextureFormat::BC3_SRGB;	// DXGI_FORMAT_BC3_UNORM_SRGB
+			case 80: return TextureFormat::BC4_UNORM;	// DXGI_FORMAT_BC4_UNORM
+			case 83: return TextureFormat::BC5_UNORM;	// DXGI_FORMAT_BC5_UNORM
+			case 98: return TextureFormat::BC7_UNORM;	// DXGI_FORMAT_BC7_UNORM
+			case 99: return TextureFormat::BC7_SRGB;	// DXGI_FORMAT_BC7_UNORM_SRGB
+			default: return TextureFormat::None;
+		}
+	}
+
+	static TextureFormat DDSPixelFormatToTexture(const DDSPixelFormat& p_Format)
+	{
+		if (p_Format.Flags & s_DDSPixelFourCC)
+		{
+			// Legacy files carry no color space, color data is treated as sRGB like the stb path does
+			switch (p_Format.FourCC)
+			{
+				case MakeFourCC('D', 'X', 'T', '1'): return TextureFormat::BC1_SRGB;
+				case MakeFourCC('D', 'X', 'T', '5'): return TextureFormat::BC3_SRGB;
+				case MakeFourCC('A', 'T', 'I', '1'):
+				case MakeFourCC('B', 'C', '4', 'U'): return TextureFormat::BC4_UNORM;
+				case MakeFourCC('A', 'T', 'I', '2'):
+				case MakeFourCC('B', 'C', '5', 'U'): return TextureFormat::BC5_UNORM;
+				default:							 return TextureFormat::None;
+			}
+		}
+
+		if ((p_Format.Flags & s_DDSPixelRGB) && p_Format.RGBBitCount == 32 &&
+			p_Format.RBitMask == 0x000000FF && p_Format.GBitMask == 0x0000FF00 && p_Format.BBitMask == 0x00FF0000)
+		{
+			return TextureFormat::RGBA8_UNORM;
+		}
+
+		return TextureFormat::None;
+	}
+
+	static bool LoadDDS(const char* p_Path, const std::vector<uint8_t>& p_Bytes, ImageContainer& p_Image)
+	{
+		uint32_t magic = 0;
+		if (p_Bytes.size() >= sizeof(uint32_t) + sizeof(DDSHeader))
+			memcpy(&magic, p_Bytes.data(), sizeof(uint32_t));
+
+		if (magic != s_DDSMagic)
+		{
+			YM_CORE_ERROR("'{}' is not a DDS file!", p_Path)
+			return false;
+		}
+
+		DDSHeader header;
+		memcpy(&header, p_Bytes.data() + sizeof(uint32_t), sizeof(DDSHeader));
+		size_t offset		 = sizeof(uint32_t) + sizeof(DDSHeader);
+
+		uint32_t arraySize	 = 1;
+		bool isCubeMap		 = (header.Caps2 & s_DDSCaps2CubeMap) != 0;
+
+		if ((header.PixelFormat.Flags & s_DDSPixelFourCC) && header.PixelFormat.FourCC == MakeFourCC('D', 'X', '1', '0'))
+		{
+			if (p_Bytes.size() < offset + sizeof(DDSHeaderDXT10))
+			{
+				YM_CORE_ERROR("'{}' is truncated!", p_Path)
+				return false;
+			}
+
+			DDSHeaderDXT10 extension;
+			memcpy(&extension, p_Bytes.data() + offset, sizeof(DDSHeaderDXT10));
+			offset			+= sizeof(DDSHeaderDXT10);
+
+			if (extension.ResourceDimension != s_DDSDimensionTexture2D)
+			{
+				YM_CORE_ERROR("'{}' is not a 2D or cube map texture!", p_Path)
+				return false;
+			}
+
+			if (extension.ArraySize > s_MaxLayerCount)
+			{
+				YM_CORE_ERROR("'{}' has too many layers ({})!", p_Path, extension.ArraySize)
+				return false;
+			}
+
+			p_Image.Format	 = DXGIFormatToTexture(extension.DXGIFormat);
+			arraySize		 = std::max(extension.ArraySize, 1u);
+			isCubeMap		 = (extension.MiscFlag & s_DDSMiscTextureCube) != 0;
+		}
+		else
+		{
+			p_Image.Format	 = DDSPixelFormatToTexture(header.PixelFormat);
+		}
+
+		if (p_Image.Format == TextureFormat::None)
+		{
+			YM_CORE_ERROR("'{}' has an unsupported format!", p_Path)
+			return false;
+		}
+
+		p_Image.Width		 = header.Width;
+		p_Image.Height		 = header.Height;
+		p_Image.MipLevels	 = (header.Flags & s_DDSFlagMipMapCount) ? std::max(header.MipMapCount, 1u) : 1;
+		p_Image.LayerCount	 = arraySize * (isCubeMap ? 6 : 1);
+		p_Image.IsCubeMap	 = isCubeMap && arraySize == 1;
+
+		if (!ValidateExtent(p_Path, p_Image.Width, p_Image.Height, p_Image.LayerCount, p_Image.MipLevels))
+			return false;
+
+		std::vector<uint64_t> levelSizes(p_Image.MipLevels);
+		uint64_t layerSize	 = 0;
+		for (uint32_t level = 0; level < p_Image.MipLevels; level++)
+		{
+			levelSizes[level] = GetLevelSize(p_Image.Format, std::max(p_Image.Width >> level, 1u), std::max(p_Image.Height >> level, 1u));
+			layerSize		 += levelSizes[level];
+		}
+
+		// The sizes are bounded by ValidateExtent, only the comparison with the file could wrap
+		if (!IsInFile(offset, layerSize * p_Image.LayerCount, p_Bytes.size()))
+		{
+			YM_CORE_ERROR("'{}' is truncated!", p_Path)
+			return false;
+		}
+
+		// DDS stores every layer with its whole mip chain, reorder it level by level
+		p_Image.Data.resize(layerSize * p_Image.LayerCount);
+
+		uint64_t levelOffset = 0;
+		for (uint32_t level = 0; level < p_Image.MipLevels; level++)
+		{
+			uint64_t srcOffset = offset;
+			for (uint32_t i = 0; i < level; i++)
+				srcOffset += levelSizes[i];
+
+			for (uint32_t layer = 0; layer < p_Image.LayerCount; layer++)
+			{
+				memcpy(p_Image.Data.data() + levelOffset + levelSizes[level] * layer, p_Bytes.data() + srcOffset + layerSize * layer, levelSizes[level]);
+			}
+
+			levelOffset += levelSizes[level] * p_Image.LayerCount;
+		}
+
+		return true;
+	}
+
+	static std::string GetExtension(const std::filesystem::path& p_Path)
+	{
+		auto extension = p_Path.extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char p_Char) { return (char)std::tolower(p_Char); });
+
+		return extension;
+	}
+
+	bool IsImageContainerFile(const std::filesystem::path& p_Path)
+	{
+		auto extension = GetExtension(p_Path);
+		return extension == ".ktx2" || extension == ".dds";
+	}
+
+	bool LoadImageContainer(const char* p_Path, ImageContainer& p_Image)
+	{
+		YM_PROFILE_FUNCTION()
+
+		std::vector<uint8_t> bytes;
+		if (!ReadFile(p_Path, bytes))
+			return false;
+
+		bool loaded = GetExtension(p_Path) == ".dds" ? LoadDDS(p_Path, bytes, p_Image) : LoadKTX2(p_Path, bytes, p_Image);
+
+		if (loaded && (p_Image.Width == 0 || p_Image.Height == 0))
+		{
+			YM_CORE_ERROR("'{}' has no pixels!", p_Path)
+			return false;
+		}
+
+		return loaded;
+	}
+
+	#pragma endregion
+
+	#pragma region BLOCK_DECODING
+
+	// Every decoder writes one 4x4 block as 16 RGBA8 texels, row by row
+
+	static void DecodeColorBlock(const uint8_t* p_Block, uint8_t* p_Out, bool p_AlwaysOpaque)
+	{
+		uint16_t c0 = uint16_t(p_Block[0] | (p_Block[1] << 8));
+		uint16_t c1 = uint16_t(p_Block[2] | (p_Block[3] << 8));
+		uint32_t indices = uint32_t(p_Block[4]) | (uint32_t(p_Block[5]) << 8) | (uint32_t(p_Block[6]) << 16) | (uint32_t(p_Block[7]) << 24);
+
+		uint8_t colors[4][4];
+		auto expand = [](uint16_t p_Color, uint8_t* p_Rgba)
+		{
+			uint8_t r = (p_Color >> 11) & 31, g = (p_Color >> 5) & 63, b = p_Color & 31;
+			p_Rgba[0] = uint8_t((r << 3) | (r >> 2));
+			p_Rgba[1] = uint8_t((g << 2) | (g >> 4));
+			p_Rgba[2] = uint8_t((b << 3) | (b >> 2));
+			p_Rgba[3] = 255;
+		};
+
+		expand(c0, colors[0]);
+		expand(c1, colors[1]);
+
+		for (int c = 0; c < 3; c++)
+		{
+			if (c0 > c1 || p_AlwaysOpaque)
+			{
+				colors[2][c] = uint8_t((2 * colors[0][c] + colors[1][c]) / 3);
+				colors[3][c] = uint8_t((colors[0][c] + 2 * colors[1][c]) / 3);
+			}
+			else
+			{
+				colors[2][c] = uint8_t((colors[0][c] + colors[1][c]) / 2);
+				colors[3][c] = 0;
+			}
+		}
+		colors[2][3] = 255;
+		colors[3][3] = (c0 > c1 || p_AlwaysOpaque) ? 255 : 0;
+
+		for (int i = 0; i < 16; i++)
+			memcpy(p_Out + i * 4, colors[(indices >> (i * 2)) & 3], 4);
+	}
+
+	// BC4 block, also the alpha of BC3 and each channel of BC5
+	static void DecodeChannelBlock(const uint8_t* p_Block, uint8_t* p_Out, uint32_t p_Channel)
+	{
+		uint8_t values[8];
+		values[0] = p_Block[0];
+		values[1] = p_Block[1];
+
+		if (values[0] > values[1])
+		{
+			for (int i = 1; i < 7; i++)
+				values[i + 1] = uint8_t(((7 - i) * values[0] + i * values[1]) / 7);
+		}
+		else
+		{
+			for (int i = 1; i < 5; i++)
+				values[i + 1] = uint8_t(((5 - i) * values[0] + i * values[1]) / 5);
+			values[6] = 0;
+			values[7] = 255;
+		}
+
+		uint64_t indices = 0;
+		for (int i = 0; i < 6; i++)
+			indices |= uint64_t(p_Block[2 + i]) << (i * 8);
+
+		for (int i = 0; i < 16; i++)
+			p_Out[i * 4 + p_Channel] = values[(indices >> (i * 3)) & 7];
+	}
+
+	struct BC7Mode
+	{
+		uint8_t Subsets;
+		uint8_t PartitionBits;
+		uint8_t RotationBits;
+		uint8_t IndexSelectionBits;
+		uint8_t ColorBits;
+		uint8_t AlphaBits;
+		uint8_t EndpointPBits;
+		uint8_t SharedPBits;
+		uint8_t IndexBits;
+		uint8_t SecondaryIndexBits;
+	};
+
+	static const BC7Mode s_BC7Modes[8] = {
+		{ 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+		{ 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+		{ 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+		{ 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+		{ 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+		{ 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+		{ 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+		{ 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+	};
+
+	// One bit per texel, set when it belongs to the second subset
+	static const uint16_t s_BC7Partitions2[64] = {
+		0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+		0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+		0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+		0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+		0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+		0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+		0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+		0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+	};
+
+	// Two bits per texel
+	static const uint32_t s_BC7Partitions3[64] = {
+		0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+		0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+		0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+		0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+		0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+		0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+		0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+		0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254,
+	};
+
+	static const uint8_t s_BC7Anchors2[64] = {
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+		15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+		 6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15,
+	};
+
+	static const uint8_t s_BC7Anchors3Second[64] = {
+		 3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+		 3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+		 8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+		 3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3,
+	};
+
+	static const uint8_t s_BC7Anchors3Third[64] = {
+		15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+		15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+		15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+		15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8,
+	};
+
+	static const uint8_t s_BC7Weights2[4]  = { 0, 21, 43, 64 };
+	static const uint8_t s_BC7Weights3[8]  = { 0, 9, 18, 27, 37, 46, 55, 64 };
+	static const uint8_t s_BC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	struct BitReader
+	{
+		const uint8_t* Data = nullptr;
+		uint32_t Position	= 0;
+
+		uint32_t Read(uint32_t p_Count)
+		{
+			uint32_t value = 0;
+			for (uint32_t i = 0; i < p_Count; i++, Position++)
+				value |= uint32_t((Data[Position >> 3] >> (Position & 7)) & 1) << i;
+			return value;
+		}
+	};
+
+	static uint8_t BC7Interpolate(uint8_t p_E0, uint8_t p_E1, uint32_t p_Index, uint32_t p_IndexBits)
+	{
+		const uint8_t* weights = p_IndexBits == 2 ? s_BC7Weights2 : (p_IndexBits == 3 ? s_BC7Weights3 : s_BC7Weights4);
+		uint32_t weight		   = weights[p_Index];
+
+		return uint8_t(((64 - weight) * p_E0 + weight * p_E1 + 32) >> 6);
+	}
+
+	static void DecodeBC7Block(const uint8_t* p_Block, uint8_t* p_Out)
+	{
+		uint32_t modeIndex = 0;
+		while (modeIndex < 8 && !(p_Block[0] & (1 << modeIndex)))
+			modeIndex++;
+
+		// Reserved mode, decodes to transparent black
+		if (modeIndex >= 8)
+		{
+			memset(p_Out, 0, 16 * 4);
+			return;
+		}
+
+		const BC7Mode& mode	= s_BC7Modes[modeIndex];
+		BitReader reader	= { p_Block, modeIndex + 1 };
+
+		uint32_t partition	= reader.Read(mode.PartitionBits);
+		uint32_t rotation	= reader.Read(mode.RotationBits);
+		uint32_t indexSel	= reader.Read(mode.IndexSelectionBits);
+
+		uint32_t endpointCount = mode.Subsets * 2u;
+		uint8_t endpoints[6][4] = {};
+
+		for (uint32_t c = 0; c < 3; c++)
+		{
+			for (uint32_t e = 0; e < endpointCount; e++)
+				endpoints[e][c] = (uint8_t)reader.Read(mode.ColorBits);
+		}
+
+		for (uint32_t e = 0; e < endpointCount; e++)
+			endpoints[e][3] = mode.AlphaBits ? (uint8_t)reader.Read(mode.AlphaBits) : 255;
+
+		uint32_t colorBits = mode.ColorBits;
+		uint32_t alphaBits = mode.AlphaBits;
+
+		if (mode.EndpointPBits || mode.SharedPBits)
+		{
+			uint8_t pBits[6] = {};
+			if (mode.EndpointPBits)
+			{
+				for (uint32_t e = 0; e < endpointCount; e++)
+					pBits[e] = (uint8_t)reader.Read(1);
+			}
+			else
+			{
+				for (uint32_t s = 0; s < mode.Subsets; s++)
+					pBits[s * 2] = pBits[s * 2 + 1] = (uint8_t)reader.Read(1);
+			}
+
+			for (uint32_t e = 0; e < endpointCount; e++)
+			{
+				for (uint32_t c = 0; c < 4; c++)
+				{
+					if (c == 3 && !mode.AlphaBits)
+						continue;
+					endpoints[e][c] = uint8_t((endpoints[e][c] << 1) | pBits[e]);
+				}
+			}
+
+			colorBits++;
+			if (alphaBits)
+				alphaBits++;
+		}
+
+		// Extend every endpoint to 8 bits by replicating its high bits
+		for (uint32_t e = 0; e < endpointCount; e++)
+		{
+			for (uint32_t c = 0; c < 4; c++)
+			{
+				uint32_t bits = c == 3 ? alphaBits : colorBits;
+				if (bits == 0)
+					continue;
+
+				uint32_t value  = uint32_t(endpoints[e][c]) << (8 - bits);
+				endpoints[e][c] = uint8_t(value | (value >> bits));
+			}
+		}
+
+		auto getSubset = [&](uint32_t p_Texel) -> uint32_t
+		{
+			if (mode.Subsets == 2) return (s_BC7Partitions2[partition] >> p_Texel) & 1;
+			if (mode.Subsets == 3) return (s_BC7Partitions3[partition] >> (p_Texel * 2)) & 3;
+			return 0;
+		};
+
+		auto isAnchor = [&](uint32_t p_Texel) -> bool
+		{
+			if (p_Texel == 0) return true;
+			if (mode.Subsets == 2) return p_Texel == s_BC7Anchors2[partition];
+			if (mode.Subsets == 3) return p_Texel == s_BC7Anchors3Second[partition] || p_Texel == s_BC7Anchors3Third[partition];
+			return false;
+		};
+
+		// Anchor texels drop the top bit of their index
+		uint32_t indices[16];
+		for (uint32_t i = 0; i < 16; i++)
+			indices[i] = reader.Read(isAnchor(i) ? mode.IndexBits - 1 : mode.IndexBits);
+
+		uint32_t secondaryIndices[16] = {};
+		if (mode.SecondaryIndexBits)
+		{
+			for (uint32_t i = 0; i < 16; i++)
+				secondaryIndices[i] = reader.Read(i == 0 ? mode.SecondaryIndexBits - 1 : mode.SecondaryIndexBits);
+		}
+
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			uint32_t subset = getSubset(i);
+			const uint8_t* e0 = endpoints[subset * 2];
+			const uint8_t* e1 = endpoints[subset * 2 + 1];
+			uint8_t* texel	  = p_Out + i * 4;
+
+			if (mode.SecondaryIndexBits)
+			{
+				// The selection bit swaps which index set drives color and alpha
+				uint32_t colorIndex = indexSel ? secondaryIndices[i] : indices[i];
+				uint32_t colorIBits = indexSel ? mode.SecondaryIndexBits : mode.IndexBits;
+				uint32_t alphaIndex = indexSel ? indices[i] : secondaryIndices[i];
+				uint32_t alphaIBits = indexSel ? mode.IndexBits : mode.SecondaryIndexBits;
+
+				for (uint32_t c = 0; c < 3; c++)
+					texel[c] = BC7Interpolate(e0[c], e1[c], colorIndex, colorIBits);
+				texel[3] = BC7Interpolate(e0[3], e1[3], alphaIndex, alphaIBits);
+			}
+			else
+			{
+				for (uint32_t c = 0; c < 4; c++)
+					texel[c] = BC7Interpolate(e0[c], e1[c], indices[i], mode.IndexBits);
+			}
+
+			if (rotation > 0)
+				std::swap(texel[3], texel[rotation - 1]);
+		}
+	}
+
+	static void DecodeBlock(TextureFormat p_Format, const uint8_t* p_Block, uint8_t* p_Out)
+	{
+		switch (p_Format)
+		{
+			case TextureFormat::BC1_SRGB:
+			case TextureFormat::BC1_UNORM:
+				DecodeColorBlock(p_Block, p_Out, false);
+				break;
+
+			case TextureFormat::BC3_SRGB:
+			case TextureFormat::BC3_UNORM:
+				DecodeColorBlock(p_Block + 8, p_Out, true);
+				DecodeChannelBlock(p_Block, p_Out, 3);
+				break;
+
+			case TextureFormat::BC4_UNORM:
+			case TextureFormat::BC5_UNORM:
+				for (int i = 0; i < 16; i++)
+				{
+					p_Out[i * 4 + 1] = 0;
+					p_Out[i * 4 + 2] = 0;
+					p_Out[i * 4 + 3] = 255;
+				}
+
+				DecodeChannelBlock(p_Block, p_Out, 0);
+				if (p_Format == TextureFormat::BC5_UNORM)
+					DecodeChannelBlock(p_Block + 8, p_Out, 1);
+				break;
+
+			case TextureFormat::BC7_SRGB:
+			case TextureFormat::BC7_UNORM:
+				DecodeBC7Block(p_Block, p_Out);
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	bool DecompressImageContainer(const ImageContainer& p_Image, ImageContainer& p_Decoded)
+	{
+		YM_PROFILE_FUNCTION()
+
+		if (!Texture::IsCompressedFormat(p_Image.Format))
+		{
+			p_Decoded = p_Image;
+			return true;
+		}
+
+		bool isSRGB = p_Image.Format == TextureFormat::BC1_SRGB || p_Image.Format == TextureFormat::BC3_SRGB || p_Image.Format == TextureFormat::BC7_SRGB;
+
+		p_Decoded.Format	 = isSRGB ? TextureFormat::RGBA8_SRGB : TextureFormat::RGBA8_UNORM;
+		p_Decoded.Width		 = p_Image.Width;
+		p_Decoded.Height	 = p_Image.Height;
+		p_Decoded.MipLevels	 = p_Image.MipLevels;
+		p_Decoded.LayerCount = p_Image.LayerCount;
+		p_Decoded.IsCubeMap	 = p_Image.IsCubeMap;
+
+		uint64_t decodedSize = 0;
+		for (uint32_t level = 0; level < p_Image.MipLevels; level++)
+			decodedSize += GetLevelSize(p_Decoded.Format, std::max(p_Image.Width >> level, 1u), std::max(p_Image.Height >> level, 1u)) * p_Image.LayerCount;
+
+		p_Decoded.Data.resize(decodedSize);
+
+		uint32_t blockSize = Texture::GetCompressedBlockSize(p_Image.Format);
+		const uint8_t* src = p_Image.Data.data();
+		uint8_t* dst	   = p_Decoded.Data.data();
+		uint8_t texels[16 * 4];
+
+		for (uint32_t level = 0; level < p_Image.MipLevels; level++)
+		{
+			uint32_t width	 = std::max(p_Image.Width >> level, 1u);
+			uint32_t height	 = std::max(p_Image.Height >> level, 1u);
+			uint32_t blocksX = (width + 3) / 4;
+			uint32_t blocksY = (height + 3) / 4;
+
+			for (uint32_t layer = 0; layer < p_Image.LayerCount; layer++)
+			{
+				for (uint32_t by = 0; by < blocksY; by++)
+				{
+					for (uint32_t bx = 0; bx < blocksX; bx++)
+					{
+						DecodeBlock(p_Image.Format, src, texels);
+						src += blockSize;
+
+						// Blocks on the right and bottom edges may hang over the image
+						uint32_t copyWidth  = std::min(4u, width - bx * 4);
+						uint32_t copyHeight = std::min(4u, height - by * 4);
+						for (uint32_t y = 0; y < copyHeight; y++)
+							memcpy(dst + ((uint64_t(by) * 4 + y) * width + bx * 4) * 4, texels + y * 16, copyWidth * 4);
+					}
+				}
+
+				dst += uint64_t(width) * height * 4;
+			}
+		}
+
+		return true;
+	}
+
+	#pragma endregion
+}
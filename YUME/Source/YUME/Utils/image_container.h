@@ -0,0 +1,33 @@
+#pragma once
+#include "YUME/Core/definitions.h"
+
+// std
+#include <filesystem>
+#include <vector>
+
+
+
+namespace YUME::Utils
+{
+	// Image read straight from a KTX2 or DDS file, already in a GPU format.
+	// Data is laid out level by level, level 0 first, each level holding every layer (cube faces are layers).
+	struct ImageContainer
+	{
+		TextureFormat Format = TextureFormat::None;
+		uint32_t Width		 = 0;
+		uint32_t Height		 = 0;
+		uint32_t MipLevels	 = 1;
+		uint32_t LayerCount	 = 1;
+		bool IsCubeMap		 = false;
+
+		std::vector<uint8_t> Data;
+	};
+
+	// .ktx2 and .dds, everything else goes through LoadImageFromFile
+	bool IsImageContainerFile(const std::filesystem::path& p_Path);
+
+	bool LoadImageContainer(const char* p_Path, ImageContainer& p_Image);
+
+	// CPU fallback for devices without the block format, every level and layer is decoded to RGBA8
+	bool DecompressImageContainer(const ImageContainer& p_Image, ImageContainer& p_Decoded);
+}
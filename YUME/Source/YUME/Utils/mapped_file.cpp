@@ -0,0 +1,119 @@
+#include "YUME/yumepch.h"
+#include "mapped_file.h"
+
+// std
+#ifdef YM_PLATFORM_LINUX
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+
+
+namespace YUME::Utils
+{
+	#ifdef YM_PLATFORM_WINDOWS
+
+	bool MappedFile::Open(const std::filesystem::path& p_Path)
+	{
+		YM_PROFILE_FUNCTION()
+
+		Close();
+
+		HANDLE file = CreateFileW(p_Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!data)
+		{
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_File	  = file;
+		m_Mapping = mapping;
+		m_Data	  = (const uint8_t*)data;
+		m_Size	  = (size_t)size.QuadPart;
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+		if (m_Mapping)
+			CloseHandle((HANDLE)m_Mapping);
+		if (m_File)
+			CloseHandle((HANDLE)m_File);
+
+		m_Data	  = nullptr;
+		m_Size	  = 0;
+		m_Mapping = nullptr;
+		m_File	  = nullptr;
+	}
+
+	#elif defined(YM_PLATFORM_LINUX)
+
+	bool MappedFile::Open(const std::filesystem::path& p_Path)
+	{
+		YM_PROFILE_FUNCTION()
+
+		Close();
+
+		int file = open(p_Path.c_str(), O_RDONLY);
+		if (file < 0)
+			return false;
+
+		struct stat info{};
+		if (fstat(file, &info) != 0 || info.st_size <= 0)
+		{
+			close(file);
+			return false;
+		}
+
+		void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+		// The mapping keeps its own reference to the file
+		close(file);
+
+		if (data == MAP_FAILED)
+			return false;
+
+		// Everything is read front to back while uploading
+		madvise(data, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+		m_Data = (const uint8_t*)data;
+		m_Size = (size_t)info.st_size;
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			munmap((void*)m_Data, m_Size);
+
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+
+	#endif
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "YUME/Core/base.h"
+
+// std
+#include <cstdint>
+#include <filesystem>
+
+
+
+namespace YUME::Utils
+{
+	// Read only view of a whole file, the pages are loaded by the OS on first touch
+	class YM_API MappedFile
+	{
+		public:
+			MappedFile() = default;
+			explicit MappedFile(const std::filesystem::path& p_Path) { Open(p_Path); }
+			~MappedFile() { Close(); }
+
+			bool Open(const std::filesystem::path& p_Path);
+			void Close();
+
+			bool IsOpen() const { return m_Data != nullptr; }
+
+			const uint8_t* GetData() const { return m_Data; }
+			size_t GetSize() const { return m_Size; }
+
+		private:
+			const uint8_t* m_Data = nullptr;
+			size_t m_Size		  = 0;
+
+		#ifdef YM_PLATFORM_WINDOWS
+			void* m_File		  = nullptr;
+			void* m_Mapping		  = nullptr;
+		#endif
+
+			YM_NONCOPYABLEANDMOVE(MappedFile)
+	};
+}
@@ -1,11 +1,16 @@
 #include "YUME/yumepch.h"
 #include "utils.h"
+#include "YUME/Core/jobs.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
-#ifdef YM_PLATFORM_LINUX
+// SSE2 is part of x86-64 and NEON of ARM64, stb only needs to be told about NEON
+#if defined(YM_PLATFORM_LINUX) && !defined(__x86_64__) && !defined(__aarch64__)
 	#define STBI_NO_SIMD
 #endif
+#if defined(__aarch64__)
+	#define STBI_NEON
+#endif
 #include <stb_image.h>
 #include <stb_image_resize2.h>
 
@@ -27,26 +32,27 @@ namespace YUME::Utils
 	{
 		YM_PROFILE_FUNCTION()
 
-		stbi_set_flip_vertically_on_load(p_FlipY);
+		// The global flag would leak between images decoded on different jobs
+		stbi_set_flip_vertically_on_load_thread(p_FlipY);
 
+		// Always RGBA, the three channel formats are barely supported as sampled images
 		int texWidth = 0, texHeight = 0, texChannels = 0;
 		stbi_uc* pixels	  = nullptr;
 		int sizeOfChannel = 8;
-		if (stbi_is_hdr(p_Path))
+		bool isHDR		  = stbi_is_hdr(p_Path);
+		if (isHDR)
 		{
 			sizeOfChannel = 32;
 			pixels = (uint8_t*)stbi_loadf(p_Path, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
-
-			if (p_IsHDR) *p_IsHDR = true;
 		}
 		else
 		{
 			pixels = stbi_load(p_Path, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
-
-			if (p_IsHDR) *p_IsHDR = false;
 		}
 
-		if (!p_IsHDR && s_MaxWidth > 0 && s_MaxHeight > 0 && ((uint32_t)texWidth > s_MaxWidth || (uint32_t)texHeight > s_MaxHeight))
+		if (p_IsHDR) *p_IsHDR = isHDR;
+
+		if (pixels && s_MaxWidth > 0 && s_MaxHeight > 0 && ((uint32_t)texWidth > s_MaxWidth || (uint32_t)texHeight > s_MaxHeight))
 		{
 			uint32_t texWidthOld = texWidth, texHeightOld = texHeight;
 			float aspectRatio = static_cast<float>(texWidth) / static_cast<float>(texHeight);
@@ -61,20 +67,21 @@ namespace YUME::Utils
 				texWidth = static_cast<uint32_t>(s_MaxHeight * aspectRatio);
 			}
 
-			int resizedChannels = texChannels;
-			uint8_t* resizedPixels = (stbi_uc*)malloc(texWidth * texHeight * resizedChannels);
-
-			if (p_IsHDR)
+			// Same allocator as stb_image, so FreeImage works for both
+			uint8_t* resizedPixels = (stbi_uc*)STBI_MALLOC(size_t(texWidth) * size_t(texHeight) * STBIR_RGBA * (sizeOfChannel / 8));
+			if (resizedPixels && ResizeImage(pixels, texWidthOld, texHeightOld, resizedPixels, texWidth, texHeight, isHDR))
 			{
-				stbir_resize_float_linear((float*)pixels, texWidthOld, texHeightOld, 0, (float*)resizedPixels, texWidth, texHeight, 0, STBIR_RGBA);
+				stbi_image_free(pixels);
+				pixels = resizedPixels;
 			}
 			else
 			{
-				stbir_resize_uint8_linear(pixels, texWidthOld, texHeightOld, 0, resizedPixels, texWidth, texHeight, 0, STBIR_RGBA);
+				// The full size image is still valid, only bigger than asked for
+				YM_CORE_WARN("Could not downscale image '{}', it is kept at {}x{}", p_Path, texWidthOld, texHeightOld)
+				stbi_image_free(resizedPixels);
+				texWidth  = texWidthOld;
+				texHeight = texHeightOld;
 			}
-
-			free(pixels);
-			pixels = resizedPixels;
 		}
 
 		if (!pixels)
@@ -84,13 +91,19 @@ namespace YUME::Utils
 
 			texChannels = 4;
 
+			if (p_IsHDR)	*p_IsHDR	= false;
 			if (p_Width)	*p_Width	= 2;
 			if (p_Height)	*p_Height	= 2;
-			if (p_Bytes)	*p_Bytes	= sizeOfChannel / 8;
+			if (p_Bytes)	*p_Bytes	= 1;
 			if (p_Channels) *p_Channels = texChannels;
 
-			const int32_t size = (*p_Width) * (*p_Height) * texChannels;
-			uint8_t* data = new uint8_t[size];
+			const int32_t size = 2 * 2 * texChannels;
+			uint8_t* data = (uint8_t*)STBI_MALLOC(size);
+			if (!data)
+			{
+				YM_CORE_ERROR("Out of memory for the fallback of '{}'!", p_Path)
+				return nullptr;
+			}
 
 			uint8_t datatwo[16] = {
 				255, 0  , 255, 255,
@@ -112,12 +125,49 @@ namespace YUME::Utils
 		if (p_Bytes)	*p_Bytes	= sizeOfChannel / 8;
 		if (p_Channels) *p_Channels = texChannels;
 
-		const uint64_t size = uint64_t(texWidth) * uint64_t(texHeight) * uint64_t(texChannels) * uint64_t(sizeOfChannel / 8U);
-		uint8_t* result = new uint8_t[size];
-		memcpy(result, pixels, size);
+		// Handed over as decoded, the texture upload copies it into the staging buffer
+		return pixels;
+	}
+
+	void FreeImage(uint8_t* p_Data)
+	{
+		stbi_image_free(p_Data);
+	}
+
+	uint8_t* AllocateImage(size_t p_SizeBytes)
+	{
+		return (uint8_t*)STBI_MALLOC(p_SizeBytes);
+	}
+
+	bool ResizeImage(const uint8_t* p_Input, uint32_t p_Width, uint32_t p_Height, uint8_t* p_Output, uint32_t p_NewWidth, uint32_t p_NewHeight, bool p_Float)
+	{
+		YM_PROFILE_FUNCTION()
+
+		STBIR_RESIZE resize;
+		stbir_resize_init(&resize, p_Input, (int)p_Width, (int)p_Height, 0, p_Output, (int)p_NewWidth, (int)p_NewHeight, 0,
+			STBIR_RGBA, p_Float ? STBIR_TYPE_FLOAT : STBIR_TYPE_UINT8);
+
+		// Output rows are split between the jobs, stb may use fewer splits than asked for
+		int splits = stbir_build_samplers_with_splits(&resize, (int)JobSystem::GetWorkerCount() + 1);
+		if (splits <= 0)
+		{
+			YM_CORE_ERROR("Failed to resize image to {}x{}", p_NewWidth, p_NewHeight)
+			return false;
+		}
+
+		std::atomic<bool> succeeded = true;
+		JobSystem::ParallelFor((uint32_t)splits, 1, [&](uint32_t p_Split)
+		{
+			if (!stbir_resize_extended_split(&resize, (int)p_Split, 1))
+				succeeded = false;
+		});
+
+		stbir_free_samplers(&resize);
+
+		if (!succeeded)
+			YM_CORE_ERROR("Failed to resize image to {}x{}", p_NewWidth, p_NewHeight)
 
-		stbi_image_free(pixels);
-		return result;
+		return succeeded;
 	}
 
 	void GetMaxImagesSize(uint32_t* p_Width, uint32_t* p_Height)
@@ -8,7 +8,14 @@ namespace YUME::Utils
 {
 	void CreateDirectoryIfNeeded(const std::filesystem::path& p_Path);
 
+	// Always RGBA, downscaled to GetMaxImagesSize(). The result is freed with FreeImage.
 	uint8_t* LoadImageFromFile(const char* p_Path, uint32_t* p_Width, uint32_t* p_Height, uint32_t* p_Channels, uint32_t* p_Bytes, bool* p_IsHDR = nullptr, bool p_FlipY = false);
+	void FreeImage(uint8_t* p_Data);
+	// Pixels allocated like the loaded ones, so both are freed with FreeImage
+	uint8_t* AllocateImage(size_t p_SizeBytes);
+
+	// RGBA8, or RGBA32F with p_Float, split across the job threads. On failure p_Output is left undefined
+	bool ResizeImage(const uint8_t* p_Input, uint32_t p_Width, uint32_t p_Height, uint8_t* p_Output, uint32_t p_NewWidth, uint32_t p_NewHeight, bool p_Float = false);
 
 	void GetMaxImagesSize(uint32_t* p_Width, uint32_t* p_Height);
 }
\ No newline at end of file
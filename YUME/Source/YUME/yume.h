@@ -3,6 +3,7 @@
 #include "YUME/Core/application.h"
 #include "YUME/Core/layer.h"
 #include "YUME/Core/log.h"
+#include "YUME/Core/jobs.h"
 
 // Events
 // --------------------------
@@ -25,6 +26,7 @@
 #include "YUME/Utils/timer.h"
 #include "YUME/Utils/scoped_timer.h"
 #include "YUME/Utils/clock.h"
+#include "YUME/Debug/profiler.h"
 // --------------------------
 
 // Scene
@@ -96,6 +96,11 @@ project "YUME"
 			"YM_PLATFORM_LINUX"
 		}
 
+		links
+		{
+			"pthread"
+		}
+
 		postbuildcommands 
 		{
 			("if [ -f " .. destination .. " ]; then \\"),
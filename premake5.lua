@@ -39,4 +39,5 @@ group ""
 
 group "Misc"
 	include "Sandbox"
+	include "Bench"
 group ""
\ No newline at end of file